@@ -3,42 +3,124 @@
 
 namespace NodeEditorCore {
     void NodeEditor::removeConnection(int connectionId) {
-        removeAllReroutesFromConnection(connectionId);
-
-        auto it = std::find_if(m_state.connections.begin(), m_state.connections.end(),
-                               [connectionId](const Connection &conn) { return conn.id == connectionId; });
+        uint32_t index = m_state.connectionHandles.denseIndex(static_cast<uint32_t>(connectionId));
 
-        if (it != m_state.connections.end()) {
-            UUID connectionUuid = it->uuid;
+        if (index != HandleAllocator::npos) {
+            UUID connectionUuid = m_state.connections[index].uuid;
 
             if (m_state.connectionRemovedCallback) {
                 m_state.connectionRemovedCallback(connectionId, connectionUuid);
             }
 
-            m_state.connections.erase(it);
-            updateConnectionUuidMap();
+            index = m_state.connectionHandles.denseIndex(static_cast<uint32_t>(connectionId));
+            if (index == HandleAllocator::npos) {
+                return;
+            }
+
+            const Connection &connection = m_state.connections[index];
+            int startNodeId = connection.startNodeId;
+            int startPinId = connection.startPinId;
+            int endNodeId = connection.endNodeId;
+            int endPinId = connection.endPinId;
+
+            unlinkConnection(connection);
+            purgeConnectionReferences(connectionId);
+            m_animationManager.removeConnection(connectionId);
+            m_state.connectionHandles.release(static_cast<uint32_t>(connectionId));
+            m_state.connectionUuidMap.erase(connectionUuid);
+            m_state.connections.erase(m_state.connections.begin() + index);
+            reindexConnections(index);
+            m_state.graphVersion++;
+
+            if (Node *startNode = getNode(startNodeId)) {
+                if (Pin *pin = startNode->findPin(startPinId)) {
+                    pin->connected = hasPinConnections(startNodeId, startPinId);
+                }
+            }
 
-            refreshPinConnectionStates();
+            if (Node *endNode = getNode(endNodeId)) {
+                if (Pin *pin = endNode->findPin(endPinId)) {
+                    pin->connected = hasPinConnections(endNodeId, endPinId);
+                }
+            }
         }
     }
 
-    Connection *NodeEditor::getConnection(int connectionId) {
-        for (auto &connection: m_state.connections) {
-            if (connection.id == connectionId) {
-                return &connection;
-            }
+    void NodeEditor::purgeConnectionReferences(int connectionId) {
+        removeAllReroutesFromConnection(connectionId);
+
+        for (auto &subgraphPair: m_subgraphs) {
+            subgraphPair.second->removeConnection(connectionId);
         }
 
-        return nullptr;
+        if (m_state.hoveredConnectionId == connectionId) {
+            m_state.hoveredConnectionId = -1;
+        }
+
+        auto &pending = m_state.pendingCreatedConnections;
+        pending.erase(std::remove(pending.begin(), pending.end(), connectionId), pending.end());
     }
 
-    const Connection *NodeEditor::getConnection(int connectionId) const {
-        for (const auto &connection: m_state.connections) {
-            if (connection.id == connectionId) {
-                return &connection;
+    uint64_t NodeEditor::makePinKey(int nodeId, int pinId) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(nodeId)) << 32) | static_cast<uint32_t>(pinId);
+    }
+
+    void NodeEditor::linkConnection(const Connection &connection) {
+        m_state.nodeOutputConnections[connection.startNodeId].push_back(connection.id);
+        m_state.nodeInputConnections[connection.endNodeId].push_back(connection.id);
+        m_state.pinConnections[makePinKey(connection.startNodeId, connection.startPinId)].push_back(connection.id);
+        m_state.pinConnections[makePinKey(connection.endNodeId, connection.endPinId)].push_back(connection.id);
+    }
+
+    void NodeEditor::unlinkConnection(const Connection &connection) {
+        auto eraseFrom = [id = connection.id](auto &adjacency, auto key) {
+            auto it = adjacency.find(key);
+            if (it == adjacency.end()) return;
+
+            auto &ids = it->second;
+            ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+            if (ids.empty()) {
+                adjacency.erase(it);
             }
+        };
+
+        eraseFrom(m_state.nodeOutputConnections, connection.startNodeId);
+        eraseFrom(m_state.nodeInputConnections, connection.endNodeId);
+        eraseFrom(m_state.pinConnections, makePinKey(connection.startNodeId, connection.startPinId));
+        eraseFrom(m_state.pinConnections, makePinKey(connection.endNodeId, connection.endPinId));
+    }
+
+    void NodeEditor::rebuildConnectionAdjacency() {
+        m_state.nodeInputConnections.clear();
+        m_state.nodeOutputConnections.clear();
+        m_state.pinConnections.clear();
+
+        for (const auto &connection: m_state.connections) {
+            linkConnection(connection);
         }
-        return nullptr;
+    }
+
+    bool NodeEditor::hasPinConnections(int nodeId, int pinId) const {
+        auto it = m_state.pinConnections.find(makePinKey(nodeId, pinId));
+        return it != m_state.pinConnections.end() && !it->second.empty();
+    }
+
+    Connection *NodeEditor::getConnection(int connectionId) {
+        uint32_t index = m_state.connectionHandles.denseIndex(static_cast<uint32_t>(connectionId));
+        return index != HandleAllocator::npos ? &m_state.connections[index] : nullptr;
+    }
+
+    const Connection *NodeEditor::getConnection(int connectionId) const {
+        uint32_t index = m_state.connectionHandles.denseIndex(static_cast<uint32_t>(connectionId));
+        return index != HandleAllocator::npos ? &m_state.connections[index] : nullptr;
+    }
+
+    Handle NodeEditor::getConnectionHandle(int connectionId) const {
+        return m_state.connectionHandles.handle(static_cast<uint32_t>(connectionId));
+    }
+
+    bool NodeEditor::isConnectionHandleValid(const Handle &handle) const {
+        return m_state.connectionHandles.isValid(handle);
     }
 
     const std::vector<Connection> &NodeEditor::getConnections() const {
@@ -67,44 +149,43 @@ namespace NodeEditorCore {
     }
 
     bool NodeEditor::isConnected(int nodeId, int pinId) const {
-        for (const auto &conn: m_state.connections) {
-            if ((conn.startNodeId == nodeId && conn.startPinId == pinId) ||
-                (conn.endNodeId == nodeId && conn.endPinId == pinId)) {
-                return true;
-            }
-        }
-        return false;
+        return hasPinConnections(nodeId, pinId);
     }
 
     bool NodeEditor::isConnectedByUUID(const UUID &nodeUuid, const UUID &pinUuid) const {
-        for (const auto &conn: m_state.connections) {
-            if ((conn.startNodeUuid == nodeUuid && conn.startPinUuid == pinUuid) ||
-                (conn.endNodeUuid == nodeUuid && conn.endPinUuid == pinUuid)) {
-                return true;
-            }
-        }
-        return false;
+        const Node *node = getNodeByUUID(nodeUuid);
+        if (!node) return false;
+
+        const Pin *pin = node->findPinByUUID(pinUuid);
+        return pin && hasPinConnections(node->id, pin->id);
     }
 
     bool NodeEditor::doesConnectionExist(int startNodeId, int startPinId, int endNodeId, int endPinId) const {
-        return std::any_of(m_state.connections.begin(), m_state.connections.end(),
-                           [=](const Connection &conn) {
-                               return conn.startNodeId == startNodeId &&
-                                      conn.startPinId == startPinId &&
-                                      conn.endNodeId == endNodeId &&
-                                      conn.endPinId == endPinId;
+        auto it = m_state.pinConnections.find(makePinKey(startNodeId, startPinId));
+        if (it == m_state.pinConnections.end()) return false;
+
+        return std::any_of(it->second.begin(), it->second.end(),
+                           [&](int connectionId) {
+                               const Connection *conn = getConnection(connectionId);
+                               return conn &&
+                                      conn->startNodeId == startNodeId &&
+                                      conn->startPinId == startPinId &&
+                                      conn->endNodeId == endNodeId &&
+                                      conn->endPinId == endPinId;
                            });
     }
 
     bool NodeEditor::doesConnectionExistByUUID(const UUID &startNodeUuid, const UUID &startPinUuid,
                                                const UUID &endNodeUuid, const UUID &endPinUuid) const {
-        return std::any_of(m_state.connections.begin(), m_state.connections.end(),
-                           [&](const Connection &conn) {
-                               return conn.startNodeUuid == startNodeUuid &&
-                                      conn.startPinUuid == startPinUuid &&
-                                      conn.endNodeUuid == endNodeUuid &&
-                                      conn.endPinUuid == endPinUuid;
-                           });
+        const Node *startNode = getNodeByUUID(startNodeUuid);
+        const Node *endNode = getNodeByUUID(endNodeUuid);
+        if (!startNode || !endNode) return false;
+
+        const Pin *startPin = startNode->findPinByUUID(startPinUuid);
+        const Pin *endPin = endNode->findPinByUUID(endPinUuid);
+        if (!startPin || !endPin) return false;
+
+        return doesConnectionExist(startNode->id, startPin->id, endNode->id, endPin->id);
     }
 
     bool NodeEditor::canCreateConnection(const Pin &startPin, const Pin &endPin) const {
@@ -179,7 +260,8 @@ namespace NodeEditorCore {
             return -1;
         }
 
-        int connectionId = m_state.nextConnectionId++;
+        int connectionId = static_cast<int>(
+            m_state.connectionHandles.allocate(static_cast<uint32_t>(m_state.connections.size())).index);
         Connection connection(connectionId, startNodeId, startPinId, endNodeId, endPinId);
 
         connection.uuid = uuid.empty() ? generateUUID() : uuid;
@@ -201,18 +283,18 @@ namespace NodeEditorCore {
         }
 
         connection.subgraphId = commonSubgraphId;
-        if (commonSubgraphId >= 0) {
-            connection.metadata.setAttribute("subgraphId", commonSubgraphId);
-        }
 
         startPinInternal->connected = true;
         endPinInternal->connected = true;
 
         m_state.connections.push_back(connection);
+        reindexConnections(m_state.connections.size() - 1);
+        linkConnection(m_state.connections.back());
+        m_state.graphVersion++;
 
-        updateConnectionUuidMap();
-
-        if (m_state.connectionCreatedCallback) {
+        if (m_state.batchDepth > 0) {
+            m_state.pendingCreatedConnections.push_back(connectionId);
+        } else if (m_state.connectionCreatedCallback) {
             m_state.connectionCreatedCallback(connectionId, connection.uuid);
         }
 
@@ -369,7 +451,7 @@ namespace NodeEditorCore {
 
     int NodeEditor::getConnectionId(const UUID &uuid) const {
         auto it = m_state.connectionUuidMap.find(uuid);
-        return it != m_state.connectionUuidMap.end() ? it->second->id : -1;
+        return it != m_state.connectionUuidMap.end() ? m_state.connections[it->second].id : -1;
     }
 
     int NodeEditor::addConnectionByUUID(const UUID &startNodeUuid, const UUID &startPinUuid,
@@ -420,42 +502,24 @@ namespace NodeEditorCore {
 
     UUID NodeEditor::addConnectionWithUUID(int startNodeId, int startPinId, int endNodeId, int endPinId) {
         int connectionId = addConnection(startNodeId, startPinId, endNodeId, endPinId);
-        if (connectionId == -1) return "";
+        if (connectionId == -1) return UUID();
         return getConnectionUUID(connectionId);
     }
 
     UUID NodeEditor::addConnectionWithUUIDByUUID(const UUID &startNodeUuid, const UUID &startPinUuid,
                                                  const UUID &endNodeUuid, const UUID &endPinUuid) {
-        int connectionId = addConnectionByUUID(startNodeUuid, startPinUuid, endNodeUuid, endPinUuid, "");
-        if (connectionId == -1) return "";
+        int connectionId = addConnectionByUUID(startNodeUuid, startPinUuid, endNodeUuid, endPinUuid, UUID());
+        if (connectionId == -1) return UUID();
         return getConnectionUUID(connectionId);
     }
 
     Connection *NodeEditor::getConnectionByUUID(const UUID &uuid) {
         auto it = m_state.connectionUuidMap.find(uuid);
-        if (it != m_state.connectionUuidMap.end()) {
-            return it->second;
-        }
-
-        for (auto &connection: m_state.connections) {
-            if (connection.uuid == uuid) {
-                return &connection;
-            }
-        }
-        return nullptr;
+        return it != m_state.connectionUuidMap.end() ? &m_state.connections[it->second] : nullptr;
     }
 
     const Connection *NodeEditor::getConnectionByUUID(const UUID &uuid) const {
         auto it = m_state.connectionUuidMap.find(uuid);
-        if (it != m_state.connectionUuidMap.end()) {
-            return it->second;
-        }
-
-        for (const auto &connection: m_state.connections) {
-            if (connection.uuid == uuid) {
-                return &connection;
-            }
-        }
-        return nullptr;
+        return it != m_state.connectionUuidMap.end() ? &m_state.connections[it->second] : nullptr;
     }
 }
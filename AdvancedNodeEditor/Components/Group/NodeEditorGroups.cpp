@@ -5,51 +5,53 @@ namespace NodeEditorCore {
     int NodeEditor::addGroup(const std::string &name, const Vec2 &pos, const Vec2 &size, const UUID &uuid) {
         int groupId = m_state.nextGroupId++;
         m_state.groups.emplace_back(groupId, name, pos, size);
-
-        Group *group = getGroup(groupId);
-        if (group) {
-            group->uuid = uuid.empty() ? generateUUID() : uuid;
-            updateGroupUuidMap();
-        }
+        m_state.groups.back().uuid = uuid.empty() ? generateUUID() : uuid;
+        reindexGroups(m_state.groups.size() - 1);
 
         return groupId;
     }
 
     void NodeEditor::removeGroup(int groupId) {
-        auto it = std::find_if(m_state.groups.begin(), m_state.groups.end(),
-                               [groupId](const Group &group) { return group.id == groupId; });
+        auto indexIt = m_state.groupIndexMap.find(groupId);
+
+        if (indexIt != m_state.groupIndexMap.end()) {
+            size_t index = indexIt->second;
+            auto it = m_state.groups.begin() + index;
 
-        if (it != m_state.groups.end()) {
             for (int nodeId: it->nodes) {
                 Node *node = getNode(nodeId);
                 if (node) node->groupId = -1;
             }
 
+            m_state.groupIndexMap.erase(groupId);
+            m_state.groupUuidMap.erase(it->uuid);
             m_state.groups.erase(it);
-            updateGroupUuidMap();
+            reindexGroups(index);
         }
     }
 
     Group *NodeEditor::getGroup(int groupId) {
-        auto it = std::find_if(m_state.groups.begin(), m_state.groups.end(),
-                               [groupId](const Group &group) { return group.id == groupId; });
-        return it != m_state.groups.end() ? &(*it) : nullptr;
+        auto it = m_state.groupIndexMap.find(groupId);
+        return it != m_state.groupIndexMap.end() ? &m_state.groups[it->second] : nullptr;
     }
 
     const Group *NodeEditor::getGroup(int groupId) const {
-        auto it = std::find_if(m_state.groups.begin(), m_state.groups.end(),
-                               [groupId](const Group &group) { return group.id == groupId; });
-        return it != m_state.groups.end() ? &(*it) : nullptr;
+        auto it = m_state.groupIndexMap.find(groupId);
+        return it != m_state.groupIndexMap.end() ? &m_state.groups[it->second] : nullptr;
+    }
+
+    const std::vector<Group> &NodeEditor::getGroups() const {
+        return m_state.groups;
     }
 
     UUID NodeEditor::getGroupUUID(int groupId) const {
         const Group *group = getGroup(groupId);
-        return group ? group->uuid : "";
+        return group ? group->uuid : UUID();
     }
 
     int NodeEditor::getGroupId(const UUID &uuid) const {
         auto it = m_state.groupUuidMap.find(uuid);
-        return it != m_state.groupUuidMap.end() ? it->second->id : -1;
+        return it != m_state.groupUuidMap.end() ? m_state.groups[it->second].id : -1;
     }
 
     void NodeEditor::addNodeToGroup(int nodeId, int groupId) {
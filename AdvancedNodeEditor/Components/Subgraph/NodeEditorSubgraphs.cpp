@@ -68,8 +68,8 @@ namespace NodeEditorCore {
             addNodeToSubgraph(inputNodeId, subgraphId);
             addNodeToSubgraph(outputNodeId, subgraphId);
 
-            subgraph->metadata.setAttribute("inputNodeId", inputNodeId);
-            subgraph->metadata.setAttribute("outputNodeId", outputNodeId);
+            subgraph->inputNodeId = inputNodeId;
+            subgraph->outputNodeId = outputNodeId;
         }
 
         return subgraphId;
@@ -123,7 +123,7 @@ namespace NodeEditorCore {
                 m_state.currentSubgraphUuid = m_subgraphUuidStack.top();
                 m_subgraphUuidStack.pop();
             } else {
-                m_state.currentSubgraphUuid = "";
+                m_state.currentSubgraphUuid.clear();
             }
 
             if (m_state.currentSubgraphId >= 0) {
@@ -133,7 +133,7 @@ namespace NodeEditorCore {
             return true;
         } else {
             m_state.currentSubgraphId = -1;
-            m_state.currentSubgraphUuid = "";
+            m_state.currentSubgraphUuid.clear();
             return true;
         }
     }
@@ -163,8 +163,8 @@ namespace NodeEditorCore {
     void NodeEditor::updateSubgraphNodePins(Node *subgraphNode, Subgraph *subgraph) {
         if (!subgraphNode || !subgraph) return;
 
-        int inputNodeId = subgraph->metadata.getAttribute<int>("inputNodeId", -1);
-        int outputNodeId = subgraph->metadata.getAttribute<int>("outputNodeId", -1);
+        int inputNodeId = subgraph->inputNodeId;
+        int outputNodeId = subgraph->outputNodeId;
 
         Node *inputNode = getNode(inputNodeId);
         Node *outputNode = getNode(outputNodeId);
@@ -210,8 +210,8 @@ namespace NodeEditorCore {
         node->subgraphId = subgraphId;
         node->subgraphUuid = subgraph->uuid;
 
-        int inputNodeId = subgraph->metadata.getAttribute<int>("inputNodeId", -1);
-        int outputNodeId = subgraph->metadata.getAttribute<int>("outputNodeId", -1);
+        int inputNodeId = subgraph->inputNodeId;
+        int outputNodeId = subgraph->outputNodeId;
 
         Node *inputNode = getNode(inputNodeId);
         Node *outputNode = getNode(outputNodeId);
@@ -220,7 +220,7 @@ namespace NodeEditorCore {
             for (const auto &pin: inputNode->outputs) {
                 int newPinId = addPin(node->id, pin.name, true, static_cast<PinType>(pin.type));
 
-                int interfaceId = (inputNodeId << 16) | pin.id;
+                uint64_t interfaceId = Subgraph::makeInterfaceKey(inputNodeId, pin.id);
                 subgraph->interfaceInputs.push_back(interfaceId);
             }
         }
@@ -229,7 +229,7 @@ namespace NodeEditorCore {
             for (const auto &pin: outputNode->inputs) {
                 int newPinId = addPin(node->id, pin.name, false, static_cast<PinType>(pin.type));
 
-                int interfaceId = (outputNodeId << 16) | pin.id;
+                uint64_t interfaceId = Subgraph::makeInterfaceKey(outputNodeId, pin.id);
                 subgraph->interfaceOutputs.push_back(interfaceId);
             }
         }
@@ -249,7 +249,7 @@ namespace NodeEditorCore {
             }
         }
 
-        return "";
+        return UUID();
     }
 
     UUID NodeEditor::createSubgraphWithUUID(const std::string &name) {
@@ -272,8 +272,8 @@ namespace NodeEditorCore {
         for (int nodeId: it->second->nodeIds) {
             const Node *node = getNode(nodeId);
             if (node && !node->isProtected &&
-                !(nodeId == it->second->metadata.getAttribute<int>("inputNodeId", -1) ||
-                  nodeId == it->second->metadata.getAttribute<int>("outputNodeId", -1))) {
+                !(nodeId == it->second->inputNodeId ||
+                  nodeId == it->second->outputNodeId)) {
                 result.push_back(nodeId);
             }
         }
@@ -302,6 +302,7 @@ namespace NodeEditorCore {
 
         if (std::find(subgraph->nodeIds.begin(), subgraph->nodeIds.end(), nodeId) == subgraph->nodeIds.end()) {
             subgraph->nodeIds.push_back(nodeId);
+            m_state.graphVersion++;
         }
     }
 
@@ -319,6 +320,7 @@ namespace NodeEditorCore {
             std::remove(subgraph->nodeIds.begin(), subgraph->nodeIds.end(), nodeId),
             subgraph->nodeIds.end()
         );
+        m_state.graphVersion++;
     }
 
     void NodeEditor::addConnectionToSubgraph(int connectionId, int subgraphId) {
@@ -340,7 +342,6 @@ namespace NodeEditorCore {
         }
 
         connection->subgraphId = subgraphId;
-        connection->metadata.setAttribute("subgraphId", subgraphId);
     }
 
     bool NodeEditor::isConnectionInSubgraph(int connectionId, int subgraphId) const {
@@ -360,8 +361,7 @@ namespace NodeEditorCore {
 
         for (const auto &connection: m_state.connections) {
             if (connection.id == connectionId) {
-                if (connection.subgraphId == subgraphId ||
-                    connection.metadata.getAttribute<int>("subgraphId", -1) == subgraphId) {
+                if (connection.subgraphId == subgraphId) {
                     return true;
                 }
                 break;
@@ -379,7 +379,6 @@ namespace NodeEditorCore {
         Connection *connection = getConnection(connectionId);
         if (connection) {
             connection->subgraphId = -1;
-            connection->metadata.setAttribute("subgraphId", -1);
         }
 
         subgraph->connectionIds.erase(
@@ -454,29 +453,29 @@ namespace NodeEditorCore {
     void NodeEditor::setSubgraphIdForNode(int nodeId, int subgraphId) {
         Node *node = getNode(nodeId);
         if (node) {
-            node->metadata.setAttribute("subgraphId", subgraphId);
+            node->parentSubgraphId = subgraphId;
         }
     }
 
     void NodeEditor::setSubgraphUUIDForNode(int nodeId, const UUID &uuid) {
         Node *node = getNode(nodeId);
         if (node) {
-            node->metadata.setAttribute("subgraphUuid", uuid);
+            node->parentSubgraphUuid = uuid;
         }
     }
 
     UUID NodeEditor::getSubgraphUUIDForNode(int nodeId) const {
         const Node *node = getNode(nodeId);
         if (node) {
-            return node->metadata.getAttribute<UUID>("subgraphUuid", "");
+            return node->parentSubgraphUuid;
         }
-        return "";
+        return UUID();
     }
 
     int NodeEditor::getSubgraphIdForNode(int nodeId) const {
         const Node *node = getNode(nodeId);
         if (node) {
-            return node->metadata.getAttribute<int>("subgraphId", -1);
+            return node->parentSubgraphId;
         }
         return -1;
     }
@@ -517,6 +516,10 @@ namespace NodeEditorCore {
         return nullptr;
     }
 
+    const std::map<int, std::shared_ptr<Subgraph>> &NodeEditor::getSubgraphs() const {
+        return m_subgraphs;
+    }
+
     Subgraph *NodeEditor::getSubgraphByUUID(const UUID &uuid) {
         for (auto &pair: m_subgraphs) {
             if (pair.second->uuid == uuid) {
@@ -528,6 +531,7 @@ namespace NodeEditorCore {
 
     void NodeEditor::removeSubgraph(int subgraphId) {
         m_subgraphs.erase(subgraphId);
+        m_state.graphVersion++;
     }
 
     void NodeEditor::debugSubgraph(int subgraphId) {
@@ -537,7 +541,7 @@ namespace NodeEditorCore {
         Subgraph *subgraph = getSubgraph(subgraphId);
         if (!subgraph) return -1;
 
-        int inputNodeId = subgraph->metadata.getAttribute<int>("inputNodeId", -1);
+        int inputNodeId = subgraph->inputNodeId;
         if (inputNodeId == -1) return -1;
 
         Node *inputNode = getNode(inputNodeId);
@@ -546,7 +550,7 @@ namespace NodeEditorCore {
         int pinId = addPin(inputNodeId, name, false, type);
         if (pinId == -1) return -1;
 
-        int interfaceId = (inputNodeId << 16) | pinId;
+        uint64_t interfaceId = Subgraph::makeInterfaceKey(inputNodeId, pinId);
         subgraph->interfaceInputs.push_back(interfaceId);
 
         updateSubgraphInstances(subgraphId);
@@ -558,7 +562,7 @@ namespace NodeEditorCore {
         Subgraph *subgraph = getSubgraph(subgraphId);
         if (!subgraph) return -1;
 
-        int outputNodeId = subgraph->metadata.getAttribute<int>("outputNodeId", -1);
+        int outputNodeId = subgraph->outputNodeId;
         if (outputNodeId == -1) return -1;
 
         Node *outputNode = getNode(outputNodeId);
@@ -567,7 +571,7 @@ namespace NodeEditorCore {
         int pinId = addPin(outputNodeId, name, true, type);
         if (pinId == -1) return -1;
 
-        int interfaceId = (outputNodeId << 16) | pinId;
+        uint64_t interfaceId = Subgraph::makeInterfaceKey(outputNodeId, pinId);
         subgraph->interfaceOutputs.push_back(interfaceId);
 
         updateSubgraphInstances(subgraphId);
@@ -592,8 +596,8 @@ namespace NodeEditorCore {
             return;
         }
 
-        int inputNodeId = subgraph->metadata.getAttribute<int>("inputNodeId", -1);
-        int outputNodeId = subgraph->metadata.getAttribute<int>("outputNodeId", -1);
+        int inputNodeId = subgraph->inputNodeId;
+        int outputNodeId = subgraph->outputNodeId;
 
         Node *inputNode = getNode(inputNodeId);
         Node *outputNode = getNode(outputNodeId);
@@ -683,7 +687,7 @@ namespace NodeEditorCore {
                 return;
             }
 
-            int inputNodeId = subgraph->metadata.getAttribute<int>("inputNodeId", -1);
+            int inputNodeId = subgraph->inputNodeId;
             Node *inputNode = getNode(inputNodeId);
             if (!inputNode) {
                 m_isSynchronizing = false;
@@ -715,7 +719,7 @@ namespace NodeEditorCore {
                 return;
             }
 
-            int outputNodeId = subgraph->metadata.getAttribute<int>("outputNodeId", -1);
+            int outputNodeId = subgraph->outputNodeId;
             Node *outputNode = getNode(outputNodeId);
             if (!outputNode) {
                 m_isSynchronizing = false;
@@ -2,33 +2,23 @@
 
 namespace NodeEditorCore {
     UUID NodeEditor::getNodeUUID(int nodeId) const {
-        for (const auto &node: getNodes()) {
-            if (node.id == nodeId) {
-                return node.uuid;
-            }
-        }
-        return "";
+        const Node *node = getNode(nodeId);
+        return node ? node->uuid : UUID();
     }
 
     int NodeEditor::getNodeId(const UUID &uuid) const {
-        for (const auto &node: getNodes()) {
-            if (node.uuid == uuid) {
-                return node.id;
-            }
-        }
-        return -1;
+        auto it = m_state.nodeUuidMap.find(uuid);
+        return it != m_state.nodeUuidMap.end() ? m_state.nodes[it->second].id : -1;
     }
 
     Node *NodeEditor::getNodeByUUID(const UUID &uuid) {
-        int nodeId = getNodeId(uuid);
-        if (nodeId == -1) return nullptr;
-        return getNode(nodeId);
+        auto it = m_state.nodeUuidMap.find(uuid);
+        return it != m_state.nodeUuidMap.end() ? &m_state.nodes[it->second] : nullptr;
     }
 
     const Node *NodeEditor::getNodeByUUID(const UUID &uuid) const {
-        int nodeId = getNodeId(uuid);
-        if (nodeId == -1) return nullptr;
-        return getNode(nodeId);
+        auto it = m_state.nodeUuidMap.find(uuid);
+        return it != m_state.nodeUuidMap.end() ? &m_state.nodes[it->second] : nullptr;
     }
 
     void NodeEditor::removeNodeByUUID(const UUID &uuid) {
@@ -58,7 +48,7 @@ namespace NodeEditorCore {
 
     UUID NodeEditor::getPinUUID(int nodeId, int pinId) const {
         const Node *node = getNode(nodeId);
-        if (!node) return "";
+        if (!node) return UUID();
 
         for (const auto &pin: node->inputs) {
             if (pin.id == pinId) {
@@ -72,112 +62,40 @@ namespace NodeEditorCore {
             }
         }
 
-        return "";
+        return UUID();
     }
 
     Pin *NodeEditor::getPinByUUID(const UUID &nodeUuid, const UUID &pinUuid) {
         Node *node = getNodeByUUID(nodeUuid);
-        if (!node) return nullptr;
-
-        for (auto &pin: node->inputs) {
-            if (pin.uuid == pinUuid) {
-                static thread_local Pin result;
-                result.id = pin.id;
-                result.uuid = pin.uuid;
-                result.name = pin.name;
-                result.isInput = pin.isInput;
-                result.type = static_cast<PinType>(pin.type);
-                result.shape = static_cast<PinShape>(pin.shape);
-                result.connected = pin.connected;
-                return &result;
-            }
-        }
-
-        for (auto &pin: node->outputs) {
-            if (pin.uuid == pinUuid) {
-                static thread_local Pin result;
-                result.id = pin.id;
-                result.uuid = pin.uuid;
-                result.name = pin.name;
-                result.isInput = pin.isInput;
-                result.type = static_cast<PinType>(pin.type);
-                result.shape = static_cast<PinShape>(pin.shape);
-                result.connected = pin.connected;
-                return &result;
-            }
-        }
-
-        return nullptr;
+        return node ? node->findPinByUUID(pinUuid) : nullptr;
     }
 
     const Pin *NodeEditor::getPinByUUID(const UUID &nodeUuid, const UUID &pinUuid) const {
         const Node *node = getNodeByUUID(nodeUuid);
-        if (!node) return nullptr;
-
-        for (const auto &pin: node->inputs) {
-            if (pin.uuid == pinUuid) {
-                static thread_local Pin result;
-                result.id = pin.id;
-                result.uuid = pin.uuid;
-                result.name = pin.name;
-                result.isInput = pin.isInput;
-                result.type = static_cast<PinType>(pin.type);
-                result.shape = static_cast<PinShape>(pin.shape);
-                result.connected = pin.connected;
-                return &result;
-            }
-        }
-
-        for (const auto &pin: node->outputs) {
-            if (pin.uuid == pinUuid) {
-                static thread_local Pin result;
-                result.id = pin.id;
-                result.uuid = pin.uuid;
-                result.name = pin.name;
-                result.isInput = pin.isInput;
-                result.type = static_cast<PinType>(pin.type);
-                result.shape = static_cast<PinShape>(pin.shape);
-                result.connected = pin.connected;
-                return &result;
-            }
-        }
-
-        return nullptr;
+        return node ? node->findPinByUUID(pinUuid) : nullptr;
     }
 
     UUID NodeEditor::getConnectionUUID(int connectionId) const {
-        for (const auto &connection: getConnections()) {
-            if (connection.id == connectionId) {
-                return connection.uuid;
-            }
-        }
-        return "";
+        const Connection *connection = getConnection(connectionId);
+        return connection ? connection->uuid : UUID();
     }
 
     void NodeEditor::removeConnectionByUUID(const UUID &uuid) {
-        for (const auto &connection: getConnections()) {
-            if (connection.uuid == uuid) {
-                removeConnection(connection.id);
-                break;
-            }
+        int connectionId = getConnectionId(uuid);
+        if (connectionId != -1) {
+            removeConnection(connectionId);
         }
     }
 
     Group *NodeEditor::getGroupByUUID(const UUID &uuid) {
-        for (auto &group: m_state.groups) {
-            if (group.uuid == uuid) {
-                return &group;
-            }
-        }
-        return nullptr;
+        auto it = m_state.groupUuidMap.find(uuid);
+        return it != m_state.groupUuidMap.end() ? &m_state.groups[it->second] : nullptr;
     }
 
     void NodeEditor::removeGroupByUUID(const UUID &uuid) {
-        for (size_t i = 0; i < m_state.groups.size(); i++) {
-            if (m_state.groups[i].uuid == uuid) {
-                removeGroup(m_state.groups[i].id);
-                break;
-            }
+        int groupId = getGroupId(uuid);
+        if (groupId != -1) {
+            removeGroup(groupId);
         }
     }
 
@@ -191,24 +109,148 @@ namespace NodeEditorCore {
         }
     }
 
-    void NodeEditor::updateNodeUuidMap() {
+    std::unordered_map<int, int> NodeEditor::updateNodeUuidMap() {
+        m_state.nodeHandles.clear();
         m_state.nodeUuidMap.clear();
-        for (auto &node: m_state.nodes) {
-            m_state.nodeUuidMap[node.uuid] = &node;
+        m_state.nodeHandles.reserve(m_state.nodes.size());
+        m_state.nodeUuidMap.reserve(m_state.nodes.size());
+
+        // Files saved before ids were recycled can carry ids the allocator cannot hold, or collisions.
+        // Those nodes get fresh ids once every valid id is placed, so a fresh id never steals one.
+        std::vector<size_t> unplaced;
+        for (size_t i = 0; i < m_state.nodes.size(); ++i) {
+            const int id = m_state.nodes[i].id;
+            if (id <= 0 || !m_state.nodeHandles.acquire(static_cast<uint32_t>(id), static_cast<uint32_t>(i))) {
+                unplaced.push_back(i);
+            }
         }
+
+        std::unordered_map<int, int> remappedIds;
+        for (size_t i: unplaced) {
+            Node &node = m_state.nodes[i];
+            const bool duplicate = m_state.nodeHandles.isLive(static_cast<uint32_t>(node.id));
+            const int freshId = static_cast<int>(m_state.nodeHandles.allocate(static_cast<uint32_t>(i)).index);
+            // References by id to a duplicate stay with the node that owns the id; UUIDs tell them apart.
+            if (!duplicate) {
+                remappedIds.emplace(node.id, freshId);
+            }
+            node.id = freshId;
+        }
+
+        reindexNodes(0);
+        return remappedIds;
+    }
+
+    int NodeEditor::resolveLoadedNodeId(int nodeId, const UUID &nodeUuid,
+                                        const std::unordered_map<int, int> &nodeIdRemap) const {
+        if (!nodeUuid.empty()) {
+            auto it = m_state.nodeUuidMap.find(nodeUuid);
+            if (it != m_state.nodeUuidMap.end()) {
+                return m_state.nodes[it->second].id;
+            }
+        }
+        auto remapped = nodeIdRemap.find(nodeId);
+        return remapped != nodeIdRemap.end() ? remapped->second : nodeId;
     }
 
-    void NodeEditor::updateConnectionUuidMap() {
+    size_t NodeEditor::updateConnectionUuidMap(const std::unordered_map<int, int> &nodeIdRemap,
+                                               std::unordered_map<int, int> &connectionIdRemap) {
+        m_state.connectionHandles.clear();
         m_state.connectionUuidMap.clear();
-        for (auto &connection: m_state.connections) {
-            m_state.connectionUuidMap[connection.uuid] = &connection;
+        m_state.connectionHandles.reserve(m_state.connections.size());
+        m_state.connectionUuidMap.reserve(m_state.connections.size());
+
+        // Only a connection whose endpoint node is missing cannot be recovered.
+        size_t kept = 0;
+        std::vector<size_t> unplaced;
+        for (size_t i = 0; i < m_state.connections.size(); ++i) {
+            Connection &connection = m_state.connections[i];
+            connection.startNodeId = resolveLoadedNodeId(connection.startNodeId, connection.startNodeUuid, nodeIdRemap);
+            connection.endNodeId = resolveLoadedNodeId(connection.endNodeId, connection.endNodeUuid, nodeIdRemap);
+            if (!m_state.nodeHandles.isLive(static_cast<uint32_t>(connection.startNodeId)) ||
+                !m_state.nodeHandles.isLive(static_cast<uint32_t>(connection.endNodeId))) {
+                continue;
+            }
+
+            if (kept != i) {
+                m_state.connections[kept] = std::move(connection);
+            }
+            const int id = m_state.connections[kept].id;
+            if (id <= 0 || !m_state.connectionHandles.acquire(static_cast<uint32_t>(id), static_cast<uint32_t>(kept))) {
+                unplaced.push_back(kept);
+            }
+            ++kept;
+        }
+
+        const size_t dropped = m_state.connections.size() - kept;
+        m_state.connections.erase(m_state.connections.begin() + static_cast<std::ptrdiff_t>(kept),
+                                  m_state.connections.end());
+
+        for (size_t i: unplaced) {
+            Connection &connection = m_state.connections[i];
+            const bool duplicate = m_state.connectionHandles.isLive(static_cast<uint32_t>(connection.id));
+            const int freshId = static_cast<int>(m_state.connectionHandles.allocate(static_cast<uint32_t>(i)).index);
+            if (!duplicate) {
+                connectionIdRemap.emplace(connection.id, freshId);
+            }
+            connection.id = freshId;
         }
+
+        reindexConnections(0);
+        return dropped;
     }
 
-    void NodeEditor::updateGroupUuidMap() {
+    void NodeEditor::updateGroupUuidMap(const std::unordered_map<int, int> &nodeIdRemap) {
+        m_state.groupIndexMap.clear();
         m_state.groupUuidMap.clear();
+
         for (auto &group: m_state.groups) {
-            m_state.groupUuidMap[group.uuid] = &group;
+            std::unordered_set<int> members;
+            if (!group.nodeUuids.empty()) {
+                for (const UUID &nodeUuid: group.nodeUuids) {
+                    auto it = m_state.nodeUuidMap.find(nodeUuid);
+                    if (it != m_state.nodeUuidMap.end()) {
+                        members.insert(m_state.nodes[it->second].id);
+                    }
+                }
+            } else {
+                for (int nodeId: group.nodes) {
+                    const int resolved = resolveLoadedNodeId(nodeId, UUID(), nodeIdRemap);
+                    if (m_state.nodeHandles.isLive(static_cast<uint32_t>(resolved))) {
+                        members.insert(resolved);
+                    }
+                }
+            }
+
+            group.nodes = std::move(members);
+            group.nodeUuids.clear();
+            for (int nodeId: group.nodes) {
+                group.nodeUuids.insert(getNode(nodeId)->uuid);
+            }
+        }
+
+        reindexGroups(0);
+    }
+
+    void NodeEditor::reindexNodes(size_t first) {
+        for (size_t i = first; i < m_state.nodes.size(); ++i) {
+            m_state.nodeHandles.setDenseIndex(static_cast<uint32_t>(m_state.nodes[i].id), static_cast<uint32_t>(i));
+            m_state.nodeUuidMap[m_state.nodes[i].uuid] = i;
+        }
+    }
+
+    void NodeEditor::reindexConnections(size_t first) {
+        for (size_t i = first; i < m_state.connections.size(); ++i) {
+            m_state.connectionHandles.setDenseIndex(static_cast<uint32_t>(m_state.connections[i].id),
+                                                    static_cast<uint32_t>(i));
+            m_state.connectionUuidMap[m_state.connections[i].uuid] = i;
+        }
+    }
+
+    void NodeEditor::reindexGroups(size_t first) {
+        for (size_t i = first; i < m_state.groups.size(); ++i) {
+            m_state.groupIndexMap[m_state.groups[i].id] = i;
+            m_state.groupUuidMap[m_state.groups[i].uuid] = i;
         }
     }
 }
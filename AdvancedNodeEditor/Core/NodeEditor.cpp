@@ -3,17 +3,42 @@
 #include "imgui_internal.h"
 
 namespace NodeEditorCore {
+    namespace {
+        // Built-in commands take a UUID either as a value or as its canonical text.
+        bool commandUuid(const std::any &data, UUID &uuid) {
+            if (data.type() == typeid(UUID)) {
+                uuid = std::any_cast<UUID>(data);
+                return true;
+            }
+            if (data.type() == typeid(std::string)) {
+                const std::string &text = std::any_cast<const std::string &>(data);
+                return UUID::tryParse(text.data(), text.size(), uuid);
+            }
+            return false;
+        }
+    }
+
     std::vector<int> NodeEditor::getEvaluationOrder() const {
-        return NodeEvaluator::getEvaluationOrder(const_cast<NodeEditor &>(*this));
+        return NodeEvaluator::getEvaluationOrder(*this);
     }
 
     std::vector<UUID> NodeEditor::getEvaluationOrderUUIDs() const {
-        std::vector<UUID> result;
-        std::vector<int> order = getEvaluationOrder();
-        for (int nodeId: order) {
-            result.push_back(getNodeUUID(nodeId));
+        return NodeEvaluator::getEvaluationOrderUUIDs(*this);
+    }
+
+    const NodeEvaluator::EvaluationPlan &NodeEditor::getEvaluationPlan() const {
+        if (!m_evaluationPlan.valid ||
+            m_evaluationPlan.graphVersion != m_state.graphVersion ||
+            m_evaluationPlan.subgraphId != m_state.currentSubgraphId) {
+            m_evaluationPlan = NodeEvaluator(*this).compile();
+            m_evaluationPlan.graphVersion = m_state.graphVersion;
+            m_evaluationPlan.compileStamp = ++m_evaluationPlanCompiles;
         }
-        return result;
+        return m_evaluationPlan;
+    }
+
+    uint64_t NodeEditor::getGraphVersion() const {
+        return m_state.graphVersion;
     }
 
     void NodeEditor::setConnectionStyle(ConnectionStyleManager::ConnectionStyle style) {
@@ -268,11 +293,13 @@ namespace NodeEditorCore {
     void NodeEditor::enableMinimap(bool enable) {
         m_minimapManager.getConfig().interactable = enable;
         m_minimapManager.setNodePositionProvider([this]() {
+            const NodeGeometryStore &geometry = nodeGeometry();
+            geometry.collectInSubgraph(m_state.currentSubgraphId, m_nodeIndexScratch);
+
             std::vector<std::pair<Vec2, Vec2> > nodes;
-            for (const auto &node: m_state.nodes) {
-                if (isNodeInCurrentSubgraph(node)) {
-                    nodes.push_back(std::make_pair(node.position, node.size));
-                }
+            nodes.reserve(m_nodeIndexScratch.size());
+            for (uint32_t index: m_nodeIndexScratch) {
+                nodes.emplace_back(geometry.position(index), geometry.size(index));
             }
             return nodes;
         });
@@ -280,6 +307,7 @@ namespace NodeEditorCore {
             m_state.viewPosition = newViewPos;
             m_viewManager.setViewPosition(newViewPos);
         });
+        syncNodeGeometry();
         updateMinimapBounds();
     }
 
@@ -423,8 +451,7 @@ namespace NodeEditorCore {
                     UUID nodeUuid = getNodeUUID(nodeId);
                     removeNode(nodeId);
                     dispatchToUI(NodeEditorCommands::UI::ShowNodeRemoved, nodeUuid);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID nodeUuid = std::any_cast<UUID>(data);
+                } else if (UUID nodeUuid; commandUuid(data, nodeUuid)) {
                     removeNodeByUUID(nodeUuid);
                     dispatchToUI(NodeEditorCommands::UI::ShowNodeRemoved, nodeUuid);
                 }
@@ -439,8 +466,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int nodeId = std::any_cast<int>(data);
                     selectNode(nodeId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID nodeUuid = std::any_cast<UUID>(data);
+                } else if (UUID nodeUuid; commandUuid(data, nodeUuid)) {
                     selectNodeByUUID(nodeUuid);
                 }
             } catch (const std::bad_any_cast &) {
@@ -462,8 +488,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int nodeId = std::any_cast<int>(data);
                     duplicateNode(nodeId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID nodeUuid = std::any_cast<UUID>(data);
+                } else if (UUID nodeUuid; commandUuid(data, nodeUuid)) {
                     int nodeId = getNodeId(nodeUuid);
                     if (nodeId != -1) {
                         duplicateNode(nodeId);
@@ -496,10 +521,7 @@ namespace NodeEditorCore {
                     Vec2 position;
                 };
                 auto moveData = std::any_cast<NodeMoveData>(data);
-                Node *node = getNode(moveData.nodeId);
-                if (node) {
-                    node->position = moveData.position;
-                }
+                setNodePosition(moveData.nodeId, moveData.position);
             } catch (const std::bad_any_cast &) {
                 dispatchToUI(NodeEditorCommands::UI::ShowError,
                              std::string("Invalid data format for moving node"));
@@ -535,8 +557,7 @@ namespace NodeEditorCore {
                     UUID connUuid = getConnectionUUID(connId);
                     removeConnection(connId);
                     dispatchToUI(NodeEditorCommands::UI::ShowConnectionRemoved, connUuid);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID connUuid = std::any_cast<UUID>(data);
+                } else if (UUID connUuid; commandUuid(data, connUuid)) {
                     removeConnectionByUUID(connUuid);
                     dispatchToUI(NodeEditorCommands::UI::ShowConnectionRemoved, connUuid);
                 }
@@ -570,8 +591,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int connId = std::any_cast<int>(data);
                     deactivateConnectionFlow(connId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID connUuid = std::any_cast<UUID>(data);
+                } else if (UUID connUuid; commandUuid(data, connUuid)) {
                     int connId = getConnectionId(connUuid);
                     if (connId >= 0) {
                         deactivateConnectionFlow(connId);
@@ -588,8 +608,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int connectionId = std::any_cast<int>(data);
                     selectConnection(connectionId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID connectionUuid = std::any_cast<UUID>(data);
+                } else if (UUID connectionUuid; commandUuid(data, connectionUuid)) {
                     selectConnectionByUUID(connectionUuid);
                 }
             } catch (const std::bad_any_cast &) {
@@ -603,8 +622,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int connectionId = std::any_cast<int>(data);
                     deselectConnection(connectionId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID connectionUuid = std::any_cast<UUID>(data);
+                } else if (UUID connectionUuid; commandUuid(data, connectionUuid)) {
                     deselectConnectionByUUID(connectionUuid);
                 }
             } catch (const std::bad_any_cast &) {
@@ -668,8 +686,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int groupId = std::any_cast<int>(data);
                     removeGroup(groupId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID groupUuid = std::any_cast<UUID>(data);
+                } else if (UUID groupUuid; commandUuid(data, groupUuid)) {
                     removeGroupByUUID(groupUuid);
                 }
             } catch (const std::bad_any_cast &) {
@@ -723,8 +740,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int nodeId = std::any_cast<int>(data);
                     centerOnNode(nodeId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID nodeUuid = std::any_cast<UUID>(data);
+                } else if (UUID nodeUuid; commandUuid(data, nodeUuid)) {
                     centerOnNodeByUUID(nodeUuid);
                 }
             } catch (const std::bad_any_cast &) {
@@ -849,8 +865,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int subgraphId = std::any_cast<int>(data);
                     removeSubgraph(subgraphId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID subgraphUuid = std::any_cast<UUID>(data);
+                } else if (UUID subgraphUuid; commandUuid(data, subgraphUuid)) {
                     int subgraphId = getSubgraphId(subgraphUuid);
                     if (subgraphId != -1) {
                         removeSubgraph(subgraphId);
@@ -867,8 +882,7 @@ namespace NodeEditorCore {
                 if (data.type() == typeid(int)) {
                     int subgraphId = std::any_cast<int>(data);
                     enterSubgraph(subgraphId);
-                } else if (data.type() == typeid(UUID)) {
-                    UUID subgraphUuid = std::any_cast<UUID>(data);
+                } else if (UUID subgraphUuid; commandUuid(data, subgraphUuid)) {
                     enterSubgraphByUUID(subgraphUuid);
                 }
             } catch (const std::bad_any_cast &) {
@@ -4,13 +4,22 @@
 #include "Style/StyleDefinitions.h"
 #include "Types/CoreTypes.h"
 #include "../Editor/View/NodeBoundingBoxManager.h"
+#include "../Editor/View/ConnectionGeometryCache.h"
+#include "../Editor/View/CurveDistance.h"
+#include "../Editor/View/NodeGeometryStore.h"
+#include "../Editor/View/SpatialGrid.h"
 #include <functional>
 #include <stack>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <memory>
+#include <memory_resource>
 #include <any>
 #include <string>
+#include <cstdint>
+#include <cfloat>
+#include <span>
 
 #include "Style/ConnectionStyleManager.h"
 #include "../Editor/View/MinimapManager.h"
@@ -19,15 +28,51 @@
 #include "../Rendering/NodeEditorAnimationManager.h"
 #include "../Utils/CommandManager.h"
 #include "../Utils/CommandDefinitions.h"
+#include "../Utils/HandleAllocator.h"
+#include "../Utils/MemoryAccounting.h"
 
 namespace NodeEditorCore {
     enum class InteractionMode;
 
     struct NodeTypeInfo {
         std::string name;
-        std::string category;
+        Symbol category;
         std::string description;
         std::function<Node*(const Vec2&)> builder;
+        // Only builders whose output does not depend on position or outside state may opt into caching.
+        bool cachePrototype = false;
+        std::shared_ptr<const Node> prototype;
+    };
+
+    struct MemoryStats {
+        struct Category {
+            size_t count = 0;
+            size_t bytes = 0;
+        };
+
+        Category nodes;
+        Category pins;
+        Category connections;
+        Category reroutes;
+        Category groups;
+        Category subgraphs;
+        Category metadata;
+        Category uuidMaps;
+        Category graphIndices;
+        Category animationState;
+        Category commandLog;
+        Category displayIdCache;
+        // Shared by every editor in the process; node types, categories and metadata keys hold ids into it.
+        Category symbols;
+        // Heap blocks held by the graph pool, which backs pin and adjacency storage. Those categories
+        // already count what they use, so this only shows the pool's reservation and is not summed.
+        Category graphPool;
+
+        size_t totalBytes() const {
+            return nodes.bytes + pins.bytes + connections.bytes + reroutes.bytes + groups.bytes +
+                   subgraphs.bytes + metadata.bytes + uuidMaps.bytes + graphIndices.bytes +
+                   animationState.bytes + commandLog.bytes + displayIdCache.bytes + symbols.bytes;
+        }
     };
 
     using NodeCallback = std::function<void(int nodeId, const UUID& nodeUuid)>;
@@ -80,9 +125,10 @@ namespace NodeEditorCore {
 
         void beginFrame();
         void render();
+        void renderCanvas(ImDrawList* drawList, const ImVec2& canvasPos, const ImVec2& canvasSize);
         void endFrame();
 
-        int addNode(const std::string& name, const std::string& type, const Vec2& pos, const UUID& uuid = "");
+        int addNode(const std::string& name, const std::string& type, const Vec2& pos, const UUID& uuid = UUID());
         UUID addNodeWithUUID(const std::string& name, const std::string& type, const Vec2& position);
         void removeNode(int nodeId);
         void removeNodeByUUID(const UUID& uuid);
@@ -92,27 +138,41 @@ namespace NodeEditorCore {
         const Node* getNode(int nodeId) const;
         const Node* getNodeByUUID(const UUID& uuid) const;
         const std::vector<Node>& getNodes() const;
+        void setNodePosition(int nodeId, const Vec2& position);
+        void setNodeSize(int nodeId, const Vec2& size);
+
+        Handle getNodeHandle(int nodeId) const;
+        bool isNodeHandleValid(const Handle& handle) const;
+        Node* getNode(const Handle& handle);
 
         UUID getNodeUUID(int nodeId) const;
         int getNodeId(const UUID& uuid) const;
 
+        void beginBatch(size_t nodeCapacity = 0, size_t connectionCapacity = 0);
+        void endBatch();
+        bool isBatching() const;
+
         void updateNodeBoundingBoxes();
         void enableNodeAvoidance(bool enable);
         bool isNodeAvoidanceEnabled() const;
 
         int addPin(int nodeId, const std::string& name, bool isInput, PinType type = PinType::Blue,
-                  PinShape shape = PinShape::Circle, const UUID& uuid = "");
+                  PinShape shape = PinShape::Circle, const UUID& uuid = UUID());
         int addPinByNodeUUID(const UUID& nodeUuid, const std::string& name, bool isInput,
-                            PinType type = PinType::Blue, PinShape shape = PinShape::Circle, const UUID& uuid = "");
+                            PinType type = PinType::Blue, PinShape shape = PinShape::Circle, const UUID& uuid = UUID());
         UUID addPinWithUUID(int nodeId, const std::string& name, bool isInput, PinType type = PinType::Blue,
                           PinShape shape = PinShape::Circle);
         UUID addPinWithUUIDByNodeUUID(const UUID& nodeUuid, const std::string& name, bool isInput,
                                      PinType type = PinType::Blue, PinShape shape = PinShape::Circle);
+        void reservePins(int nodeId, size_t inputCount, size_t outputCount);
 
         void removePin(int nodeId, int pinId);
         void removePinByUUID(const UUID& nodeUuid, const UUID& pinUuid);
 
-        void loadGraphState(const SerializedState &state);
+        // Nodes and connections whose ids are duplicated or out of range are given fresh ids and every
+        // reference to them is rewritten. Returns how many connections were dropped because an endpoint
+        // node is missing.
+        size_t loadGraphState(const SerializedState &state);
 
         void updateNextIds();
 
@@ -124,9 +184,9 @@ namespace NodeEditorCore {
         const Pin* getPinByUUID(const UUID& nodeUuid, const UUID& pinUuid) const;
         UUID getPinUUID(int nodeId, int pinId) const;
 
-        int addConnection(int startNodeId, int startPinId, int endNodeId, int endPinId, const UUID& uuid = "");
+        int addConnection(int startNodeId, int startPinId, int endNodeId, int endPinId, const UUID& uuid = UUID());
         int addConnectionByUUID(const UUID& startNodeUuid, const UUID& startPinUuid,
-                              const UUID& endNodeUuid, const UUID& endPinUuid, const UUID& uuid = "");
+                              const UUID& endNodeUuid, const UUID& endPinUuid, const UUID& uuid = UUID());
         UUID addConnectionWithUUID(int startNodeId, int startPinId, int endNodeId, int endPinId);
         UUID addConnectionWithUUIDByUUID(const UUID& startNodeUuid, const UUID& startPinUuid,
                                       const UUID& endNodeUuid, const UUID& endPinUuid);
@@ -140,13 +200,16 @@ namespace NodeEditorCore {
         const Connection* getConnectionByUUID(const UUID& uuid) const;
         const std::vector<Connection>& getConnections() const;
 
+        Handle getConnectionHandle(int connectionId) const;
+        bool isConnectionHandleValid(const Handle& handle) const;
+
         UUID getConnectionUUID(int connectionId) const;
         int getConnectionId(const UUID& uuid) const;
 
         bool isConnected(int nodeId, int pinId) const;
         bool isConnectedByUUID(const UUID& nodeUuid, const UUID& pinUuid) const;
 
-        int addGroup(const std::string& name, const Vec2& pos, const Vec2& size, const UUID& uuid = "");
+        int addGroup(const std::string& name, const Vec2& pos, const Vec2& size, const UUID& uuid = UUID());
         UUID addGroupWithUUID(const std::string& name, const Vec2& position, const Vec2& size);
         void removeGroup(int groupId);
         void removeGroupByUUID(const UUID& uuid);
@@ -154,6 +217,7 @@ namespace NodeEditorCore {
         Group* getGroup(int groupId);
         Group* getGroupByUUID(const UUID& uuid);
         const Group* getGroup(int groupId) const;
+        const std::vector<Group>& getGroups() const;
 
         UUID getGroupUUID(int groupId) const;
         int getGroupId(const UUID& uuid) const;
@@ -183,6 +247,15 @@ namespace NodeEditorCore {
         void centerOnNodeWithSize(int nodeId, float windowWidth, float windowHeight);
 
         void setStyle(const NodeEditorStyle& style);
+        const NodeEditorStyle& getStyle() const;
+
+        enum class DetailLevel {
+            Full,
+            Simplified,
+            Minimal
+        };
+
+        DetailLevel getDetailLevel() const;
 
         void setNodeCreatedCallback(NodeCallback callback);
         void setNodeRemovedCallback(NodeCallback callback);
@@ -193,6 +266,9 @@ namespace NodeEditorCore {
         Vec2 screenToCanvas(const Vec2& pos) const;
         Vec2 canvasToScreen(const Vec2& pos) const;
 
+        void updateHoverState(const Vec2& mousePos, const Vec2& canvasPos);
+        std::vector<int> getNodesInViewport(const Vec2& screenMin, const Vec2& screenMax);
+        std::vector<int> getConnectionsInViewport(const Vec2& screenMin, const Vec2& screenMax);
         int getHoveredNodeId() const;
         UUID getHoveredNodeUUID() const;
         int getHoveredPinId() const;
@@ -209,18 +285,19 @@ namespace NodeEditorCore {
         void deselectAllConnections();
 
         void registerNodeType(const std::string& type, const std::string& category, const std::string& description,
-                            std::function<Node*(const Vec2&)> builder);
+                            std::function<Node*(const Vec2&)> builder, bool cachePrototype = false);
         Node* createNodeOfType(const std::string& type, const Vec2& position);
 
-        int createSubgraph(const std::string& name, const UUID& uuid = "");
+        int createSubgraph(const std::string& name, const UUID& uuid = UUID());
 
         void updateAllSubgraphs();
 
-        int createSubgraph(const std::string &name, const UUID &uuid = "", bool createDefaultNodes = true);
+        int createSubgraph(const std::string &name, const UUID &uuid = UUID(), bool createDefaultNodes = true);
         UUID createSubgraphWithUUID(const std::string& name);
 
         Subgraph *getSubgraph(int subgraphId);
         const Subgraph* getSubgraph(int subgraphId) const;
+        const std::map<int, std::shared_ptr<Subgraph>>& getSubgraphs() const;
 
         Subgraph* getSubgraphByUUID(const UUID& uuid);
 
@@ -300,7 +377,7 @@ namespace NodeEditorCore {
         bool enterSubgraphByUUID(const UUID& uuid);
         bool exitSubgraph();
 
-        Node* createSubgraphNode(int subgraphId, const std::string& name, const Vec2& position, const UUID& uuid = "");
+        Node* createSubgraphNode(int subgraphId, const std::string& name, const Vec2& position, const UUID& uuid = UUID());
 
         bool isNodeInCurrentSubgraph(const Node& node) const;
         bool isSubgraphContainer(const Node& node) const;
@@ -320,9 +397,12 @@ namespace NodeEditorCore {
 
         void setDebugMode(bool enable) { m_debugMode = enable; }
         bool isDebugMode() const { return m_debugMode; }
+        MemoryStats getMemoryStats() const;
 
         std::vector<int> getEvaluationOrder() const;
         std::vector<UUID> getEvaluationOrderUUIDs() const;
+        const NodeEvaluator::EvaluationPlan& getEvaluationPlan() const;
+        uint64_t getGraphVersion() const;
         std::vector<NodeEvaluator::ConnectionInfo> getInputConnections(int nodeId);
         std::vector<NodeEvaluator::ConnectionInfo> getInputConnectionsByUUID(const UUID& nodeUuid);
         std::vector<NodeEvaluator::ConnectionInfo> getOutputConnections(int nodeId);
@@ -414,20 +494,27 @@ namespace NodeEditorCore {
         }
 
     private:
+        template<typename K, typename V, typename H = std::hash<K>>
+        using PooledMap = std::pmr::unordered_map<K, V, H>;
+
         struct State {
             std::vector<Node> nodes;
-            UUIDMap<Node*> nodeUuidMap;
+            HandleAllocator nodeHandles;
+            PooledMap<UUID, size_t, UUIDHash> nodeUuidMap;
             std::vector<Connection> connections;
-            UUIDMap<Connection*> connectionUuidMap;
+            HandleAllocator connectionHandles;
+            PooledMap<UUID, size_t, UUIDHash> connectionUuidMap;
+            PooledMap<int, std::pmr::vector<int>> nodeInputConnections;
+            PooledMap<int, std::pmr::vector<int>> nodeOutputConnections;
+            PooledMap<uint64_t, std::pmr::vector<int>> pinConnections;
             std::vector<Group> groups;
-            UUIDMap<Group*> groupUuidMap;
+            PooledMap<int, size_t> groupIndexMap;
+            PooledMap<UUID, size_t, UUIDHash> groupUuidMap;
 
             Vec2 viewPosition;
             float viewScale;
 
-            int nextNodeId;
             int nextPinId;
-            int nextConnectionId;
             int nextGroupId;
 
             int hoveredNodeId;
@@ -460,8 +547,8 @@ namespace NodeEditorCore {
 
             int magnetPinNodeId = -1;
             int magnetPinId = -1;
-            UUID magnetPinNodeUuid = "";
-            UUID magnetPinUuid = "";
+            UUID magnetPinNodeUuid;
+            UUID magnetPinUuid;
             float magnetThreshold = 20.0f;
             bool canConnectToMagnetPin = true;
 
@@ -473,6 +560,12 @@ namespace NodeEditorCore {
             ConnectionCallback connectionRemovedCallback;
             CanConnectCallback canConnectCallback;
 
+            uint64_t graphVersion = 0;
+            int batchDepth = 0;
+            bool pinStatesDirty = false;
+            std::vector<int> pendingCreatedNodes;
+            std::vector<int> pendingCreatedConnections;
+
             int currentSubgraphId;
             UUID currentSubgraphUuid;
 
@@ -491,7 +584,7 @@ namespace NodeEditorCore {
 
             std::unordered_map<int, Vec2> draggedNodePositions;
 
-            State();
+            explicit State(std::pmr::memory_resource *resource);
         };
 
         struct ConnectionInfo {
@@ -503,8 +596,12 @@ namespace NodeEditorCore {
             UUID endNodeUuid;
         };
 
+        MemoryAccounting::CountingResource m_graphUpstream;
+        std::pmr::unsynchronized_pool_resource m_graphPool{&m_graphUpstream};
         State m_state;
         bool m_debugMode;
+        mutable NodeEvaluator::EvaluationPlan m_evaluationPlan;
+        mutable uint64_t m_evaluationPlanCompiles = 0;
         std::stack<int> m_subgraphStack;
         std::stack<UUID> m_subgraphUuidStack;
         std::map<int, std::shared_ptr<Subgraph>> m_subgraphs;
@@ -521,11 +618,34 @@ namespace NodeEditorCore {
         ConnectionStyleManager m_connectionStyleManager;
         std::unordered_map<int, Color> m_depthColors;
         std::shared_ptr<NodeBoundingBoxManager> m_nodeBoundingBoxManager;
+        NodeGeometryStore m_nodeGeometry;
+        uint64_t m_nodeGeometryVersion = UINT64_MAX;
+        bool m_nodeGeometryFrameSynced = false;
+        std::vector<uint32_t> m_nodeIndexScratch;
+        std::vector<uint8_t> m_nodeMaskScratch;
+        SpatialGrid m_nodeSpatialIndex;
+        SpatialGrid m_connectionSpatialIndex;
+        SpatialGrid m_rerouteSpatialIndex;
+        uint64_t m_spatialIndexVersion = UINT64_MAX;
+        float m_spatialIndexTension = -1.0f;
+        float m_spatialIndexPinRadius = -1.0f;
+        std::vector<uint32_t> m_connectionIndexScratch;
+        std::vector<uint32_t> m_rerouteIndexScratch;
+        CubicBatch m_cubicBatchScratch;
+        std::vector<std::pair<uint32_t, uint32_t> > m_cubicOwnerScratch;
+        std::vector<float> m_cubicDistanceScratch;
+        mutable ConnectionGeometryCache m_connectionGeometry;
+        mutable ConnectionGeometryCache::Geometry m_connectionBoundsScratch;
+        std::vector<ImVec2> m_connectionPointScratch;
+        Vec2 m_cullMin = Vec2(-FLT_MAX, -FLT_MAX);
+        Vec2 m_cullMax = Vec2(FLT_MAX, FLT_MAX);
         AnimationManager m_animationManager;
         bool m_nodeAvoidanceEnabled;
         bool m_isSynchronizing = false;
 
         std::vector<Reroute> m_reroutes;
+        mutable std::vector<uint32_t> m_rerouteOrder;
+        mutable bool m_rerouteOrderDirty = true;
         RerouteStyle m_rerouteStyle;
         int m_nextRerouteId = 1;
         int m_hoveredRerouteId = -1;
@@ -544,6 +664,13 @@ namespace NodeEditorCore {
         void drawGrid(ImDrawList* drawList, const ImVec2& canvasPos);
         void drawConnections(ImDrawList* drawList, const ImVec2& canvasPos);
         void drawNodes(ImDrawList* drawList, const ImVec2& canvasPos);
+        struct NodePalette {
+            ImU32 base, header, accent, border, selected, hovered, glow;
+        };
+
+        NodePalette resolveNodePalette(const Node& node, bool isInputNode, bool isOutputNode) const;
+        void drawReducedNode(ImDrawList* drawList, const Node& node, const ImVec2& nodePos, const ImVec2& nodeSize,
+                             DetailLevel detail, bool isInputNode, bool isOutputNode);
 
         bool isNodeSelectableForDelete(int nodeId) const;
 
@@ -555,11 +682,11 @@ namespace NodeEditorCore {
                         ImU32 borderColor, float borderThickness = 1.0f, bool isHovered = false);
         void drawDragConnection(ImDrawList* drawList, const ImVec2& canvasPos);
         void drawDebugHitboxes(ImDrawList* drawList, const ImVec2& canvasPos);
+        void drawMemoryStatsOverlay(ImDrawList* drawList, const ImVec2& canvasPos);
         void drawContextMenu(ImDrawList* drawList);
         std::string pinTypeToString(PinType type) const;
         ImVec2 getPinPos(const Node& node, const Pin& pin, const ImVec2& canvasPos) const;
-        bool isPinHovered(const Node& node, const Pin& pin, const ImVec2& canvasPos);
-        bool isConnectionHovered(const Connection& connection, const ImVec2& canvasPos);
+        bool isPinHovered(const Node& node, const Pin& pin, const ImVec2& mousePos, const ImVec2& canvasPos);
         bool doesConnectionExist(int startNodeId, int startPinId, int endNodeId, int endPinId) const;
         bool doesConnectionExistByUUID(const UUID& startNodeUuid, const UUID& startPinUuid,
                                      const UUID& endNodeUuid, const UUID& endPinUuid) const;
@@ -582,7 +709,7 @@ namespace NodeEditorCore {
         void startBoxSelect(const ImVec2& mousePos);
         void startPanCanvas();
         void endCurrentInteraction();
-        void updateHoveredElements(const ImVec2& mousePos);
+        void updateHoveredElements(const ImVec2& mousePos, const ImVec2& canvasPos);
         void updateCurrentInteraction(const ImVec2& mousePos);
         void processGroupDragging();
         void processGroupResize();
@@ -592,24 +719,56 @@ namespace NodeEditorCore {
         void duplicateNode(int nodeId);
         std::string getInteractionModeName() const;
 
-        void updateNodeUuidMap();
-        void updateConnectionUuidMap();
-        void updateGroupUuidMap();
+        void syncNodeGeometry();
+        const NodeGeometryStore& nodeGeometry();
+        bool nodeGeometryCurrent() const;
+        void writeNodeGeometry(size_t index);
+        void updateSpatialIndex();
+        void ensureSpatialIndex();
+        float rerouteSpatialRadius() const;
+        std::span<const uint32_t> rerouteIndicesForConnection(int connectionId) const;
+        int findRerouteIndexAtPosition(const ImVec2& mousePos, RerouteHitZone& hitZone) const;
+        int findConnectionWithin(const Vec2& canvasPoint, float threshold, int& segment);
+        bool buildConnectionPath(const Connection& connection, ConnectionGeometryCache::Geometry& geometry) const;
+        ConnectionGeometryCache::Shape connectionShape() const;
+        const ConnectionGeometryCache::Geometry* connectionGeometry(const Connection& connection, bool flattened = true) const;
+        void nodeSpatialBounds(size_t index, Vec2& min, Vec2& max) const;
+        bool connectionSpatialBounds(const Connection& connection, Vec2& min, Vec2& max) const;
+        bool pinCanvasPosition(const Node& node, int pinId, Vec2& position) const;
+
+        static constexpr float kPinMargin = 20.0f;
+        static constexpr float kPinSpacing = 25.0f;
+        static constexpr float pinSlotOffset(float slot) { return kPinMargin + slot * kPinSpacing; }
+        void setCullRect(const Vec2& screenMin, const Vec2& screenMax);
+        void collectVisibleNodes(const Vec2& min, const Vec2& max, std::vector<uint32_t>& indices) const;
+        void collectVisibleConnections(const Vec2& min, const Vec2& max, std::vector<uint32_t>& indices) const;
+
+        std::unordered_map<int, int> updateNodeUuidMap();
+        int resolveLoadedNodeId(int nodeId, const UUID& nodeUuid, const std::unordered_map<int, int>& nodeIdRemap) const;
+        size_t updateConnectionUuidMap(const std::unordered_map<int, int>& nodeIdRemap,
+                                       std::unordered_map<int, int>& connectionIdRemap);
+        void updateGroupUuidMap(const std::unordered_map<int, int>& nodeIdRemap);
+        void reindexNodes(size_t first);
+        void reindexConnections(size_t first);
+        void reindexGroups(size_t first);
+
+        static uint64_t makePinKey(int nodeId, int pinId);
+        void linkConnection(const Connection &connection);
+        void unlinkConnection(const Connection &connection);
+        // Ids are recycled, so every side table keyed by id has to forget it before the handle is released.
+        void purgeNodeReferences(int nodeId, const UUID &nodeUuid);
+        void purgeConnectionReferences(int connectionId);
+        void rebuildConnectionAdjacency();
+        bool hasPinConnections(int nodeId, int pinId) const;
 
         void setupBackendCommands();
         void setupUICommands();
         void handleErrors(const std::string& command, const std::any& data);
 
-        std::vector<Connection> getVisibleConnections() const;
         void drawSingleConnection(ImDrawList *drawList, const Connection &connection, const ImVec2 &canvasPos);
+        void drawReducedConnection(ImDrawList *drawList, const Connection &connection, DetailLevel detail);
         Color getPinConnectionColor(const Pin &pin) const;
-        void drawConnectionLine(ImDrawList *drawList, const ImVec2 &p1, const ImVec2 &p2, const Connection &connection, const Pin &startPin, const Pin &endPin, const Color &startCol, const Color &endCol);
-        void drawConnectionAnimation(ImDrawList *drawList, const ImVec2 &p1, const ImVec2 &p2, const Connection &connection, const Pin &startPin, const Pin &endPin, const Color &startCol, const Color &endCol);
-        std::vector<ImVec2> calculateAnimationPath(const ImVec2 &p1, const ImVec2 &p2, const Pin &startPin, const Pin &endPin, const ConnectionAnimationState &animState) const;
-        std::vector<ImVec2> calculateBezierAnimationPath(const ImVec2 &p1, const ImVec2 &p2, const Pin &startPin, const Pin &endPin, const ConnectionAnimationState &animState, int particleCount) const;
-        std::vector<ImVec2> calculateStraightAnimationPath(const ImVec2 &p1, const ImVec2 &p2, const ConnectionAnimationState &animState, int particleCount) const;
-        std::vector<ImVec2> calculateAngleAnimationPath(const ImVec2 &p1, const ImVec2 &p2, const ConnectionAnimationState &animState, int particleCount) const;
-        std::vector<ImVec2> calculateMetroAnimationPath(const ImVec2 &p1, const ImVec2 &p2, const ConnectionAnimationState &animState, int particleCount) const;
+        void drawConnectionAnimation(ImDrawList *drawList, const Connection &connection, const ConnectionGeometryCache::Geometry &geometry, const Color &startCol, const Color &endCol);
 
         void drawConnectionWithReroutes(ImDrawList *drawList, const ImVec2 &p1, const ImVec2 &p2,
                                         const Connection &connection,
@@ -622,14 +781,10 @@ namespace NodeEditorCore {
         void drawSingleReroute(ImDrawList* drawList, const Reroute& reroute, const ImVec2& canvasPos);
         void drawRerouteDebugInfo(ImDrawList* drawList, const ImVec2& canvasPos);
         void startRerouteConnection(int rerouteId, const ImVec2& mousePos);
-        std::vector<ImVec2> getConnectionPathWithReroutes(const Connection& connection, const ImVec2& p1, const ImVec2& p2) const;
         std::vector<ImVec2> getConnectionPathWithReroutesForDetection(const Connection& connection, const ImVec2& canvasPos) const;
-        void drawConnectionWithReroutes(ImDrawList* drawList, const Connection& connection,
-                                      const ImVec2& p1, const ImVec2& p2,
-                                      const Color& startCol, const Color& endCol);
-        void updateConnectionAnimationWithReroutes(const Connection& connection, const ImVec2& p1, const ImVec2& p2,
-                                                  const ConnectionAnimationState& animState,
-                                                  std::vector<ImVec2>& particlePoints) const;
+        void drawConnectionSegments(ImDrawList* drawList, const Connection& connection,
+                                    const ConnectionGeometryCache::Geometry& geometry,
+                                    const Color& startCol, const Color& endCol);
 
     };
 }
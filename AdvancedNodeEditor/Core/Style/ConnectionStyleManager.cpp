@@ -169,6 +169,87 @@ namespace NodeEditorCore {
         drawList->AddCircleFilled(end, endpointRadius, endColor);
     }
 
+    void ConnectionStyleManager::drawConnectionPath(
+        ImDrawList *drawList, const ImVec2 *points, int pointCount,
+        bool selected, bool hovered, const Color &startCol, const Color &endCol, float scale) {
+        if (pointCount < 2) return;
+
+        const float thickness = m_config.thickness * scale;
+
+        ImU32 startColor = ImColor(startCol.r, startCol.g, startCol.b, startCol.a);
+        ImU32 endColor = ImColor(endCol.r, endCol.g, endCol.b, endCol.a);
+
+        if (selected) {
+            startColor = ImColor(m_config.selectedColor.r, m_config.selectedColor.g,
+                                 m_config.selectedColor.b, m_config.selectedColor.a);
+            endColor = startColor;
+        } else if (hovered) {
+            startColor = ImColor(m_config.hoveredColor.r, m_config.hoveredColor.g,
+                                 m_config.hoveredColor.b, m_config.hoveredColor.a);
+            endColor = startColor;
+        }
+
+        const bool highlight = m_config.drawHighlight && (selected || hovered);
+        const ImU32 highlightColor = IM_COL32(255, 255, 255, 100);
+
+        if (m_config.drawShadow) {
+            m_pointScratch.resize(pointCount);
+            for (int i = 0; i < pointCount; i++) {
+                m_pointScratch[i] = ImVec2(points[i].x + 3, points[i].y + 3);
+            }
+            drawList->AddPolyline(m_pointScratch.data(), pointCount, IM_COL32(0, 0, 0, 40),
+                                  ImDrawFlags_None, thickness);
+        }
+
+        if (!m_config.useGradient || startColor == endColor) {
+            drawList->AddPolyline(points, pointCount, startColor, ImDrawFlags_None, thickness);
+
+            if (highlight) {
+                drawList->AddPolyline(points, pointCount, highlightColor, ImDrawFlags_None, thickness * 0.5f);
+            }
+        } else {
+            const int edges = pointCount - 1;
+            const int bands = std::min(20, edges);
+
+            for (int i = 0; i < bands; i++) {
+                const int first = edges * i / bands;
+                const int last = edges * (i + 1) / bands;
+
+                float tMid = (static_cast<float>(first) + static_cast<float>(last)) * 0.5f / edges;
+                ImU32 bandColor = ImLerpColor(startColor, endColor, tMid);
+
+                drawList->AddPolyline(points + first, last - first + 1, bandColor, ImDrawFlags_None, thickness);
+
+                if (highlight) {
+                    drawList->AddPolyline(points + first, last - first + 1, highlightColor, ImDrawFlags_None,
+                                          thickness * 0.5f);
+                }
+            }
+        }
+
+        float endpointRadius = thickness * 0.8f;
+        drawList->AddCircleFilled(points[0], endpointRadius, startColor);
+        drawList->AddCircleFilled(points[pointCount - 1], endpointRadius, endColor);
+    }
+
+    void ConnectionStyleManager::drawSimplifiedPath(
+        ImDrawList *drawList, const ImVec2 *points, int pointCount,
+        bool selected, bool hovered, const Color &startCol, const Color &endCol, float scale) {
+        if (pointCount < 2) return;
+
+        ImU32 color = ImLerpColor(ImColor(startCol.r, startCol.g, startCol.b, startCol.a),
+                                  ImColor(endCol.r, endCol.g, endCol.b, endCol.a), 0.5f);
+        if (selected) {
+            color = ImColor(m_config.selectedColor.r, m_config.selectedColor.g,
+                            m_config.selectedColor.b, m_config.selectedColor.a);
+        } else if (hovered) {
+            color = ImColor(m_config.hoveredColor.r, m_config.hoveredColor.g,
+                            m_config.hoveredColor.b, m_config.hoveredColor.a);
+        }
+
+        drawList->AddPolyline(points, pointCount, color, ImDrawFlags_None, std::max(m_config.thickness * scale, 1.0f));
+    }
+
     void ConnectionStyleManager::drawStraightConnection(
         ImDrawList *drawList, const ImVec2 &start, const ImVec2 &end,
         bool selected, bool hovered, const Color &startCol, const Color &endCol, float scale) {
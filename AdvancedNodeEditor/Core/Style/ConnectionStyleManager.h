@@ -7,6 +7,7 @@
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace NodeEditorCore {
     class NodeBoundingBoxManager;
@@ -76,6 +77,19 @@ namespace NodeEditorCore {
                             const Color &startCol, const Color &endCol,
                             float scale = 1.0f);
 
+        void drawConnectionPath(ImDrawList *drawList,
+                                const ImVec2 *points, int pointCount,
+                                bool selected, bool hovered,
+                                const Color &startCol, const Color &endCol,
+                                float scale = 1.0f);
+
+        // A single flat polyline with no shadow, gradient, highlight or endpoint caps.
+        void drawSimplifiedPath(ImDrawList *drawList,
+                                const ImVec2 *points, int pointCount,
+                                bool selected, bool hovered,
+                                const Color &startCol, const Color &endCol,
+                                float scale = 1.0f);
+
         void setBoundingBoxFunction(std::function<bool(ImVec2, ImVec2)> func);
 
         void setBoundingBoxManager(std::shared_ptr<NodeBoundingBoxManager> manager);
@@ -87,6 +101,7 @@ namespace NodeEditorCore {
                                                            float)> > m_customDrawers;
 
         std::function<bool(ImVec2, ImVec2)> m_boundingBoxCheck;
+        std::vector<ImVec2> m_pointScratch;
 
         void drawBezierConnection(ImDrawList *drawList, const ImVec2 &start, const ImVec2 &end,
                                   bool isStartInput, bool isEndInput,
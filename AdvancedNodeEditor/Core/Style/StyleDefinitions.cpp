@@ -18,7 +18,9 @@ namespace NodeEditorCore {
         : gridSpacing(16.0f)
           , nodeRounding(4.0f)
           , pinRadius(3.3f)
-          , connectionThickness(2.5f) {
+          , connectionThickness(2.5f)
+          , simplifiedDetailScale(0.5f)
+          , minimalDetailScale(0.25f) {
         uiColors.background = Color(0.15f, 0.15f, 0.17f, 1.00f);
         uiColors.grid = Color(0.23f, 0.23f, 0.26f, 0.314f);
         uiColors.selection = Color(0.70f, 0.80f, 1.00f, 0.392f);
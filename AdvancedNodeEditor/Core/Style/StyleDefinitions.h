@@ -94,6 +94,10 @@ namespace NodeEditorCore {
         float pinRadius;
         float connectionThickness;
 
+        // Below these view scales drawing drops to the simplified and minimal detail tiers.
+        float simplifiedDetailScale;
+        float minimalDetailScale;
+
         NodeEditorStyle();
     };
 }
@@ -8,17 +8,22 @@
 #include <map>
 #include <unordered_set>
 #include <any>
+#include <variant>
+#include <type_traits>
+#include <string_view>
 #include <algorithm>
 #include <memory>
+#include <memory_resource>
 #include <imgui.h>
 #include "../../Utils/UuidGenerator.h"
+#include "../../Utils/SymbolTable.h"
 
 namespace NodeEditorCore {
-    using UUID = std::string;
+    using UUID = Uuid;
 
     struct UUIDHash {
         std::size_t operator()(const UUID &uuid) const {
-            return std::hash<std::string>{}(uuid);
+            return std::hash<UUID>{}(uuid);
         }
     };
 
@@ -26,23 +31,34 @@ namespace NodeEditorCore {
     using UUIDMap = std::unordered_map<UUID, T, UUIDHash>;
 
     inline UUID generateUUID() {
-        return UuidGenerator::getInstance().generateV4().toString();
+        return UuidGenerator::getInstance().generate();
+    }
+
+    // Display ids live for the whole process. Nothing releases them automatically when a node or
+    // connection is removed; callers that map ids for transient UUIDs must call releaseDisplayId.
+    inline std::unordered_map<UUID, int> &displayIdCache() {
+        static std::unordered_map<UUID, int> cache;
+        return cache;
     }
 
     inline int uuidToDisplayId(const UUID &uuid) {
-        static std::unordered_map<UUID, int> displayIdCache;
         static int nextDisplayId = 1;
 
-        auto it = displayIdCache.find(uuid);
-        if (it != displayIdCache.end()) {
+        auto &cache = displayIdCache();
+        auto it = cache.find(uuid);
+        if (it != cache.end()) {
             return it->second;
         }
 
         int displayId = nextDisplayId++;
-        displayIdCache[uuid] = displayId;
+        cache[uuid] = displayId;
         return displayId;
     }
 
+    inline void releaseDisplayId(const UUID &uuid) {
+        displayIdCache().erase(uuid);
+    }
+
     struct Vec2 {
         float x, y;
 
@@ -110,33 +126,129 @@ namespace NodeEditorCore {
         Right
     };
 
-    struct Metadata {
-        std::map<std::string, std::any> attributes;
+    template<typename T>
+    class MetadataKey {
+    public:
+        MetadataKey() = default;
+
+        explicit MetadataKey(Symbol name) : m_name(name) {
+        }
+
+        Symbol name() const { return m_name; }
+
+    private:
+        Symbol m_name;
+    };
+
+    class Metadata {
+    public:
+        using Value = std::variant<std::monostate, bool, int, float, double, Vec2, UUID, std::string, std::any>;
+
+        template<typename T>
+        static MetadataKey<T> registerKey(std::string_view name) {
+            return MetadataKey<T>(Symbol(name));
+        }
+
+        template<typename T>
+        void setAttribute(const MetadataKey<T> &key, const T &value) {
+            store(key.name().id(), value);
+        }
+
+        template<typename T>
+        const T *findAttribute(const MetadataKey<T> &key) const {
+            return load<T>(key.name().id());
+        }
+
+        template<typename T>
+        T getAttribute(const MetadataKey<T> &key, const T &defaultValue = T()) const {
+            const T *value = load<T>(key.name().id());
+            return value ? *value : defaultValue;
+        }
 
         template<typename T>
         void setAttribute(const std::string &key, const T &value) {
-            attributes[key] = value;
+            if constexpr (std::is_array_v<T> || std::is_same_v<std::decay_t<T>, const char *>) {
+                store(Symbol(key).id(), std::string(value));
+            } else {
+                store(Symbol(key).id(), value);
+            }
         }
 
         template<typename T>
         T getAttribute(const std::string &key, const T &defaultValue = T()) const {
-            auto it = attributes.find(key);
-            if (it != attributes.end()) {
-                try {
-                    return std::any_cast<T>(it->second);
-                } catch (const std::bad_any_cast &) {
-                }
-            }
-            return defaultValue;
+            const T *value = load<T>(Symbol::find(key).id());
+            return value ? *value : defaultValue;
         }
 
         bool hasAttribute(const std::string &key) const {
-            return attributes.find(key) != attributes.end();
+            return find(Symbol::find(key).id()) != nullptr;
         }
 
         void removeAttribute(const std::string &key) {
-            attributes.erase(key);
+            uint32_t id = Symbol::find(key).id();
+            auto it = lowerBound(id);
+            if (id != 0 && it != m_entries.end() && it->key == id) {
+                m_entries.erase(it);
+            }
         }
+
+        size_t size() const { return m_entries.size(); }
+        bool empty() const { return m_entries.empty(); }
+        void clear() { m_entries.clear(); }
+        size_t memoryUsage() const { return m_entries.capacity() * sizeof(Entry); }
+
+    private:
+        struct Entry {
+            uint32_t key;
+            Value value;
+        };
+
+        template<typename T>
+        static constexpr bool isInline() {
+            return std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> ||
+                   std::is_same_v<T, double> || std::is_same_v<T, Vec2> || std::is_same_v<T, UUID> ||
+                   std::is_same_v<T, std::string>;
+        }
+
+        std::vector<Entry>::iterator lowerBound(uint32_t key) {
+            return std::lower_bound(m_entries.begin(), m_entries.end(), key,
+                                    [](const Entry &entry, uint32_t id) { return entry.key < id; });
+        }
+
+        const Value *find(uint32_t key) const {
+            if (key == 0) return nullptr;
+            auto it = std::lower_bound(m_entries.begin(), m_entries.end(), key,
+                                       [](const Entry &entry, uint32_t id) { return entry.key < id; });
+            return it != m_entries.end() && it->key == key ? &it->value : nullptr;
+        }
+
+        template<typename T>
+        void store(uint32_t key, const T &value) {
+            if (key == 0) return;
+            auto it = lowerBound(key);
+            if (it == m_entries.end() || it->key != key) {
+                it = m_entries.insert(it, Entry{key, Value()});
+            }
+            if constexpr (isInline<T>()) {
+                it->value.template emplace<T>(value);
+            } else {
+                it->value.template emplace<std::any>(value);
+            }
+        }
+
+        template<typename T>
+        const T *load(uint32_t key) const {
+            const Value *value = find(key);
+            if (!value) return nullptr;
+            if constexpr (isInline<T>()) {
+                return std::get_if<T>(value);
+            } else {
+                const std::any *boxed = std::get_if<std::any>(value);
+                return boxed ? std::any_cast<T>(boxed) : nullptr;
+            }
+        }
+
+        std::vector<Entry> m_entries;
     };
 
     enum class EventType {
@@ -335,11 +447,11 @@ namespace NodeEditorCore {
         int id;
         UUID uuid;
         std::string name;
-        std::string type;
+        Symbol type;
         Vec2 position;
         Vec2 size;
-        std::vector<Pin> inputs;
-        std::vector<Pin> outputs;
+        std::pmr::vector<Pin> inputs;
+        std::pmr::vector<Pin> outputs;
         bool selected;
         bool disabled;
         int groupId;
@@ -350,22 +462,33 @@ namespace NodeEditorCore {
         bool isSubgraph;
         int subgraphId;
         UUID subgraphUuid;
+        int parentSubgraphId = -1;
+        UUID parentSubgraphUuid;
         Metadata metadata;
         bool isProtected;
 
-        Node() : id(-1), uuid(generateUUID()), position(0.0f, 0.0f), size(140.0f, 28.0f),
-                 selected(false), disabled(false), groupId(-1), isTemplate(false), isCurrentFlag(false),
-                 labelPosition(NodeLabelPosition::Right), isSubgraph(false), subgraphId(-1), isProtected(false) {
+        Node() : Node(std::pmr::get_default_resource()) {
         }
 
-        Node(int id, const std::string &name, const std::string &type, const Vec2 &pos)
+        explicit Node(std::pmr::memory_resource *pinResource)
+            : id(-1), uuid(generateUUID()), position(0.0f, 0.0f), size(140.0f, 28.0f),
+              inputs(pinResource), outputs(pinResource),
+              selected(false), disabled(false), groupId(-1), isTemplate(false), isCurrentFlag(false),
+              labelPosition(NodeLabelPosition::Right), isSubgraph(false), subgraphId(-1), isProtected(false) {
+        }
+
+        Node(int id, const std::string &name, const std::string &type, const Vec2 &pos,
+             std::pmr::memory_resource *pinResource = std::pmr::get_default_resource())
             : id(id), uuid(generateUUID()), name(name), type(type), position(pos), size(140.0f, 28.0f),
+              inputs(pinResource), outputs(pinResource),
               selected(false), disabled(false), groupId(-1), isTemplate(false), isCurrentFlag(false),
               labelPosition(NodeLabelPosition::Right), isSubgraph(false), subgraphId(-1), isProtected(false) {
         }
 
-        Node(const UUID &existingUuid, int id, const std::string &name, const std::string &type, const Vec2 &pos)
+        Node(const UUID &existingUuid, int id, const std::string &name, const std::string &type, const Vec2 &pos,
+             std::pmr::memory_resource *pinResource = std::pmr::get_default_resource())
             : id(id), uuid(existingUuid), name(name), type(type), position(pos), size(140.0f, 28.0f),
+              inputs(pinResource), outputs(pinResource),
               selected(false), disabled(false), groupId(-1), isTemplate(false), isCurrentFlag(false),
               labelPosition(NodeLabelPosition::Right), isSubgraph(false), subgraphId(-1), isProtected(false) {
         }
@@ -416,11 +539,11 @@ namespace NodeEditorCore {
 
         void setSubgraphId(int id) {
             subgraphId = id;
-            metadata.setAttribute("subgraphId", id);
+            parentSubgraphId = id;
         }
 
         int getSubgraphId() const {
-            return metadata.getAttribute<int>("subgraphId", -1);
+            return parentSubgraphId;
         }
 
         void setIconSymbol(const std::string &symbol) {
@@ -443,7 +566,7 @@ namespace NodeEditorCore {
             isCurrentFlag = value;
         }
 
-        void setAsSubgraph(bool value, int id = -1, const UUID &uuid = "") {
+        void setAsSubgraph(bool value, int id = -1, const UUID &uuid = UUID()) {
             isSubgraph = value;
             subgraphId = id;
             subgraphUuid = uuid;
@@ -495,12 +618,10 @@ namespace NodeEditorCore {
 
         void setSubgraphId(int id) {
             subgraphId = id;
-            metadata.setAttribute("subgraphId", id);
         }
 
         int getSubgraphId() const {
-            if (subgraphId >= 0) return subgraphId;
-            return metadata.getAttribute<int>("subgraphId", -1);
+            return subgraphId;
         }
 
         template<typename T>
@@ -566,6 +687,7 @@ namespace NodeEditorCore {
         bool selected;
         Color color;
         GroupStyle style;
+        int subgraphId = -1;
         Metadata metadata;
 
         Group() : id(-1), uuid(generateUUID()), position(0.0f, 0.0f), size(200.0f, 150.0f),
@@ -586,11 +708,11 @@ namespace NodeEditorCore {
         }
 
         void setSubgraphId(int id) {
-            metadata.setAttribute("subgraphId", id);
+            subgraphId = id;
         }
 
         int getSubgraphId() const {
-            return metadata.getAttribute<int>("subgraphId", -1);
+            return subgraphId;
         }
 
         void setColor(const Color &newColor) {
@@ -626,8 +748,10 @@ namespace NodeEditorCore {
         std::vector<UUID> connectionUuids;
         std::vector<int> groupIds;
         std::vector<UUID> groupUuids;
-        std::vector<int> interfaceInputs;
-        std::vector<int> interfaceOutputs;
+        std::vector<uint64_t> interfaceInputs;
+        std::vector<uint64_t> interfaceOutputs;
+        int inputNodeId = -1;
+        int outputNodeId = -1;
         int parentSubgraphId;
         UUID parentSubgraphUuid;
         std::vector<int> childSubgraphIds;
@@ -670,7 +794,7 @@ namespace NodeEditorCore {
             accentColor = Color(0.4f, 0.6f, 0.8f, 1.0f);
         }
 
-        void addNode(int nodeId, const UUID &nodeUuid = "") {
+        void addNode(int nodeId, const UUID &nodeUuid = UUID()) {
             if (!containsNode(nodeId)) {
                 nodeIds.push_back(nodeId);
                 if (!nodeUuid.empty()) {
@@ -709,7 +833,7 @@ namespace NodeEditorCore {
             return std::find(nodeUuids.begin(), nodeUuids.end(), nodeUuid) != nodeUuids.end();
         }
 
-        void addConnection(int connectionId, const UUID &connectionUuid = "") {
+        void addConnection(int connectionId, const UUID &connectionUuid = UUID()) {
             if (!containsConnection(connectionId)) {
                 connectionIds.push_back(connectionId);
                 if (!connectionUuid.empty()) {
@@ -748,7 +872,7 @@ namespace NodeEditorCore {
             return std::find(connectionUuids.begin(), connectionUuids.end(), connectionUuid) != connectionUuids.end();
         }
 
-        void addGroup(int groupId, const UUID &groupUuid = "") {
+        void addGroup(int groupId, const UUID &groupUuid = UUID()) {
             if (!containsGroup(groupId)) {
                 groupIds.push_back(groupId);
                 if (!groupUuid.empty()) {
@@ -787,22 +911,26 @@ namespace NodeEditorCore {
             return std::find(groupUuids.begin(), groupUuids.end(), groupUuid) != groupUuids.end();
         }
 
+        static uint64_t makeInterfaceKey(int nodeId, int pinId) {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(nodeId)) << 32) | static_cast<uint32_t>(pinId);
+        }
+
         void exposeInput(int nodeId, int pinId) {
-            int interfaceId = (nodeId << 16) | pinId;
+            uint64_t interfaceId = makeInterfaceKey(nodeId, pinId);
             if (std::find(interfaceInputs.begin(), interfaceInputs.end(), interfaceId) == interfaceInputs.end()) {
                 interfaceInputs.push_back(interfaceId);
             }
         }
 
         void exposeOutput(int nodeId, int pinId) {
-            int interfaceId = (nodeId << 16) | pinId;
+            uint64_t interfaceId = makeInterfaceKey(nodeId, pinId);
             if (std::find(interfaceOutputs.begin(), interfaceOutputs.end(), interfaceId) == interfaceOutputs.end()) {
                 interfaceOutputs.push_back(interfaceId);
             }
         }
 
         void unexposeInput(int nodeId, int pinId) {
-            int interfaceId = (nodeId << 16) | pinId;
+            uint64_t interfaceId = makeInterfaceKey(nodeId, pinId);
             auto it = std::find(interfaceInputs.begin(), interfaceInputs.end(), interfaceId);
             if (it != interfaceInputs.end()) {
                 interfaceInputs.erase(it);
@@ -810,7 +938,7 @@ namespace NodeEditorCore {
         }
 
         void unexposeOutput(int nodeId, int pinId) {
-            int interfaceId = (nodeId << 16) | pinId;
+            uint64_t interfaceId = makeInterfaceKey(nodeId, pinId);
             auto it = std::find(interfaceOutputs.begin(), interfaceOutputs.end(), interfaceId);
             if (it != interfaceOutputs.end()) {
                 interfaceOutputs.erase(it);
@@ -818,16 +946,16 @@ namespace NodeEditorCore {
         }
 
         bool isInputExposed(int nodeId, int pinId) const {
-            int interfaceId = (nodeId << 16) | pinId;
+            uint64_t interfaceId = makeInterfaceKey(nodeId, pinId);
             return std::find(interfaceInputs.begin(), interfaceInputs.end(), interfaceId) != interfaceInputs.end();
         }
 
         bool isOutputExposed(int nodeId, int pinId) const {
-            int interfaceId = (nodeId << 16) | pinId;
+            uint64_t interfaceId = makeInterfaceKey(nodeId, pinId);
             return std::find(interfaceOutputs.begin(), interfaceOutputs.end(), interfaceId) != interfaceOutputs.end();
         }
 
-        void addChildSubgraph(int subgraphId, const UUID &subgraphUuid = "") {
+        void addChildSubgraph(int subgraphId, const UUID &subgraphUuid = UUID()) {
             if (!containsSubgraph(subgraphId)) {
                 childSubgraphIds.push_back(subgraphId);
                 if (!subgraphUuid.empty()) {
@@ -962,8 +1090,10 @@ namespace NodeEditorCore {
         Vec2 position;
         Vec2 size;
         bool isSubgraph;
-        int subgraphId;
+        int subgraphId = -1;
         UUID subgraphUuid;
+        int parentSubgraphId = -1;
+        UUID parentSubgraphUuid;
         std::vector<SerializedPin> inputs;
         std::vector<SerializedPin> outputs;
         Metadata metadata;
@@ -973,7 +1103,9 @@ namespace NodeEditorCore {
         SerializedNode(const Node &node)
             : id(node.id), uuid(node.uuid), name(node.name), type(node.type),
               position(node.position), size(node.size), isSubgraph(node.isSubgraph),
-              subgraphId(node.subgraphId), subgraphUuid(node.subgraphUuid), metadata(node.metadata) {
+              subgraphId(node.subgraphId), subgraphUuid(node.subgraphUuid),
+              parentSubgraphId(node.parentSubgraphId), parentSubgraphUuid(node.parentSubgraphUuid),
+              metadata(node.metadata) {
             for (const auto &pin: node.inputs) {
                 inputs.emplace_back(pin);
             }
@@ -994,6 +1126,7 @@ namespace NodeEditorCore {
         UUID endNodeUuid;
         int endPinId;
         UUID endPinUuid;
+        int subgraphId = -1;
         Metadata metadata;
 
         SerializedConnection() = default;
@@ -1002,7 +1135,7 @@ namespace NodeEditorCore {
             : id(conn.id), uuid(conn.uuid), startNodeId(conn.startNodeId), startNodeUuid(conn.startNodeUuid),
               startPinId(conn.startPinId), startPinUuid(conn.startPinUuid), endNodeId(conn.endNodeId),
               endNodeUuid(conn.endNodeUuid), endPinId(conn.endPinId), endPinUuid(conn.endPinUuid),
-              metadata(conn.metadata) {
+              subgraphId(conn.subgraphId), metadata(conn.metadata) {
         }
     };
 
@@ -1017,6 +1150,7 @@ namespace NodeEditorCore {
         bool collapsed;
         std::vector<int> nodeIds;
         std::vector<UUID> nodeUuids;
+        int subgraphId = -1;
         Metadata metadata;
 
         SerializedGroup() = default;
@@ -1024,7 +1158,7 @@ namespace NodeEditorCore {
         SerializedGroup(const Group &group)
             : id(group.id), uuid(group.uuid), name(group.name), position(group.position),
               size(group.size), color(group.color), style(group.style), collapsed(group.collapsed),
-              metadata(group.metadata) {
+              subgraphId(group.subgraphId), metadata(group.metadata) {
             nodeIds.assign(group.nodes.begin(), group.nodes.end());
             nodeUuids.assign(group.nodeUuids.begin(), group.nodeUuids.end());
         }
@@ -1040,9 +1174,11 @@ namespace NodeEditorCore {
         std::vector<UUID> connectionUuids;
         std::vector<int> groupIds;
         std::vector<UUID> groupUuids;
-        std::vector<int> interfaceInputs;
-        std::vector<int> interfaceOutputs;
-        int parentSubgraphId;
+        std::vector<uint64_t> interfaceInputs;
+        std::vector<uint64_t> interfaceOutputs;
+        int inputNodeId = -1;
+        int outputNodeId = -1;
+        int parentSubgraphId = -1;
         UUID parentSubgraphUuid;
         std::vector<int> childSubgraphIds;
         std::vector<UUID> childSubgraphUuids;
@@ -1063,6 +1199,7 @@ namespace NodeEditorCore {
               connectionIds(subgraph.connectionIds), connectionUuids(subgraph.connectionUuids),
               groupIds(subgraph.groupIds), groupUuids(subgraph.groupUuids),
               interfaceInputs(subgraph.interfaceInputs), interfaceOutputs(subgraph.interfaceOutputs),
+              inputNodeId(subgraph.inputNodeId), outputNodeId(subgraph.outputNodeId),
               parentSubgraphId(subgraph.parentSubgraphId), parentSubgraphUuid(subgraph.parentSubgraphUuid),
               childSubgraphIds(subgraph.childSubgraphIds), childSubgraphUuids(subgraph.childSubgraphUuids),
               viewPosition(subgraph.viewPosition), viewScale(subgraph.viewScale),
@@ -1,32 +1,17 @@
 #include "NodeEditorModel.h"
+#include "../../Core/NodeEditor.h"
 #include <algorithm>
+#include <utility>
 
 namespace NodeEditorCore {
     NodeEditorModel::NodeEditorModel()
-        : m_nextNodeId(1), m_nextPinId(1), m_nextConnectionId(1), m_nextGroupId(1), m_nextSubgraphId(1) {
+        : m_graph(std::make_shared<NodeEditor>()) {
     }
 
     NodeEditorModel::~NodeEditorModel() = default;
 
     int NodeEditorModel::addNode(const std::string &name, const std::string &type, const Vec2 &position) {
-        int nodeId = m_nextNodeId++;
-        auto node = std::make_shared<Node>();
-
-        node->id = nodeId;
-        node->name = name;
-        node->type = type;
-        node->position = position;
-        node->size = Vec2(140.0f, 28.0f);
-        node->selected = false;
-        node->disabled = false;
-        node->groupId = -1;
-        node->isTemplate = false;
-        node->isCurrentFlag = false;
-        node->labelPosition = NodeLabelPosition::Right;
-        node->isSubgraph = false;
-        node->subgraphId = -1;
-
-        m_nodes.push_back(node);
+        int nodeId = m_graph->addNode(name, type, position);
 
         Event event(EventType::NodeCreated);
         event.setData("nodeId", nodeId);
@@ -36,161 +21,50 @@ namespace NodeEditorCore {
     }
 
     void NodeEditorModel::removeNode(int nodeId) {
-        auto it = std::find_if(m_nodes.begin(), m_nodes.end(),
-                               [nodeId](const std::shared_ptr<Node> &node) { return node->id == nodeId; });
-
-        if (it != m_nodes.end()) {
-            m_connections.erase(
-                std::remove_if(m_connections.begin(), m_connections.end(),
-                               [nodeId](const std::shared_ptr<Connection> &conn) {
-                                   return conn->startNodeId == nodeId || conn->endNodeId == nodeId;
-                               }),
-                m_connections.end());
-
-            if ((*it)->groupId >= 0) {
-                auto groupIt = std::find_if(m_groups.begin(), m_groups.end(),
-                                            [groupId = (*it)->groupId](const std::shared_ptr<Group> &group) {
-                                                return group->id == groupId;
-                                            });
-                if (groupIt != m_groups.end()) {
-                    (*groupIt)->nodes.erase(nodeId);
-                }
-            }
+        if (!m_graph->getNode(nodeId)) return;
 
-            Event event(EventType::NodeRemoved);
-            event.setData("nodeId", nodeId);
-            dispatchEvent(event);
+        m_graph->removeNode(nodeId);
+        if (m_graph->getNode(nodeId)) return;
 
-            m_nodes.erase(it);
-        }
+        Event event(EventType::NodeRemoved);
+        event.setData("nodeId", nodeId);
+        dispatchEvent(event);
     }
 
     NodeEditorModel::Node *NodeEditorModel::getNode(int nodeId) {
-        auto it = std::find_if(m_nodes.begin(), m_nodes.end(),
-                               [nodeId](const std::shared_ptr<Node> &node) { return node->id == nodeId; });
-        return it != m_nodes.end() ? it->get() : nullptr;
+        return m_graph->getNode(nodeId);
     }
 
     const NodeEditorModel::Node *NodeEditorModel::getNode(int nodeId) const {
-        auto it = std::find_if(m_nodes.begin(), m_nodes.end(),
-                               [nodeId](const std::shared_ptr<Node> &node) { return node->id == nodeId; });
-        return it != m_nodes.end() ? it->get() : nullptr;
+        return std::as_const(*m_graph).getNode(nodeId);
     }
 
-    const std::vector<std::shared_ptr<NodeEditorModel::Node> > &NodeEditorModel::getNodes() const {
-        return m_nodes;
+    const std::vector<NodeEditorModel::Node> &NodeEditorModel::getNodes() const {
+        return m_graph->getNodes();
     }
 
     int NodeEditorModel::addPin(int nodeId, const std::string &name, bool isInput, PinType type, PinShape shape) {
-        Node *node = getNode(nodeId);
-        if (!node) return -1;
-
-        int pinId = m_nextPinId++;
-        Pin pin(pinId, name, isInput, type, shape);
-
-        pin.id = pinId;
-        pin.name = name;
-        pin.isInput = isInput;
-        pin.type = type;
-        pin.shape = shape;
-
-        if (isInput) {
-            node->inputs.push_back(pin);
-        } else {
-            node->outputs.push_back(pin);
-        }
-
-        return pinId;
+        return m_graph->addPin(nodeId, name, isInput, type, shape);
     }
 
     void NodeEditorModel::removePin(int nodeId, int pinId) {
-        Node *node = getNode(nodeId);
-        if (!node) return;
-
-        m_connections.erase(
-            std::remove_if(m_connections.begin(), m_connections.end(),
-                           [pinId](const std::shared_ptr<Connection> &conn) {
-                               return conn->startPinId == pinId || conn->endPinId == pinId;
-                           }),
-            m_connections.end());
-
-        auto removeFromVec = [pinId](std::vector<Pin> &pins) {
-            pins.erase(
-                std::remove_if(pins.begin(), pins.end(),
-                               [pinId](const Pin &pin) { return pin.id == pinId; }),
-                pins.end());
-        };
-
-        removeFromVec(node->inputs);
-        removeFromVec(node->outputs);
+        m_graph->removePin(nodeId, pinId);
     }
 
     Pin *NodeEditorModel::getPin(int nodeId, int pinId) {
-        Node *node = getNode(nodeId);
-        if (!node) return nullptr;
-
-        for (auto &pin: node->inputs) {
-            if (pin.id == pinId) return &pin;
-        }
-
-        for (auto &pin: node->outputs) {
-            if (pin.id == pinId) return &pin;
-        }
-
-        return nullptr;
+        return m_graph->getPin(nodeId, pinId);
     }
 
     const Pin *NodeEditorModel::getPin(int nodeId, int pinId) const {
-        const Node *node = getNode(nodeId);
-        if (!node) return nullptr;
-
-        for (const auto &pin: node->inputs) {
-            if (pin.id == pinId) return &pin;
-        }
-
-        for (const auto &pin: node->outputs) {
-            if (pin.id == pinId) return &pin;
-        }
-
-        return nullptr;
+        return std::as_const(*m_graph).getPin(nodeId, pinId);
     }
 
     int NodeEditorModel::addConnection(int startNodeId, int startPinId, int endNodeId, int endPinId) {
-        auto existingConnection = std::find_if(m_connections.begin(), m_connections.end(),
-                                               [=](const std::shared_ptr<Connection> &conn) {
-                                                   return conn->startNodeId == startNodeId &&
-                                                          conn->startPinId == startPinId &&
-                                                          conn->endNodeId == endNodeId &&
-                                                          conn->endPinId == endPinId;
-                                               });
-
-        if (existingConnection != m_connections.end()) {
+        int connectionId = m_graph->addConnection(startNodeId, startPinId, endNodeId, endPinId);
+        if (connectionId < 0) {
             return -1;
         }
 
-        const Pin *startPin = getPin(startNodeId, startPinId);
-        const Pin *endPin = getPin(endNodeId, endPinId);
-
-        if (!startPin || !endPin) {
-            return -1;
-        }
-
-        if (startPin->isInput || !endPin->isInput) {
-            return -1;
-        }
-
-        int connectionId = m_nextConnectionId++;
-        auto connection = std::make_shared<Connection>();
-
-        connection->id = connectionId;
-        connection->startNodeId = startNodeId;
-        connection->startPinId = startPinId;
-        connection->endNodeId = endNodeId;
-        connection->endPinId = endPinId;
-        connection->selected = false;
-
-        m_connections.push_back(connection);
-
         Event event(EventType::ConnectionCreated);
         event.setData("connectionId", connectionId);
         dispatchEvent(event);
@@ -199,60 +73,39 @@ namespace NodeEditorCore {
     }
 
     void NodeEditorModel::removeConnection(int connectionId) {
-        auto it = std::find_if(m_connections.begin(), m_connections.end(),
-                               [connectionId](const std::shared_ptr<Connection> &conn) {
-                                   return conn->id == connectionId;
-                               });
+        const Connection *connection = getConnection(connectionId);
 
-        if (it != m_connections.end()) {
+        if (connection) {
             Event event(EventType::ConnectionRemoved);
             event.setData("connectionId", connectionId);
-            event.setData("startNodeId", (*it)->startNodeId);
-            event.setData("startPinId", (*it)->startPinId);
-            event.setData("endNodeId", (*it)->endNodeId);
-            event.setData("endPinId", (*it)->endPinId);
+            event.setData("startNodeId", connection->startNodeId);
+            event.setData("startPinId", connection->startPinId);
+            event.setData("endNodeId", connection->endNodeId);
+            event.setData("endPinId", connection->endPinId);
             dispatchEvent(event);
 
-            m_connections.erase(it);
+            m_graph->removeConnection(connectionId);
         }
     }
 
     NodeEditorModel::Connection *NodeEditorModel::getConnection(int connectionId) {
-        auto it = std::find_if(m_connections.begin(), m_connections.end(),
-                               [connectionId](const std::shared_ptr<Connection> &conn) {
-                                   return conn->id == connectionId;
-                               });
-        return it != m_connections.end() ? it->get() : nullptr;
+        return m_graph->getConnection(connectionId);
     }
 
     const NodeEditorModel::Connection *NodeEditorModel::getConnection(int connectionId) const {
-        auto it = std::find_if(m_connections.begin(), m_connections.end(),
-                               [connectionId](const std::shared_ptr<Connection> &conn) {
-                                   return conn->id == connectionId;
-                               });
-        return it != m_connections.end() ? it->get() : nullptr;
+        return std::as_const(*m_graph).getConnection(connectionId);
     }
 
-    const std::vector<std::shared_ptr<NodeEditorModel::Connection> > &NodeEditorModel::getConnections() const {
-        return m_connections;
+    const std::vector<NodeEditorModel::Connection> &NodeEditorModel::getConnections() const {
+        return m_graph->getConnections();
     }
 
     bool NodeEditorModel::isConnected(int nodeId, int pinId) const {
-        return std::any_of(m_connections.begin(), m_connections.end(),
-                           [nodeId, pinId](const std::shared_ptr<Connection> &conn) {
-                               return (conn->startNodeId == nodeId && conn->startPinId == pinId) ||
-                                      (conn->endNodeId == nodeId && conn->endPinId == pinId);
-                           });
+        return m_graph->isConnected(nodeId, pinId);
     }
 
     int NodeEditorModel::addGroup(const std::string &name, const Vec2 &position, const Vec2 &size) {
-        int groupId = m_nextGroupId++;
-        auto group = std::make_shared<Group>(groupId, name, position, size);
-
-        group->position = position;
-        group->size = size;
-
-        m_groups.push_back(group);
+        int groupId = m_graph->addGroup(name, position, size);
 
         Event event(EventType::GroupCreated);
         event.setData("groupId", groupId);
@@ -262,103 +115,63 @@ namespace NodeEditorCore {
     }
 
     void NodeEditorModel::removeGroup(int groupId) {
-        auto it = std::find_if(m_groups.begin(), m_groups.end(),
-                               [groupId](const std::shared_ptr<Group> &group) { return group->id == groupId; });
-
-        if (it != m_groups.end()) {
-            for (int nodeId: (*it)->nodes) {
-                Node *node = getNode(nodeId);
-                if (node) {
-                    node->groupId = -1;
-                }
-            }
+        if (!getGroup(groupId)) return;
 
-            Event event(EventType::GroupRemoved);
-            event.setData("groupId", groupId);
-            dispatchEvent(event);
+        Event event(EventType::GroupRemoved);
+        event.setData("groupId", groupId);
+        dispatchEvent(event);
 
-            m_groups.erase(it);
-        }
+        m_graph->removeGroup(groupId);
     }
 
     Group *NodeEditorModel::getGroup(int groupId) {
-        auto it = std::find_if(m_groups.begin(), m_groups.end(),
-                               [groupId](const std::shared_ptr<Group> &group) { return group->id == groupId; });
-        return it != m_groups.end() ? it->get() : nullptr;
+        return m_graph->getGroup(groupId);
     }
 
     const Group *NodeEditorModel::getGroup(int groupId) const {
-        auto it = std::find_if(m_groups.begin(), m_groups.end(),
-                               [groupId](const std::shared_ptr<Group> &group) { return group->id == groupId; });
-        return it != m_groups.end() ? it->get() : nullptr;
+        return std::as_const(*m_graph).getGroup(groupId);
     }
 
-    const std::vector<std::shared_ptr<Group> > &NodeEditorModel::getGroups() const {
-        return m_groups;
+    const std::vector<Group> &NodeEditorModel::getGroups() const {
+        return m_graph->getGroups();
     }
 
     void NodeEditorModel::addNodeToGroup(int nodeId, int groupId) {
-        Group *group = getGroup(groupId);
-        Node *node = getNode(nodeId);
-
-        if (!group || !node) return;
-
-        if (node->groupId >= 0 && node->groupId != groupId) {
-            Group *oldGroup = getGroup(node->groupId);
-            if (oldGroup) {
-                oldGroup->nodes.erase(nodeId);
-            }
-        }
-
-        node->groupId = groupId;
-        group->nodes.insert(nodeId);
+        m_graph->addNodeToGroup(nodeId, groupId);
     }
 
     void NodeEditorModel::removeNodeFromGroup(int nodeId, int groupId) {
-        Group *group = getGroup(groupId);
-        Node *node = getNode(nodeId);
-
-        if (!group || !node || node->groupId != groupId) return;
-
-        node->groupId = -1;
-        group->nodes.erase(nodeId);
+        m_graph->removeNodeFromGroup(nodeId, groupId);
     }
 
     int NodeEditorModel::createSubgraph(const std::string &name) {
-        int subgraphId = m_nextSubgraphId++;
-        auto subgraph = std::make_shared<Subgraph>(subgraphId, name);
-
-        m_subgraphs[subgraphId] = subgraph;
-
-        return subgraphId;
+        return m_graph->createSubgraph(name, UUID(), false);
     }
 
     void NodeEditorModel::removeSubgraph(int subgraphId) {
-        auto it = m_subgraphs.find(subgraphId);
-        if (it != m_subgraphs.end()) {
-            for (auto &node: m_nodes) {
-                if (node->isSubgraph && node->subgraphId == subgraphId) {
-                    node->isSubgraph = false;
-                    node->subgraphId = -1;
-                }
-            }
+        if (!getSubgraph(subgraphId)) return;
 
-            m_subgraphs.erase(it);
+        for (const auto &node: m_graph->getNodes()) {
+            if (node.isSubgraph && node.subgraphId == subgraphId) {
+                Node *container = m_graph->getNode(node.id);
+                container->isSubgraph = false;
+                container->subgraphId = -1;
+            }
         }
+
+        m_graph->removeSubgraph(subgraphId);
     }
 
     Subgraph *NodeEditorModel::getSubgraph(int subgraphId) {
-        auto it = m_subgraphs.find(subgraphId);
-        return it != m_subgraphs.end() ? it->second.get() : nullptr;
+        return m_graph->getSubgraph(subgraphId);
     }
 
     const Subgraph *NodeEditorModel::getSubgraph(int subgraphId) const {
-        auto it = m_subgraphs.find(subgraphId);
-        return it != m_subgraphs.end() ? it->second.get() : nullptr;
+        return std::as_const(*m_graph).getSubgraph(subgraphId);
     }
 
     const std::map<int, std::shared_ptr<Subgraph> > &NodeEditorModel::getSubgraphs() const {
-        return m_subgraphs;
+        return m_graph->getSubgraphs();
     }
 
     NodeEditorModel::Node *NodeEditorModel::createSubgraphNode(int subgraphId, const std::string &name,
@@ -366,24 +179,13 @@ namespace NodeEditorCore {
         Subgraph *subgraph = getSubgraph(subgraphId);
         if (!subgraph) return nullptr;
 
-        int nodeId = m_nextNodeId++;
-        auto node = std::make_shared<Node>();
-
-        node->id = nodeId;
-        node->name = name;
-        node->type = "Subgraph";
-        node->position = position;
-        node->size = Vec2(160.0f, 40.0f);
-        node->selected = false;
-        node->disabled = false;
-        node->groupId = -1;
-        node->isTemplate = false;
-        node->isCurrentFlag = false;
-        node->labelPosition = NodeLabelPosition::Right;
+        int nodeId = m_graph->addNode(name, "Subgraph", position);
+        Node *node = m_graph->getNode(nodeId);
+
+        m_graph->setNodeSize(nodeId, Vec2(160.0f, 40.0f));
         node->isSubgraph = true;
         node->subgraphId = subgraphId;
-
-        m_nodes.push_back(node);
+        node->subgraphUuid = subgraph->uuid;
 
         Event event(EventType::NodeCreated);
         event.setData("nodeId", nodeId);
@@ -391,7 +193,7 @@ namespace NodeEditorCore {
         event.setData("subgraphId", subgraphId);
         dispatchEvent(event);
 
-        return node.get();
+        return m_graph->getNode(nodeId);
     }
 
     void NodeEditorModel::selectNode(int nodeId, bool append) {
@@ -424,42 +226,44 @@ namespace NodeEditorCore {
     }
 
     void NodeEditorModel::selectAllNodes() {
-        for (auto &node: m_nodes) {
-            if (!node->selected) {
-                node->selected = true;
+        for (const auto &node: m_graph->getNodes()) {
+            if (!node.selected) {
+                int nodeId = node.id;
+                getNode(nodeId)->selected = true;
 
                 Event event(EventType::NodeSelected);
-                event.setData("nodeId", node->id);
+                event.setData("nodeId", nodeId);
                 dispatchEvent(event);
             }
         }
     }
 
     void NodeEditorModel::deselectAllNodes() {
-        for (auto &node: m_nodes) {
-            if (node->selected) {
-                node->selected = false;
+        for (const auto &node: m_graph->getNodes()) {
+            if (node.selected) {
+                int nodeId = node.id;
+                getNode(nodeId)->selected = false;
 
                 Event event(EventType::NodeDeselected);
-                event.setData("nodeId", node->id);
+                event.setData("nodeId", nodeId);
                 dispatchEvent(event);
             }
         }
 
-        for (auto &connection: m_connections) {
-            connection->selected = false;
+        for (const auto &connection: m_graph->getConnections()) {
+            getConnection(connection.id)->selected = false;
         }
 
-        for (auto &group: m_groups) {
-            group->selected = false;
+        for (const auto &group: m_graph->getGroups()) {
+            getGroup(group.id)->selected = false;
         }
     }
 
     std::vector<int> NodeEditorModel::getSelectedNodes() const {
         std::vector<int> selectedNodes;
-        for (const auto &node: m_nodes) {
-            if (node->selected) {
-                selectedNodes.push_back(node->id);
+        for (const auto &node: m_graph->getNodes()) {
+            if (node.selected) {
+                selectedNodes.push_back(node.id);
             }
         }
         return selectedNodes;
@@ -495,9 +299,12 @@ namespace NodeEditorCore {
         }
     }
 
+    std::shared_ptr<NodeEditor> NodeEditorModel::getGraph() const {
+        return m_graph;
+    }
+
     void NodeEditorModel::enterSubgraph(int subgraphId) {
-        auto subgraph = getSubgraph(subgraphId);
-        if (!subgraph) return;
+        if (!m_graph->enterSubgraph(subgraphId)) return;
 
         m_state["currentSubgraphId"] = subgraphId;
 
@@ -507,16 +314,12 @@ namespace NodeEditorCore {
     }
 
     void NodeEditorModel::exitSubgraph() {
-        int currentSubgraphId = std::any_cast<int>(m_state["currentSubgraphId"]);
+        int currentSubgraphId = getCurrentSubgraphId();
 
         if (currentSubgraphId < 0) return;
+        if (!m_graph->exitSubgraph()) return;
 
-        auto subgraph = getSubgraph(currentSubgraphId);
-        if (!subgraph) return;
-
-        int parentId = subgraph->parentSubgraphId;
-
-        m_state["currentSubgraphId"] = parentId;
+        m_state["currentSubgraphId"] = m_graph->getCurrentSubgraphId();
 
         Event event(EventType::SubgraphExited);
         event.subgraphId = currentSubgraphId;
@@ -531,14 +334,9 @@ namespace NodeEditorCore {
     }
 
     void NodeEditorModel::addNodeToSubgraph(int nodeId, int subgraphId) {
-        Node *node = getNode(nodeId);
-        Subgraph *subgraph = getSubgraph(subgraphId);
-
-        if (!node || !subgraph) return;
+        if (!getNode(nodeId) || !getSubgraph(subgraphId)) return;
 
-        node->metadata.setAttribute("subgraphId", subgraphId);
-
-        subgraph->addNode(nodeId);
+        m_graph->addNodeToSubgraph(nodeId, subgraphId);
 
         Event event(EventType::NodeAddedToSubgraph);
         event.nodeId = nodeId;
@@ -547,14 +345,9 @@ namespace NodeEditorCore {
     }
 
     void NodeEditorModel::addConnectionToSubgraph(int connectionId, int subgraphId) {
-        Connection *connection = getConnection(connectionId);
-        Subgraph *subgraph = getSubgraph(subgraphId);
-
-        if (!connection || !subgraph) return;
-
-        connection->metadata.setAttribute("subgraphId", subgraphId);
+        if (!getConnection(connectionId) || !getSubgraph(subgraphId)) return;
 
-        subgraph->addConnection(connectionId);
+        m_graph->addConnectionToSubgraph(connectionId, subgraphId);
 
         Event event(EventType::ConnectionAddedToSubgraph);
         event.connectionId = connectionId;
@@ -568,7 +361,7 @@ namespace NodeEditorCore {
 
         if (!group || !subgraph) return;
 
-        group->metadata.setAttribute("subgraphId", subgraphId);
+        group->subgraphId = subgraphId;
 
         subgraph->addGroup(groupId);
 
@@ -8,37 +8,12 @@
 #include <functional>
 
 namespace NodeEditorCore {
+    class NodeEditor;
+
     class NodeEditorModel {
     public:
-        struct Node {
-            int id;
-            std::string name;
-            std::string type;
-            NodeEditorCore::Vec2 position;
-            NodeEditorCore::Vec2 size;
-            std::vector<NodeEditorCore::Pin> inputs;
-            std::vector<NodeEditorCore::Pin> outputs;
-            bool selected;
-            bool disabled;
-            int groupId;
-            std::string iconSymbol;
-            bool isTemplate;
-            bool isCurrentFlag;
-            NodeEditorCore::NodeLabelPosition labelPosition;
-            bool isSubgraph;
-            int subgraphId;
-            NodeEditorCore::Metadata metadata;
-        };
-
-        struct Connection {
-            int id;
-            int startNodeId;
-            int startPinId;
-            int endNodeId;
-            int endPinId;
-            bool selected;
-            NodeEditorCore::Metadata metadata;
-        };
+        using Node = NodeEditorCore::Node;
+        using Connection = NodeEditorCore::Connection;
 
         NodeEditorModel();
 
@@ -52,7 +27,7 @@ namespace NodeEditorCore {
 
         const Node *getNode(int nodeId) const;
 
-        const std::vector<std::shared_ptr<Node> > &getNodes() const;
+        const std::vector<Node> &getNodes() const;
 
         int addPin(int nodeId, const std::string &name, bool isInput,
                    NodeEditorCore::PinType type = NodeEditorCore::PinType::Blue,
@@ -72,7 +47,7 @@ namespace NodeEditorCore {
 
         const Connection *getConnection(int connectionId) const;
 
-        const std::vector<std::shared_ptr<Connection> > &getConnections() const;
+        const std::vector<Connection> &getConnections() const;
 
         bool isConnected(int nodeId, int pinId) const;
 
@@ -84,7 +59,7 @@ namespace NodeEditorCore {
 
         const NodeEditorCore::Group *getGroup(int groupId) const;
 
-        const std::vector<std::shared_ptr<NodeEditorCore::Group> > &getGroups() const;
+        const std::vector<NodeEditorCore::Group> &getGroups() const;
 
         void addNodeToGroup(int nodeId, int groupId);
 
@@ -146,17 +121,10 @@ namespace NodeEditorCore {
 
         void dispatchEvent(const NodeEditorCore::Event &event);
 
+        std::shared_ptr<NodeEditorCore::NodeEditor> getGraph() const;
+
     private:
-        std::vector<std::shared_ptr<Node> > m_nodes;
-        std::vector<std::shared_ptr<Connection> > m_connections;
-        std::vector<std::shared_ptr<NodeEditorCore::Group> > m_groups;
-        std::map<int, std::shared_ptr<NodeEditorCore::Subgraph> > m_subgraphs;
-
-        int m_nextNodeId;
-        int m_nextPinId;
-        int m_nextConnectionId;
-        int m_nextGroupId;
-        int m_nextSubgraphId;
+        std::shared_ptr<NodeEditorCore::NodeEditor> m_graph;
 
         std::map<std::string, std::any> m_state;
         std::map<NodeEditorCore::EventType, std::vector<NodeEditorCore::EventCallback> > m_eventListeners;
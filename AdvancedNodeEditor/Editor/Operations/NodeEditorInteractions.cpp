@@ -16,7 +16,7 @@ namespace NodeEditorCore {
         bool isMouseDragging = ImGui::IsMouseDragging(0);
         bool isMiddleMousePressed = ImGui::IsMouseDown(2);
 
-        updateHoveredElements(mousePos);
+        updateHoveredElements(mousePos, canvasPos);
         updateRerouteHover(mousePos, canvasPos);
 
         char debugText[256];
@@ -78,8 +78,8 @@ namespace NodeEditorCore {
             } else if (node && m_state.currentSubgraphId >= 0) {
                 Subgraph *subgraph = getSubgraph(m_state.currentSubgraphId);
                 if (subgraph) {
-                    int inputNodeId = subgraph->metadata.getAttribute<int>("inputNodeId", -1);
-                    int outputNodeId = subgraph->metadata.getAttribute<int>("outputNodeId", -1);
+                    int inputNodeId = subgraph->inputNodeId;
+                    int outputNodeId = subgraph->outputNodeId;
                     if (node->id == inputNodeId || node->id == outputNodeId) {
                         exitSubgraph();
                         return;
@@ -375,15 +375,15 @@ namespace NodeEditorCore {
 
         m_state.interactionMode = InteractionMode::None;
         m_state.activeNodeId = -1;
-        m_state.activeNodeUuid = "";
+        m_state.activeNodeUuid.clear();
         m_state.activeConnectionId = -1;
-        m_state.activeConnectionUuid = "";
+        m_state.activeConnectionUuid.clear();
         m_state.activeGroupId = -1;
-        m_state.activeGroupUuid = "";
+        m_state.activeGroupUuid.clear();
         m_state.connectingNodeId = -1;
-        m_state.connectingNodeUuid = "";
+        m_state.connectingNodeUuid.clear();
         m_state.connectingPinId = -1;
-        m_state.connectingPinUuid = "";
+        m_state.connectingPinUuid.clear();
         m_state.dragging = false;
         m_state.connecting = false;
         m_state.boxSelecting = false;
@@ -453,11 +453,13 @@ namespace NodeEditorCore {
             }
         }
 
-        for (auto &node: m_state.nodes) {
+        for (size_t i = 0; i < m_state.nodes.size(); ++i) {
+            Node &node = m_state.nodes[i];
             if (node.selected) {
                 auto it = m_state.draggedNodePositions.find(node.id);
                 if (it != m_state.draggedNodePositions.end()) {
                     node.position = it->second + scaledDelta;
+                    writeNodeGeometry(i);
                 }
             }
         }
@@ -542,33 +544,40 @@ namespace NodeEditorCore {
     }
 
 
-    void NodeEditor::updateHoveredElements(const ImVec2 &mousePos) {
+    void NodeEditor::updateHoverState(const Vec2 &mousePos, const Vec2 &canvasPos) {
+        nodeGeometry();
+        updateSpatialIndex();
+        updateHoveredElements(mousePos.toImVec2(), canvasPos.toImVec2());
+    }
+
+    void NodeEditor::updateHoveredElements(const ImVec2 &mousePos, const ImVec2 &canvasPos) {
         m_state.hoveredNodeId = -1;
-        m_state.hoveredNodeUuid = "";
+        m_state.hoveredNodeUuid.clear();
         m_state.hoveredPinId = -1;
-        m_state.hoveredPinUuid = "";
+        m_state.hoveredPinUuid.clear();
         m_state.hoveredConnectionId = -1;
-        m_state.hoveredConnectionUuid = "";
+        m_state.hoveredConnectionUuid.clear();
         m_state.hoveredGroupId = -1;
-        m_state.hoveredGroupUuid = "";
-
-        ImVec2 canvasPos = ImGui::GetCursorScreenPos();
-
-        for (const auto &connection: m_state.connections) {
-            if (!isNodeInCurrentSubgraph(*getNode(connection.startNodeId)) ||
-                !isNodeInCurrentSubgraph(*getNode(connection.endNodeId))) {
-                continue;
-            }
-
-            if (isConnectionHovered(connection, canvasPos)) {
-                m_state.hoveredConnectionId = connection.id;
-                m_state.hoveredConnectionUuid = connection.uuid;
-                break;
-            }
+        m_state.hoveredGroupUuid.clear();
+
+        ensureSpatialIndex();
+        const Vec2 canvasMouse = screenToCanvas(Vec2::fromImVec2(mousePos));
+        const float threshold = std::max(8.0f, 12.0f * m_state.viewScale) / m_state.viewScale;
+        collectVisibleConnections(canvasMouse - Vec2(threshold, threshold), canvasMouse + Vec2(threshold, threshold),
+                                  m_connectionIndexScratch);
+
+        int segment;
+        const int connectionIndex = findConnectionWithin(canvasMouse, threshold, segment);
+        if (connectionIndex >= 0) {
+            const Connection &connection = m_state.connections[connectionIndex];
+            m_state.hoveredConnectionId = connection.id;
+            m_state.hoveredConnectionUuid = connection.uuid;
         }
 
-        for (const auto &node: m_state.nodes) {
-            if (!isNodeInCurrentSubgraph(node)) continue;
+        collectVisibleNodes(canvasMouse, canvasMouse, m_nodeIndexScratch);
+
+        for (uint32_t nodeIndex: m_nodeIndexScratch) {
+            const Node &node = m_state.nodes[nodeIndex];
 
             ImVec2 nodePos = canvasToScreen(node.position).toImVec2();
             ImVec2 nodeSize = Vec2(node.size.x * m_state.viewScale, node.size.y * m_state.viewScale).toImVec2();
@@ -583,7 +592,7 @@ namespace NodeEditorCore {
                 apiPin.type = static_cast<PinType>(pin.type);
                 apiPin.shape = static_cast<PinShape>(pin.shape);
 
-                if (isPinHovered(node, apiPin, canvasPos)) {
+                if (isPinHovered(node, apiPin, mousePos, canvasPos)) {
                     m_state.hoveredNodeId = node.id;
                     m_state.hoveredNodeUuid = node.uuid;
                     m_state.hoveredPinId = pin.id;
@@ -603,7 +612,7 @@ namespace NodeEditorCore {
                 apiPin.type = static_cast<PinType>(pin.type);
                 apiPin.shape = static_cast<PinShape>(pin.shape);
 
-                if (isPinHovered(node, apiPin, canvasPos)) {
+                if (isPinHovered(node, apiPin, mousePos, canvasPos)) {
                     m_state.hoveredNodeId = node.id;
                     m_state.hoveredNodeUuid = node.uuid;
                     m_state.hoveredPinId = pin.id;
@@ -640,6 +649,57 @@ namespace NodeEditorCore {
         }
     }
 
+    int NodeEditor::findConnectionWithin(const Vec2 &canvasPoint, float threshold, int &segment) {
+        // Candidates come from m_connectionIndexScratch; the first one within threshold wins, as in index order.
+        m_cubicBatchScratch.clear();
+        m_cubicOwnerScratch.clear();
+
+        uint32_t found = UINT32_MAX;
+        float foundDistance = FLT_MAX;
+        segment = 0;
+
+        for (uint32_t candidate = 0; candidate < m_connectionIndexScratch.size(); ++candidate) {
+            const Connection &connection = m_state.connections[m_connectionIndexScratch[candidate]];
+            const ConnectionGeometryCache::Geometry *geometry = connectionGeometry(connection, false);
+            if (!geometry || canvasPoint.x < geometry->min.x - threshold || canvasPoint.x > geometry->max.x + threshold ||
+                canvasPoint.y < geometry->min.y - threshold || canvasPoint.y > geometry->max.y + threshold) {
+                continue;
+            }
+
+            if (geometry->key.shape != ConnectionGeometryCache::Shape::Curve) {
+                int pathSegment;
+                const float distance = geometry->distanceTo(canvasPoint, pathSegment);
+                if (distance <= threshold && candidate < found) {
+                    found = candidate;
+                    foundDistance = distance;
+                    segment = pathSegment;
+                }
+                continue;
+            }
+
+            for (size_t i = 0; i + 1 < geometry->points.size(); ++i) {
+                m_cubicBatchScratch.add(geometry->points[i], geometry->controls[i * 2], geometry->controls[i * 2 + 1],
+                                        geometry->points[i + 1]);
+                m_cubicOwnerScratch.emplace_back(candidate, static_cast<uint32_t>(i));
+            }
+        }
+
+        m_cubicDistanceScratch.resize(m_cubicBatchScratch.size());
+        m_cubicBatchScratch.distances(canvasPoint, threshold, m_cubicDistanceScratch.data());
+
+        for (size_t i = 0; i < m_cubicOwnerScratch.size(); ++i) {
+            const float distance = m_cubicDistanceScratch[i];
+            const auto [candidate, pathSegment] = m_cubicOwnerScratch[i];
+            if (distance > threshold || candidate > found || (candidate == found && distance >= foundDistance)) continue;
+
+            found = candidate;
+            foundDistance = distance;
+            segment = static_cast<int>(pathSegment);
+        }
+
+        return found == UINT32_MAX ? -1 : static_cast<int>(m_connectionIndexScratch[found]);
+    }
+
     void NodeEditor::startConnectionDragByUUID(const UUID &nodeUuid, const UUID &pinUuid) {
         int nodeId = getNodeId(nodeUuid);
         if (nodeId == -1) return;
@@ -689,7 +749,7 @@ namespace NodeEditorCore {
         for (int nodeId: group->nodes) {
             Node *node = getNode(nodeId);
             if (node) {
-                node->position = node->position + delta;
+                setNodePosition(nodeId, node->position + delta);
             }
         }
     }
@@ -811,11 +871,9 @@ namespace NodeEditorCore {
         ImGui::OpenPopup("NodeEditorContextMenu");
     }
 
-    bool NodeEditor::isPinHovered(const Node &node, const Pin &pin, const ImVec2 &canvasPos) {
+    bool NodeEditor::isPinHovered(const Node &node, const Pin &pin, const ImVec2 &mousePos, const ImVec2 &canvasPos) {
         ImVec2 pinPos = getPinPos(node, pin, canvasPos);
 
-        ImVec2 mousePos = ImGui::GetMousePos();
-
         float pinRadius = m_state.style.pinRadius * m_state.viewScale;
 
         float clickableRadius = pinRadius * 3.0f;
@@ -835,8 +893,8 @@ namespace NodeEditorCore {
 
         m_state.magnetPinNodeId = -1;
         m_state.magnetPinId = -1;
-        m_state.magnetPinNodeUuid = "";
-        m_state.magnetPinUuid = "";
+        m_state.magnetPinNodeUuid.clear();
+        m_state.magnetPinUuid.clear();
         m_state.canConnectToMagnetPin = false;
 
         float closestDist = m_state.magnetThreshold * m_state.magnetThreshold;
@@ -958,9 +1016,6 @@ namespace NodeEditorCore {
 
         ImVec2 nodeSize = Vec2(node.size.x * m_state.viewScale, node.size.y * m_state.viewScale).toImVec2();
 
-        float pinSpacing = 25.0f * m_state.viewScale;
-        float leftMargin = 20.0f * m_state.viewScale;
-
         if (pin.isInput) {
             int pinIndex = -1;
             for (size_t i = 0; i < node.inputs.size(); ++i) {
@@ -972,7 +1027,7 @@ namespace NodeEditorCore {
 
             if (pinIndex < 0) return ImVec2(0, 0);
 
-            float pinX = nodePos.x + leftMargin + pinIndex * pinSpacing;
+            float pinX = nodePos.x + pinSlotOffset(static_cast<float>(pinIndex)) * m_state.viewScale;
 
             return ImVec2(pinX, nodePos.y);
         } else {
@@ -986,148 +1041,12 @@ namespace NodeEditorCore {
 
             if (pinIndex < 0) return ImVec2(0, 0);
 
-            float pinX = nodePos.x + leftMargin + pinIndex * pinSpacing;
+            float pinX = nodePos.x + pinSlotOffset(static_cast<float>(pinIndex)) * m_state.viewScale;
 
             return ImVec2(pinX, nodePos.y + nodeSize.y);
         }
     }
 
-    bool NodeEditor::isConnectionHovered(const Connection &connection, const ImVec2 &canvasPos) {
-        const Node *startNode = getNode(connection.startNodeId);
-        const Node *endNode = getNode(connection.endNodeId);
-
-        if (!startNode || !endNode) return false;
-
-        const Pin *apiStartPin = getPin(connection.startNodeId, connection.startPinId);
-        const Pin *apiEndPin = getPin(connection.endNodeId, connection.endPinId);
-
-        if (!apiStartPin || !apiEndPin) return false;
-
-        ImVec2 mousePos = ImGui::GetMousePos();
-        float threshold = std::max(8.0f, 12.0f * m_state.viewScale);
-
-        std::vector<Reroute> reroutes = getReroutesForConnection(connection.id);
-
-        if (reroutes.empty()) {
-            Pin startPin;
-            startPin.id = apiStartPin->id;
-            startPin.isInput = apiStartPin->isInput;
-            startPin.type = apiStartPin->type;
-
-            Pin endPin;
-            endPin.id = apiEndPin->id;
-            endPin.isInput = apiEndPin->isInput;
-            endPin.type = apiEndPin->type;
-
-            ImVec2 p1 = getPinPos(*startNode, startPin, canvasPos);
-            ImVec2 p2 = getPinPos(*endNode, endPin, canvasPos);
-
-            ConnectionStyleManager::ConnectionStyle style = m_connectionStyleManager.getDefaultStyle();
-            float tension = m_connectionStyleManager.getConfig().curveTension;
-
-            switch (style) {
-                case ConnectionStyleManager::ConnectionStyle::Bezier: {
-                    auto [cp1, cp2] = calculateBezierControlPoints(p1, p2, startPin.isInput, endPin.isInput, tension);
-                    return getDistanceToBezierCubic(mousePos, p1, cp1, cp2, p2) <= threshold;
-                }
-                case ConnectionStyleManager::ConnectionStyle::AngleLine: {
-                    ImVec2 middle = ImVec2(p2.x, p1.y);
-                    float dist1 = getDistanceToLineSegment(mousePos, p1, middle);
-                    float dist2 = getDistanceToLineSegment(mousePos, middle, p2);
-                    return std::min(dist1, dist2) <= threshold;
-                }
-                case ConnectionStyleManager::ConnectionStyle::MetroLine: {
-                    float dx = p2.x - p1.x;
-                    float dy = p2.y - p1.y;
-
-                    ImVec2 middle1, middle2;
-                    if (std::abs(dx) > std::abs(dy)) {
-                        middle1 = ImVec2(p1.x + dx * 0.5f, p1.y);
-                        middle2 = ImVec2(p1.x + dx * 0.5f, p2.y);
-                    } else {
-                        middle1 = ImVec2(p1.x, p1.y + dy * 0.5f);
-                        middle2 = ImVec2(p2.x, p1.y + dy * 0.5f);
-                    }
-
-                    float dist1 = getDistanceToLineSegment(mousePos, p1, middle1);
-                    float dist2 = getDistanceToLineSegment(mousePos, middle1, middle2);
-                    float dist3 = getDistanceToLineSegment(mousePos, middle2, p2);
-                    return std::min({dist1, dist2, dist3}) <= threshold;
-                }
-                default:
-                    return getDistanceToLineSegment(mousePos, p1, p2) <= threshold;
-            }
-        } else {
-            std::vector<ImVec2> pathPoints = getConnectionPathWithReroutesForDetection(connection, canvasPos);
-            
-            for (size_t i = 0; i < pathPoints.size() - 1; i++) {
-                ImVec2 segmentStart = pathPoints[i];
-                ImVec2 segmentEnd = pathPoints[i + 1];
-
-                bool segmentStartInput, segmentEndInput;
-
-                if (i == 0) {
-                    segmentStartInput = apiStartPin->isInput;
-                } else {
-                    segmentStartInput = false;
-                }
-
-                if (i == pathPoints.size() - 2) {
-                    segmentEndInput = apiEndPin->isInput;
-                } else {
-                    segmentEndInput = true;
-                }
-
-                ConnectionStyleManager::ConnectionStyle style = m_connectionStyleManager.getDefaultStyle();
-                float tension = m_connectionStyleManager.getConfig().curveTension;
-
-                float segmentDistance = FLT_MAX;
-
-                switch (style) {
-                    case ConnectionStyleManager::ConnectionStyle::Bezier: {
-                        auto [cp1, cp2] = calculateBezierControlPoints(segmentStart, segmentEnd, segmentStartInput, segmentEndInput, tension);
-                        segmentDistance = getDistanceToBezierCubic(mousePos, segmentStart, cp1, cp2, segmentEnd);
-                        break;
-                    }
-                    case ConnectionStyleManager::ConnectionStyle::AngleLine: {
-                        ImVec2 middle = ImVec2(segmentEnd.x, segmentStart.y);
-                        float dist1 = getDistanceToLineSegment(mousePos, segmentStart, middle);
-                        float dist2 = getDistanceToLineSegment(mousePos, middle, segmentEnd);
-                        segmentDistance = std::min(dist1, dist2);
-                        break;
-                    }
-                    case ConnectionStyleManager::ConnectionStyle::MetroLine: {
-                        float dx = segmentEnd.x - segmentStart.x;
-                        float dy = segmentEnd.y - segmentStart.y;
-
-                        ImVec2 middle1, middle2;
-                        if (std::abs(dx) > std::abs(dy)) {
-                            middle1 = ImVec2(segmentStart.x + dx * 0.5f, segmentStart.y);
-                            middle2 = ImVec2(segmentStart.x + dx * 0.5f, segmentEnd.y);
-                        } else {
-                            middle1 = ImVec2(segmentStart.x, segmentStart.y + dy * 0.5f);
-                            middle2 = ImVec2(segmentEnd.x, segmentStart.y + dy * 0.5f);
-                        }
-
-                        float dist1 = getDistanceToLineSegment(mousePos, segmentStart, middle1);
-                        float dist2 = getDistanceToLineSegment(mousePos, middle1, middle2);
-                        float dist3 = getDistanceToLineSegment(mousePos, middle2, segmentEnd);
-                        segmentDistance = std::min({dist1, dist2, dist3});
-                        break;
-                    }
-                    default:
-                        segmentDistance = getDistanceToLineSegment(mousePos, segmentStart, segmentEnd);
-                        break;
-                }
-
-                if (segmentDistance <= threshold) {
-                    return true;
-                }
-            }
-            return false;
-        }
-    }
-
     void NodeEditor::drawDebugHitboxes(ImDrawList *drawList, const ImVec2 &canvasPos) {
         for (const auto &node: m_state.nodes) {
             if (!isNodeInCurrentSubgraph(node)) continue;
@@ -15,59 +15,57 @@ namespace NodeEditorCore {
             std::max(m_state.boxSelectStart.y, mousePos.y)
         );
 
-        for (auto &node: m_state.nodes) {
-            ImVec2 nodePos = canvasToScreen(node.position).toImVec2();
-            ImVec2 nodeSize = Vec2(node.size.x * m_state.viewScale, node.size.y * m_state.viewScale).toImVec2();
-            ImVec2 nodeMin = nodePos;
-            ImVec2 nodeMax = ImVec2(nodePos.x + nodeSize.x, nodePos.y + nodeSize.y);
-
-            bool intersected = !(nodeMax.x < boxMin.x || nodeMin.x > boxMax.x ||
-                                 nodeMax.y < boxMin.y || nodeMin.y > boxMax.y);
-
-            if (intersected) {
-                node.selected = true;
-            } else if (!ImGui::GetIO().KeyCtrl) {
-                node.selected = false;
+        nodeGeometry().intersectScreenRect(m_state.viewPosition, m_state.viewScale, Vec2::fromImVec2(boxMin),
+                                           Vec2::fromImVec2(boxMax), m_nodeMaskScratch);
+
+        bool keepSelection = ImGui::GetIO().KeyCtrl;
+        for (size_t i = 0; i < m_state.nodes.size(); ++i) {
+            if (m_nodeMaskScratch[i]) {
+                m_state.nodes[i].selected = true;
+            } else if (!keepSelection) {
+                m_state.nodes[i].selected = false;
             }
+            m_nodeGeometry.setSelected(i, m_state.nodes[i].selected);
         }
     }
 
     void NodeEditor::selectNode(int nodeId, bool append) {
         if (!append) {
-            for (auto &node : m_state.nodes) {
-                node.selected = false;
-            }
+            deselectAllNodes();
         }
 
-        for (auto &node : m_state.nodes) {
-            if (node.id == nodeId) {
-                node.selected = true;
-                break;
-            }
-        }
+        uint32_t index = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(nodeId));
+        if (index == HandleAllocator::npos) return;
+
+        m_state.nodes[index].selected = true;
+        writeNodeGeometry(index);
     }
 
     void NodeEditor::deselectNode(int nodeId) {
-        for (auto &node : m_state.nodes) {
-            if (node.id == nodeId) {
-                node.selected = false;
-                break;
-            }
-        }
+        uint32_t index = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(nodeId));
+        if (index == HandleAllocator::npos) return;
+
+        m_state.nodes[index].selected = false;
+        writeNodeGeometry(index);
     }
 
     void NodeEditor::selectAllNodes() {
-        for (auto &node : m_state.nodes) {
+        for (size_t i = 0; i < m_state.nodes.size(); ++i) {
+            Node &node = m_state.nodes[i];
             if ((m_state.currentSubgraphId >= 0 && node.subgraphId == m_state.currentSubgraphId) ||
                 (m_state.currentSubgraphId == -1 && node.subgraphId == -1)) {
                 node.selected = true;
-                }
+                writeNodeGeometry(i);
+            }
         }
     }
 
     void NodeEditor::deselectAllNodes() {
-        for (auto &node : m_state.nodes) {
-            node.selected = false;
+        for (size_t i = 0; i < m_state.nodes.size(); ++i) {
+            if (m_state.nodes[i].selected) {
+                m_state.nodes[i].selected = false;
+                writeNodeGeometry(i);
+            }
         }
     }
 
@@ -150,6 +148,16 @@ namespace NodeEditorCore {
         m_state.style = style;
     }
 
+    const NodeEditorStyle &NodeEditor::getStyle() const {
+        return m_state.style;
+    }
+
+    NodeEditor::DetailLevel NodeEditor::getDetailLevel() const {
+        if (m_state.viewScale < m_state.style.minimalDetailScale) return DetailLevel::Minimal;
+        if (m_state.viewScale < m_state.style.simplifiedDetailScale) return DetailLevel::Simplified;
+        return DetailLevel::Full;
+    }
+
     void NodeEditor::setNodeCreatedCallback(NodeCallback callback) {
         m_state.nodeCreatedCallback = callback;
     }
@@ -1,11 +1,15 @@
 #include "../../Core/NodeEditor.h"
 #include "../../Core/Style/InteractionMode.h"
+#include "../../Utils/MemoryAccounting.h"
 #include <algorithm>
 
 namespace NodeEditorCore {
-    NodeEditor::State::State()
-        : viewPosition(0.0f, 0.0f), viewScale(1.0f)
-          , nextNodeId(1), nextPinId(1), nextConnectionId(1), nextGroupId(1)
+    NodeEditor::State::State(std::pmr::memory_resource *resource)
+        : nodeUuidMap(resource), connectionUuidMap(resource)
+          , nodeInputConnections(resource), nodeOutputConnections(resource), pinConnections(resource)
+          , groupIndexMap(resource), groupUuidMap(resource)
+          , viewPosition(0.0f, 0.0f), viewScale(1.0f)
+          , nextPinId(1), nextGroupId(1)
           , hoveredNodeId(-1), hoveredNodeUuid(""), hoveredPinId(-1), hoveredPinUuid("")
           , hoveredConnectionId(-1), hoveredConnectionUuid(""), hoveredGroupId(-1), hoveredGroupUuid("")
           , activeNodeId(-1), activeNodeUuid(""), activeConnectionId(-1), activeConnectionUuid("")
@@ -17,21 +21,17 @@ namespace NodeEditorCore {
           , contextMenuNodeId(-1), contextMenuNodeUuid(""), contextMenuConnectionId(-1), contextMenuConnectionUuid("")
           , contextMenuGroupId(-1), contextMenuGroupUuid(""), contextMenuPinId(-1), contextMenuPinUuid("")
           , dragStart(0.0f, 0.0f), groupStartSize(0.0f, 0.0f), contextMenuPos(0.0f, 0.0f) {
-        nodeUuidMap.clear();
-        connectionUuidMap.clear();
-        groupUuidMap.clear();
     }
 
     NodeEditor::NodeEditor()
-        : m_debugMode(false)
+        : m_state(&m_graphPool)
+          , m_debugMode(false)
           , m_viewManager()
           , m_connectionStyleManager()
           , m_nodeBoundingBoxManager(std::make_shared<NodeBoundingBoxManager>())
           , m_nodeAvoidanceEnabled(false)
           , m_isSynchronizing(false)
           , m_commandsInitialized(false) {
-        m_state = State();
-
         m_viewManager.setMinZoom(0.1f);
         m_viewManager.setMaxZoom(5.0f);
 
@@ -83,8 +83,8 @@ namespace NodeEditorCore {
 
         m_state.magnetPinNodeId = -1;
         m_state.magnetPinId = -1;
-        m_state.magnetPinNodeUuid = "";
-        m_state.magnetPinUuid = "";
+        m_state.magnetPinNodeUuid.clear();
+        m_state.magnetPinUuid.clear();
         m_state.canConnectToMagnetPin = true;
 
         ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
@@ -95,17 +95,100 @@ namespace NodeEditorCore {
     }
 
     int NodeEditor::addNode(const std::string &name, const std::string &type, const Vec2 &pos, const UUID &uuid) {
-        int nodeId = m_state.nextNodeId++;
-        Node node(uuid.empty() ? generateUUID() : uuid, nodeId, name, type, pos);
+        int nodeId = static_cast<int>(m_state.nodeHandles.allocate(static_cast<uint32_t>(m_state.nodes.size())).index);
+        UUID nodeUuid = uuid.empty() ? generateUUID() : uuid;
+
+        const bool geometryCurrent = nodeGeometryCurrent();
+        m_state.nodes.emplace_back(nodeUuid, nodeId, name, type, pos, &m_graphPool);
+        reindexNodes(m_state.nodes.size() - 1);
+        m_state.graphVersion++;
+        if (geometryCurrent) {
+            m_nodeGeometry.append(m_state.nodes.back());
+            m_nodeGeometryVersion = m_state.graphVersion;
+        }
+
+        if (m_state.batchDepth > 0) {
+            m_state.pendingCreatedNodes.push_back(nodeId);
+        } else if (m_state.nodeCreatedCallback) {
+            m_state.nodeCreatedCallback(nodeId, nodeUuid);
+        }
+
+        return nodeId;
+    }
+
+    void NodeEditor::beginBatch(size_t nodeCapacity, size_t connectionCapacity) {
+        if (nodeCapacity > 0) {
+            size_t total = m_state.nodes.size() + nodeCapacity;
+            m_state.nodes.reserve(total);
+            m_state.nodeHandles.reserve(total);
+            m_state.nodeUuidMap.reserve(total);
+        }
+
+        if (connectionCapacity > 0) {
+            size_t total = m_state.connections.size() + connectionCapacity;
+            m_state.connections.reserve(total);
+            m_state.connectionHandles.reserve(total);
+            m_state.connectionUuidMap.reserve(total);
+            m_state.pendingCreatedConnections.reserve(connectionCapacity);
+        }
+
+        m_state.batchDepth++;
+    }
+
+    void NodeEditor::endBatch() {
+        if (m_state.batchDepth == 0 || --m_state.batchDepth > 0) {
+            return;
+        }
+
+        std::vector<int> createdNodes;
+        std::vector<int> createdConnections;
+        createdNodes.swap(m_state.pendingCreatedNodes);
+        createdConnections.swap(m_state.pendingCreatedConnections);
 
-        m_state.nodes.push_back(node);
-        updateNodeUuidMap();
+        if (m_state.pinStatesDirty) {
+            m_state.pinStatesDirty = false;
+            refreshPinConnectionStates();
+        }
 
         if (m_state.nodeCreatedCallback) {
-            m_state.nodeCreatedCallback(nodeId, node.uuid);
+            for (int nodeId: createdNodes) {
+                const Node *node = getNode(nodeId);
+                if (node) {
+                    m_state.nodeCreatedCallback(nodeId, node->uuid);
+                }
+            }
         }
 
-        return nodeId;
+        if (m_state.connectionCreatedCallback) {
+            for (int connectionId: createdConnections) {
+                const Connection *connection = getConnection(connectionId);
+                if (connection) {
+                    m_state.connectionCreatedCallback(connectionId, connection->uuid);
+                }
+            }
+        }
+    }
+
+    void NodeEditor::purgeNodeReferences(int nodeId, const UUID &nodeUuid) {
+        for (auto &group: m_state.groups) {
+            group.nodes.erase(nodeId);
+            group.nodeUuids.erase(nodeUuid);
+        }
+
+        for (auto &subgraphPair: m_subgraphs) {
+            subgraphPair.second->removeNode(nodeId);
+        }
+
+        if (m_state.hoveredNodeId == nodeId) {
+            m_state.hoveredNodeId = -1;
+        }
+
+        auto &pending = m_state.pendingCreatedNodes;
+        pending.erase(std::remove(pending.begin(), pending.end(), nodeId), pending.end());
+    }
+
+    bool NodeEditor::isBatching() const {
+        return m_state.batchDepth > 0;
     }
 
     UUID NodeEditor::addNodeWithUUID(const std::string &name, const std::string &type, const Vec2 &position) {
@@ -114,8 +197,10 @@ namespace NodeEditorCore {
     }
 
     void NodeEditor::removeNode(int nodeId) {
-        auto it = std::find_if(m_state.nodes.begin(), m_state.nodes.end(),
-                               [nodeId](const Node &node) { return node.id == nodeId; });
+        uint32_t denseIndex = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(nodeId));
+        auto it = denseIndex != HandleAllocator::npos
+                      ? m_state.nodes.begin() + denseIndex
+                      : m_state.nodes.end();
 
         if (it != m_state.nodes.end()) {
             if (it->isProtected) {
@@ -123,37 +208,77 @@ namespace NodeEditorCore {
             }
 
             for (const auto &subgraphPair: m_subgraphs) {
-                int inputNodeId = subgraphPair.second->metadata.getAttribute<int>("inputNodeId", -1);
-                int outputNodeId = subgraphPair.second->metadata.getAttribute<int>("outputNodeId", -1);
+                int inputNodeId = subgraphPair.second->inputNodeId;
+                int outputNodeId = subgraphPair.second->outputNodeId;
 
                 if (nodeId == inputNodeId || nodeId == outputNodeId) {
                     return;
                 }
             }
 
-            m_state.connections.erase(
-                std::remove_if(m_state.connections.begin(), m_state.connections.end(),
-                               [nodeId](const Connection &conn) {
-                                   return conn.startNodeId == nodeId || conn.endNodeId == nodeId;
-                               }),
-                m_state.connections.end());
-
-            if (it->groupId >= 0) {
-                auto groupIt = std::find_if(m_state.groups.begin(), m_state.groups.end(),
-                                            [groupId = it->groupId](const Group &group) {
-                                                return group.id == groupId;
-                                            });
-                if (groupIt != m_state.groups.end()) {
-                    groupIt->nodes.erase(nodeId);
+            const bool geometryCurrent = nodeGeometryCurrent();
+            std::vector<int> attachedConnections;
+            for (auto *adjacency: {&m_state.nodeInputConnections, &m_state.nodeOutputConnections}) {
+                auto adjacencyIt = adjacency->find(nodeId);
+                if (adjacencyIt != adjacency->end()) {
+                    attachedConnections.insert(attachedConnections.end(),
+                                               adjacencyIt->second.begin(), adjacencyIt->second.end());
+                }
+            }
+
+            size_t firstRemoved = m_state.connections.size();
+            std::vector<std::pair<int, int>> peerPins;
+            for (int connectionId: attachedConnections) {
+                uint32_t connectionIndex = m_state.connectionHandles.denseIndex(static_cast<uint32_t>(connectionId));
+                if (connectionIndex == HandleAllocator::npos) continue;
+
+                const Connection &conn = m_state.connections[connectionIndex];
+                firstRemoved = std::min<size_t>(firstRemoved, connectionIndex);
+                if (conn.startNodeId != nodeId) peerPins.emplace_back(conn.startNodeId, conn.startPinId);
+                if (conn.endNodeId != nodeId) peerPins.emplace_back(conn.endNodeId, conn.endPinId);
+
+                unlinkConnection(conn);
+                purgeConnectionReferences(connectionId);
+                m_animationManager.removeConnection(connectionId);
+                m_state.connectionUuidMap.erase(conn.uuid);
+                m_state.connectionHandles.release(static_cast<uint32_t>(connectionId));
+            }
+
+            if (firstRemoved < m_state.connections.size()) {
+                m_state.connections.erase(
+                    std::remove_if(m_state.connections.begin() + firstRemoved, m_state.connections.end(),
+                                   [nodeId](const Connection &conn) {
+                                       return conn.startNodeId == nodeId || conn.endNodeId == nodeId;
+                                   }),
+                    m_state.connections.end());
+                reindexConnections(firstRemoved);
+            }
+
+            for (const auto &peer: peerPins) {
+                if (Node *peerNode = getNode(peer.first)) {
+                    if (Pin *pin = peerNode->findPin(peer.second)) {
+                        pin->connected = hasPinConnections(peer.first, peer.second);
+                    }
                 }
             }
 
+            size_t index = it - m_state.nodes.begin();
+
             if (m_state.nodeRemovedCallback) {
                 m_state.nodeRemovedCallback(nodeId, it->uuid);
             }
 
+            purgeNodeReferences(nodeId, it->uuid);
+            m_animationManager.removeNode(nodeId);
+            m_state.nodeHandles.release(static_cast<uint32_t>(nodeId));
+            m_state.nodeUuidMap.erase(it->uuid);
             m_state.nodes.erase(it);
-            updateNodeUuidMap();
+            reindexNodes(index);
+            m_state.graphVersion++;
+            if (geometryCurrent) {
+                m_nodeGeometry.erase(index);
+                m_nodeGeometryVersion = m_state.graphVersion;
+            }
         }
     }
 
@@ -161,22 +286,42 @@ namespace NodeEditorCore {
         return m_state.nodes;
     }
 
+    void NodeEditor::setNodePosition(int nodeId, const Vec2 &position) {
+        uint32_t index = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(nodeId));
+        if (index == HandleAllocator::npos) return;
+
+        m_state.nodes[index].position = position;
+        writeNodeGeometry(index);
+    }
+
+    void NodeEditor::setNodeSize(int nodeId, const Vec2 &size) {
+        uint32_t index = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(nodeId));
+        if (index == HandleAllocator::npos) return;
+
+        m_state.nodes[index].size = size;
+        writeNodeGeometry(index);
+    }
+
     const Node *NodeEditor::getNode(int nodeId) const {
-        for (const auto &node: getNodes()) {
-            if (node.id == nodeId) {
-                return &node;
-            }
-        }
-        return nullptr;
+        uint32_t index = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(nodeId));
+        return index != HandleAllocator::npos ? &m_state.nodes[index] : nullptr;
     }
 
     Node *NodeEditor::getNode(int nodeId) {
-        for (auto &node: m_state.nodes) {
-            if (node.id == nodeId) {
-                return &node;
-            }
-        }
-        return nullptr;
+        uint32_t index = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(nodeId));
+        return index != HandleAllocator::npos ? &m_state.nodes[index] : nullptr;
+    }
+
+    Handle NodeEditor::getNodeHandle(int nodeId) const {
+        return m_state.nodeHandles.handle(static_cast<uint32_t>(nodeId));
+    }
+
+    bool NodeEditor::isNodeHandleValid(const Handle &handle) const {
+        return m_state.nodeHandles.isValid(handle);
+    }
+
+    Node *NodeEditor::getNode(const Handle &handle) {
+        return m_state.nodeHandles.isValid(handle) ? getNode(static_cast<int>(handle.index)) : nullptr;
     }
 
     void NodeEditor::updateNodeBoundingBoxes() {
@@ -250,7 +395,7 @@ namespace NodeEditorCore {
     }
 
     bool NodeEditor::isNodeInSubgraphByUUID(const Node &node, const UUID &subgraphUuid) const {
-        return node.metadata.getAttribute<UUID>("subgraphUuid", "") == subgraphUuid;
+        return node.parentSubgraphUuid == subgraphUuid;
     }
 
     bool NodeEditor::isSubgraphContainerByUUID(const UUID &uuid) const {
@@ -261,22 +406,22 @@ namespace NodeEditorCore {
 
     UUID NodeEditor::getSubgraphUUIDFromNode(const UUID &nodeUuid) const {
         int nodeId = getNodeId(nodeUuid);
-        if (nodeId == -1) return "";
+        if (nodeId == -1) return UUID();
 
         const Node *node = getNode(nodeId);
-        if (!node || !node->isSubgraph) return "";
+        if (!node || !node->isSubgraph) return UUID();
 
-        return node->metadata.getAttribute<UUID>("subgraphUuid", "");
+        return node->parentSubgraphUuid;
     }
 
     UUID NodeEditor::getNodeSubgraphUUID(const UUID &nodeUuid) const {
         int nodeId = getNodeId(nodeUuid);
-        if (nodeId == -1) return "";
+        if (nodeId == -1) return UUID();
 
         const Node *node = getNode(nodeId);
-        if (!node) return "";
+        if (!node) return UUID();
 
-        return node->metadata.getAttribute<UUID>("subgraphUuid", "");
+        return node->parentSubgraphUuid;
     }
 
     int NodeEditor::addPin(int nodeId, const std::string &name, bool isInput, PinType type, PinShape shape,
@@ -294,6 +439,7 @@ namespace NodeEditorCore {
         } else {
             node->outputs.push_back(pin);
         }
+        m_state.graphVersion++;
 
         return pinId;
     }
@@ -302,7 +448,18 @@ namespace NodeEditorCore {
         Node *node = getNode(nodeId);
         if (!node) return;
 
-        auto removeFromVec = [pinId](std::vector<Pin> &pins) {
+        auto adjacencyIt = m_state.pinConnections.find(makePinKey(nodeId, pinId));
+        if (adjacencyIt != m_state.pinConnections.end()) {
+            std::vector<int> attachedConnections(adjacencyIt->second.begin(), adjacencyIt->second.end());
+            for (int connectionId: attachedConnections) {
+                removeConnection(connectionId);
+            }
+
+            node = getNode(nodeId);
+            if (!node) return;
+        }
+
+        auto removeFromVec = [pinId](std::pmr::vector<Pin> &pins) {
             pins.erase(
                 std::remove_if(pins.begin(), pins.end(),
                                [pinId](const Pin &pin) { return pin.id == pinId; }),
@@ -311,77 +468,18 @@ namespace NodeEditorCore {
 
         removeFromVec(node->inputs);
         removeFromVec(node->outputs);
+        m_state.graphVersion++;
     }
 
     const Pin *NodeEditor::getPin(int nodeId, int pinId) const {
         const Node *node = getNode(nodeId);
-        if (!node) return nullptr;
-
-        for (const auto &pin: node->inputs) {
-            if (pin.id == pinId) {
-                static thread_local Pin result;
-                result.id = pin.id;
-                result.uuid = pin.uuid;
-                result.name = pin.name;
-                result.isInput = pin.isInput;
-                result.type = static_cast<PinType>(pin.type);
-                result.shape = static_cast<PinShape>(pin.shape);
-                result.connected = pin.connected;
-                return &result;
-            }
-        }
-
-        for (const auto &pin: node->outputs) {
-            if (pin.id == pinId) {
-                static thread_local Pin result;
-                result.id = pin.id;
-                result.uuid = pin.uuid;
-                result.name = pin.name;
-                result.isInput = pin.isInput;
-                result.type = static_cast<PinType>(pin.type);
-                result.shape = static_cast<PinShape>(pin.shape);
-                result.connected = pin.connected;
-                return &result;
-            }
-        }
-
-        return nullptr;
+        return node ? node->findPin(pinId) : nullptr;
     }
 
 
     Pin *NodeEditor::getPin(int nodeId, int pinId) {
         Node *node = getNode(nodeId);
-        if (!node) return nullptr;
-
-        for (auto &pin: node->inputs) {
-            if (pin.id == pinId) {
-                static thread_local Pin result;
-                result.id = pin.id;
-                result.uuid = pin.uuid;
-                result.name = pin.name;
-                result.isInput = pin.isInput;
-                result.type = static_cast<PinType>(pin.type);
-                result.shape = static_cast<PinShape>(pin.shape);
-                result.connected = pin.connected;
-                return &result;
-            }
-        }
-
-        for (auto &pin: node->outputs) {
-            if (pin.id == pinId) {
-                static thread_local Pin result;
-                result.id = pin.id;
-                result.uuid = pin.uuid;
-                result.name = pin.name;
-                result.isInput = pin.isInput;
-                result.type = static_cast<PinType>(pin.type);
-                result.shape = static_cast<PinShape>(pin.shape);
-                result.connected = pin.connected;
-                return &result;
-            }
-        }
-
-        return nullptr;
+        return node ? node->findPin(pinId) : nullptr;
     }
 
     int NodeEditor::addPinByNodeUUID(const UUID &nodeUuid, const std::string &name, bool isInput,
@@ -393,16 +491,26 @@ namespace NodeEditorCore {
     }
 
     void NodeEditor::registerNodeType(const std::string &type, const std::string &category,
-                                      const std::string &description, std::function<Node*(const Vec2 &)> builder) {
+                                      const std::string &description, std::function<Node*(const Vec2 &)> builder,
+                                      bool cachePrototype) {
         NodeTypeInfo info;
         info.name = type;
         info.category = category;
         info.description = description;
         info.builder = builder;
+        info.cachePrototype = cachePrototype;
 
         m_registeredNodeTypes[type] = info;
     }
 
+    void NodeEditor::reservePins(int nodeId, size_t inputCount, size_t outputCount) {
+        Node *node = getNode(nodeId);
+        if (!node) return;
+
+        node->inputs.reserve(node->inputs.size() + inputCount);
+        node->outputs.reserve(node->outputs.size() + outputCount);
+    }
+
     UUID NodeEditor::addPinWithUUID(int nodeId, const std::string &name, bool isInput, PinType type, PinShape shape) {
         int pinId = addPin(nodeId, name, isInput, type, shape);
         return getPinUUID(nodeId, pinId);
@@ -411,7 +519,7 @@ namespace NodeEditorCore {
     UUID NodeEditor::addPinWithUUIDByNodeUUID(const UUID &nodeUuid, const std::string &name, bool isInput, PinType type,
                                               PinShape shape) {
         int nodeId = getNodeId(nodeUuid);
-        if (nodeId == -1) return "";
+        if (nodeId == -1) return UUID();
 
         return addPinWithUUID(nodeId, name, isInput, type, shape);
     }
@@ -428,34 +536,39 @@ namespace NodeEditorCore {
             return nullptr;
         }
 
-        const NodeTypeInfo &info = it->second;
-        Node *node = info.builder(position);
-
-        if (node) {
-            int nodeId = addNode(node->name, type, position);
-            Node *createdNode = getNode(nodeId);
-
-            if (createdNode) {
-                for (const auto &pin: node->inputs) {
-                    addPin(nodeId, pin.name, true, pin.type, pin.shape);
-                }
+        NodeTypeInfo &info = it->second;
+        std::shared_ptr<const Node> built = info.prototype;
+        if (!built) {
+            Node *node = info.builder ? info.builder(position) : nullptr;
+            if (!node) {
+                return nullptr;
+            }
+            built.reset(node);
+            if (info.cachePrototype) {
+                info.prototype = built;
+            }
+        }
 
-                for (const auto &pin: node->outputs) {
-                    addPin(nodeId, pin.name, false, pin.type, pin.shape);
-                }
+        const Node &prototype = *built;
+        int nodeId = addNode(prototype.name, type, position);
+        Node *createdNode = getNode(nodeId);
 
-                createdNode->iconSymbol = node->iconSymbol;
-                createdNode->labelPosition = node->labelPosition;
+        if (createdNode) {
+            reservePins(nodeId, prototype.inputs.size(), prototype.outputs.size());
 
-                delete node;
+            for (const auto &pin: prototype.inputs) {
+                addPin(nodeId, pin.name, true, pin.type, pin.shape);
+            }
 
-                return createdNode;
+            for (const auto &pin: prototype.outputs) {
+                addPin(nodeId, pin.name, false, pin.type, pin.shape);
             }
 
-            delete node;
+            createdNode->iconSymbol = prototype.iconSymbol;
+            createdNode->labelPosition = prototype.labelPosition;
         }
 
-        return nullptr;
+        return createdNode;
     }
 
 
@@ -481,14 +594,14 @@ namespace NodeEditorCore {
         }
     }
 
-    void NodeEditor::loadGraphState(const SerializedState &state) {
+    size_t NodeEditor::loadGraphState(const SerializedState &state) {
         m_state.nodes.clear();
         m_state.connections.clear();
         m_state.groups.clear();
         m_subgraphs.clear();
 
         for (const auto &serializedNode: state.nodes) {
-            Node node;
+            Node node(&m_graphPool);
             node.id = serializedNode.id;
             node.uuid = serializedNode.uuid;
             node.name = serializedNode.name;
@@ -498,6 +611,8 @@ namespace NodeEditorCore {
             node.isSubgraph = serializedNode.isSubgraph;
             node.subgraphId = serializedNode.subgraphId;
             node.subgraphUuid = serializedNode.subgraphUuid;
+            node.parentSubgraphId = serializedNode.parentSubgraphId;
+            node.parentSubgraphUuid = serializedNode.parentSubgraphUuid;
             node.metadata = serializedNode.metadata;
 
             for (const auto &serializedPin: serializedNode.inputs) {
@@ -528,7 +643,7 @@ namespace NodeEditorCore {
                 node.outputs.push_back(pin);
             }
 
-            m_state.nodes.push_back(node);
+            m_state.nodes.push_back(std::move(node));
         }
 
         for (const auto &serializedConnection: state.connections) {
@@ -543,6 +658,7 @@ namespace NodeEditorCore {
             connection.endNodeUuid = serializedConnection.endNodeUuid;
             connection.endPinId = serializedConnection.endPinId;
             connection.endPinUuid = serializedConnection.endPinUuid;
+            connection.subgraphId = serializedConnection.subgraphId;
             connection.metadata = serializedConnection.metadata;
 
             m_state.connections.push_back(connection);
@@ -563,6 +679,7 @@ namespace NodeEditorCore {
                 group.nodeUuids.insert(nodeUuid);
             }
 
+            group.subgraphId = serializedGroup.subgraphId;
             group.metadata = serializedGroup.metadata;
 
             m_state.groups.push_back(group);
@@ -581,6 +698,8 @@ namespace NodeEditorCore {
             subgraph->groupUuids = serializedSubgraph.groupUuids;
             subgraph->interfaceInputs = serializedSubgraph.interfaceInputs;
             subgraph->interfaceOutputs = serializedSubgraph.interfaceOutputs;
+            subgraph->inputNodeId = serializedSubgraph.inputNodeId;
+            subgraph->outputNodeId = serializedSubgraph.outputNodeId;
             subgraph->parentSubgraphId = serializedSubgraph.parentSubgraphId;
             subgraph->parentSubgraphUuid = serializedSubgraph.parentSubgraphUuid;
             subgraph->childSubgraphIds = serializedSubgraph.childSubgraphIds;
@@ -600,24 +719,34 @@ namespace NodeEditorCore {
         m_state.viewPosition = state.viewPosition;
         m_state.viewScale = state.viewScale;
 
-        updateNodeUuidMap();
-        updateConnectionUuidMap();
-        updateGroupUuidMap();
+        std::unordered_map<int, int> nodeIdRemap = updateNodeUuidMap();
+        std::unordered_map<int, int> connectionIdRemap;
+        const size_t droppedConnections = updateConnectionUuidMap(nodeIdRemap, connectionIdRemap);
+        updateGroupUuidMap(nodeIdRemap);
+
+        auto remapId = [](int &id, const std::unordered_map<int, int> &remap) {
+            auto it = remap.find(id);
+            if (it != remap.end()) id = it->second;
+        };
+        for (auto &[subgraphId, subgraph]: m_subgraphs) {
+            for (int &nodeId: subgraph->nodeIds) remapId(nodeId, nodeIdRemap);
+            for (int &connectionId: subgraph->connectionIds) remapId(connectionId, connectionIdRemap);
+            remapId(subgraph->inputNodeId, nodeIdRemap);
+            remapId(subgraph->outputNodeId, nodeIdRemap);
+        }
+
+        rebuildConnectionAdjacency();
+        m_state.graphVersion++;
 
         refreshPinConnectionStates();
 
         updateAllSubgraphs();
 
         updateNextIds();
+        return droppedConnections;
     }
 
     void NodeEditor::updateNextIds() {
-        int maxNodeId = 0;
-        for (const auto &node: m_state.nodes) {
-            maxNodeId = std::max(maxNodeId, node.id);
-        }
-        m_state.nextNodeId = maxNodeId + 1;
-
         int maxPinId = 0;
         for (const auto &node: m_state.nodes) {
             for (const auto &pin: node.inputs) {
@@ -629,12 +758,6 @@ namespace NodeEditorCore {
         }
         m_state.nextPinId = maxPinId + 1;
 
-        int maxConnectionId = 0;
-        for (const auto &connection: m_state.connections) {
-            maxConnectionId = std::max(maxConnectionId, connection.id);
-        }
-        m_state.nextConnectionId = maxConnectionId + 1;
-
         int maxGroupId = 0;
         for (const auto &group: m_state.groups) {
             maxGroupId = std::max(maxGroupId, group.id);
@@ -643,26 +766,115 @@ namespace NodeEditorCore {
     }
 
     void NodeEditor::refreshPinConnectionStates() {
+        if (m_state.batchDepth > 0) {
+            m_state.pinStatesDirty = true;
+            return;
+        }
+
         for (auto &node: m_state.nodes) {
             for (auto &pin: node.inputs) {
-                pin.connected = false;
+                pin.connected = hasPinConnections(node.id, pin.id);
             }
             for (auto &pin: node.outputs) {
-                pin.connected = false;
+                pin.connected = hasPinConnections(node.id, pin.id);
+            }
+        }
+    }
+
+    MemoryStats NodeEditor::getMemoryStats() const {
+        using MemoryAccounting::heapBytes;
+        MemoryStats stats;
+
+        auto addMetadata = [&stats](const Metadata &metadata) {
+            stats.metadata.count += metadata.size();
+            stats.metadata.bytes += metadata.memoryUsage();
+        };
+
+        stats.nodes.count = m_state.nodes.size();
+        stats.nodes.bytes = heapBytes(m_state.nodes);
+        for (const auto &node: m_state.nodes) {
+            stats.nodes.bytes += heapBytes(node.name) + heapBytes(node.iconSymbol);
+            addMetadata(node.metadata);
+
+            for (const auto *pins: {&node.inputs, &node.outputs}) {
+                stats.pins.count += pins->size();
+                stats.pins.bytes += heapBytes(*pins);
+                for (const auto &pin: *pins) {
+                    stats.pins.bytes += heapBytes(pin.name) + heapBytes(pin.label);
+                    addMetadata(pin.metadata);
+                }
             }
         }
 
+        stats.connections.count = m_state.connections.size();
+        stats.connections.bytes = heapBytes(m_state.connections);
         for (const auto &connection: m_state.connections) {
-            Node *startNode = getNode(connection.startNodeId);
-            Node *endNode = getNode(connection.endNodeId);
+            addMetadata(connection.metadata);
+        }
+
+        stats.reroutes.count = m_reroutes.size();
+        stats.reroutes.bytes = heapBytes(m_reroutes);
 
-            if (startNode && endNode) {
-                Pin *startPin = startNode->findPin(connection.startPinId);
-                Pin *endPin = endNode->findPin(connection.endPinId);
+        stats.groups.count = m_state.groups.size();
+        stats.groups.bytes = heapBytes(m_state.groups);
+        for (const auto &group: m_state.groups) {
+            stats.groups.bytes += heapBytes(group.name) + heapBytes(group.nodes) + heapBytes(group.nodeUuids);
+            addMetadata(group.metadata);
+        }
+
+        stats.subgraphs.count = m_subgraphs.size();
+        stats.subgraphs.bytes = heapBytes(m_subgraphs);
+        for (const auto &[id, subgraph]: m_subgraphs) {
+            if (!subgraph) continue;
+            stats.subgraphs.bytes += sizeof(Subgraph) + heapBytes(subgraph->name) +
+                                     heapBytes(subgraph->nodeIds) + heapBytes(subgraph->nodeUuids) +
+                                     heapBytes(subgraph->connectionIds) + heapBytes(subgraph->connectionUuids) +
+                                     heapBytes(subgraph->groupIds) + heapBytes(subgraph->groupUuids) +
+                                     heapBytes(subgraph->interfaceInputs) + heapBytes(subgraph->interfaceOutputs) +
+                                     heapBytes(subgraph->childSubgraphIds) + heapBytes(subgraph->childSubgraphUuids);
+            addMetadata(subgraph->metadata);
+        }
 
-                if (startPin) startPin->connected = true;
-                if (endPin) endPin->connected = true;
+        stats.uuidMaps.count = m_state.nodeUuidMap.size() + m_state.connectionUuidMap.size() +
+                               m_state.groupUuidMap.size() + m_subgraphsByUuid.size();
+        stats.uuidMaps.bytes = heapBytes(m_state.nodeUuidMap) + heapBytes(m_state.connectionUuidMap) +
+                               heapBytes(m_state.groupUuidMap) + heapBytes(m_subgraphsByUuid);
+
+        stats.graphIndices.count = m_state.nodeHandles.liveCount() + m_state.connectionHandles.liveCount() +
+                                   m_state.groupIndexMap.size() + m_state.pinConnections.size();
+        stats.graphIndices.bytes = m_state.nodeHandles.memoryUsage() + m_state.connectionHandles.memoryUsage() +
+                                   heapBytes(m_state.groupIndexMap) + heapBytes(m_state.nodeInputConnections) +
+                                   heapBytes(m_state.nodeOutputConnections) + heapBytes(m_state.pinConnections) +
+                                   m_nodeSpatialIndex.memoryUsage() + m_connectionSpatialIndex.memoryUsage() +
+                                   m_connectionGeometry.memoryUsage();
+        for (const auto *adjacency: {&m_state.nodeInputConnections, &m_state.nodeOutputConnections}) {
+            for (const auto &[nodeId, connectionIds]: *adjacency) {
+                stats.graphIndices.bytes += heapBytes(connectionIds);
             }
         }
+        for (const auto &[key, connectionIds]: m_state.pinConnections) {
+            stats.graphIndices.bytes += heapBytes(connectionIds);
+        }
+
+        stats.animationState.count = m_animationManager.getNodeAnimationCount() +
+                                     m_animationManager.getConnectionAnimationCount();
+        stats.animationState.bytes = m_animationManager.getMemoryUsage();
+
+        for (const CommandRouter *router: {&m_commandManager.getBackendRouter(), &m_commandManager.getUIRouter()}) {
+            stats.commandLog.count += router->getLoggedCalls().size();
+            stats.commandLog.bytes += router->getLoggedCallsMemoryUsage();
+        }
+
+        stats.displayIdCache.count = displayIdCache().size();
+        stats.displayIdCache.bytes = heapBytes(displayIdCache());
+
+        const SymbolTable &symbols = SymbolTable::getInstance();
+        stats.symbols.count = symbols.size() - 1;
+        stats.symbols.bytes = symbols.memoryUsage();
+
+        stats.graphPool.count = m_graphUpstream.blocks();
+        stats.graphPool.bytes = m_graphUpstream.bytes();
+
+        return stats;
     }
 }
@@ -0,0 +1,260 @@
+#include "ConnectionGeometryCache.h"
+#include "CurveDistance.h"
+#include "../../Utils/MemoryAccounting.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace NodeEditorCore {
+    namespace {
+        constexpr int kMinCurveSteps = 4;
+        constexpr int kMaxCurveSteps = 64;
+
+        Vec2 cubicPoint(const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3, float t) {
+            const float u = 1.0f - t;
+            const float w0 = u * u * u;
+            const float w1 = 3.0f * u * u * t;
+            const float w2 = 3.0f * u * t * t;
+            const float w3 = t * t * t;
+            return Vec2(w0 * p0.x + w1 * p1.x + w2 * p2.x + w3 * p3.x,
+                        w0 * p0.y + w1 * p1.y + w2 * p2.y + w3 * p3.y);
+        }
+
+        void extendCubicAxis(float p0, float p1, float p2, float p3, float &min, float &max) {
+            min = std::min({min, p0, p3});
+            max = std::max({max, p0, p3});
+
+            const float a = (p1 - p0) - 2.0f * (p2 - p1) + (p3 - p2);
+            const float b = 2.0f * ((p2 - p1) - (p1 - p0));
+            const float c = p1 - p0;
+
+            float roots[2];
+            int rootCount = 0;
+            if (std::abs(a) < 1e-6f) {
+                if (std::abs(b) > 1e-6f) roots[rootCount++] = -c / b;
+            } else {
+                const float discriminant = b * b - 4.0f * a * c;
+                if (discriminant >= 0.0f) {
+                    const float root = std::sqrt(discriminant);
+                    roots[rootCount++] = (-b + root) / (2.0f * a);
+                    roots[rootCount++] = (-b - root) / (2.0f * a);
+                }
+            }
+
+            for (int i = 0; i < rootCount; ++i) {
+                const float t = roots[i];
+                if (t <= 0.0f || t >= 1.0f) continue;
+                const float u = 1.0f - t;
+                const float value = u * u * u * p0 + 3.0f * u * u * t * p1 + 3.0f * u * t * t * p2 + t * t * t * p3;
+                min = std::min(min, value);
+                max = std::max(max, value);
+            }
+        }
+
+        int curveSteps(const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3) {
+            // Uniform steps keep the chord error under the tolerance: err <= |B''|max / (8 n^2).
+            const float ax = p0.x - 2.0f * p1.x + p2.x;
+            const float ay = p0.y - 2.0f * p1.y + p2.y;
+            const float bx = p1.x - 2.0f * p2.x + p3.x;
+            const float by = p1.y - 2.0f * p2.y + p3.y;
+            const float curvature = std::sqrt(std::max(ax * ax + ay * ay, bx * bx + by * by));
+            const float steps = std::ceil(std::sqrt(0.75f * curvature / ConnectionGeometryCache::kFlatnessTolerance));
+            return std::clamp(static_cast<int>(steps), kMinCurveSteps, kMaxCurveSteps);
+        }
+
+        float distanceToSegmentSquared(const Vec2 &point, const Vec2 &a, const Vec2 &b) {
+            const float dx = b.x - a.x;
+            const float dy = b.y - a.y;
+            const float length2 = dx * dx + dy * dy;
+            float t = 0.0f;
+            if (length2 > 1e-8f) {
+                t = std::clamp(((point.x - a.x) * dx + (point.y - a.y) * dy) / length2, 0.0f, 1.0f);
+            }
+            const float ex = point.x - (a.x + t * dx);
+            const float ey = point.y - (a.y + t * dy);
+            return ex * ex + ey * ey;
+        }
+    }
+
+    Vec2 ConnectionGeometryCache::Geometry::pointAtDistance(float distance) const {
+        if (polyline.empty()) return points.empty() ? Vec2() : points.front();
+
+        auto it = std::upper_bound(arcLengths.begin(), arcLengths.end(), distance);
+        if (it == arcLengths.begin()) return polyline.front();
+        if (it == arcLengths.end()) return polyline.back();
+
+        const size_t index = static_cast<size_t>(it - arcLengths.begin());
+        const float span = arcLengths[index] - arcLengths[index - 1];
+        const float t = span > 0.0f ? (distance - arcLengths[index - 1]) / span : 0.0f;
+        const Vec2 &a = polyline[index - 1];
+        const Vec2 &b = polyline[index];
+        return Vec2(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+    }
+
+    float ConnectionGeometryCache::Geometry::distanceTo(const Vec2 &point, int &segment) const {
+        segment = 0;
+        if (key.shape == Shape::Curve && controls.size() + 2 == points.size() * 2) {
+            float best = FLT_MAX;
+            for (size_t i = 0; i + 1 < points.size(); ++i) {
+                const float distance = CurveDistance::toCubic(point, points[i], controls[i * 2], controls[i * 2 + 1],
+                                                              points[i + 1]);
+                if (distance < best) {
+                    best = distance;
+                    segment = static_cast<int>(i);
+                }
+            }
+            return best;
+        }
+
+        if (polyline.size() < 2) return FLT_MAX;
+
+        float best = FLT_MAX;
+        size_t bestEdge = 0;
+        for (size_t i = 0; i + 1 < polyline.size(); ++i) {
+            const float distance = distanceToSegmentSquared(point, polyline[i], polyline[i + 1]);
+            if (distance < best) {
+                best = distance;
+                bestEdge = i;
+            }
+        }
+
+        auto it = std::upper_bound(segmentStarts.begin(), segmentStarts.end(), static_cast<uint32_t>(bestEdge));
+        segment = std::clamp(static_cast<int>(it - segmentStarts.begin()) - 1, 0,
+                             static_cast<int>(points.size()) - 2);
+        return std::sqrt(best);
+    }
+
+    ConnectionGeometryCache::Geometry &ConnectionGeometryCache::slot(uint32_t connectionId) {
+        if (connectionId >= m_entries.size()) {
+            m_entries.resize(static_cast<size_t>(connectionId) + 1);
+        }
+        return m_entries[connectionId];
+    }
+
+    void ConnectionGeometryCache::invalidate(uint32_t connectionId) {
+        if (connectionId < m_entries.size()) {
+            m_entries[connectionId].valid = false;
+        }
+    }
+
+    void ConnectionGeometryCache::clear() {
+        m_entries.clear();
+    }
+
+    size_t ConnectionGeometryCache::validCount() const {
+        return static_cast<size_t>(std::count_if(m_entries.begin(), m_entries.end(),
+                                                 [](const Geometry &geometry) { return geometry.valid; }));
+    }
+
+    size_t ConnectionGeometryCache::memoryUsage() const {
+        size_t bytes = MemoryAccounting::heapBytes(m_entries);
+        for (const auto &geometry: m_entries) {
+            bytes += MemoryAccounting::heapBytes(geometry.points) + MemoryAccounting::heapBytes(geometry.controls) +
+                     MemoryAccounting::heapBytes(geometry.polyline) +
+                     MemoryAccounting::heapBytes(geometry.arcLengths) +
+                     MemoryAccounting::heapBytes(geometry.segmentStarts);
+        }
+        return bytes;
+    }
+
+    void ConnectionGeometryCache::build(Geometry &geometry) {
+        const std::vector<Vec2> &points = geometry.points;
+        geometry.controls.clear();
+        geometry.polyline.clear();
+        geometry.arcLengths.clear();
+        geometry.segmentStarts.clear();
+        geometry.flattened = false;
+        geometry.min = Vec2(FLT_MAX, FLT_MAX);
+        geometry.max = Vec2(-FLT_MAX, -FLT_MAX);
+
+        if (points.size() < 2) return;
+
+        if (geometry.key.shape != Shape::Curve) {
+            for (const auto &point: points) {
+                geometry.min = Vec2(std::min(geometry.min.x, point.x), std::min(geometry.min.y, point.y));
+                geometry.max = Vec2(std::max(geometry.max.x, point.x), std::max(geometry.max.y, point.y));
+            }
+            return;
+        }
+
+        const float tension = geometry.key.tension;
+        for (size_t i = 0; i + 1 < points.size(); ++i) {
+            const Vec2 &start = points[i];
+            const Vec2 &end = points[i + 1];
+            const bool segmentStartInput = i == 0 ? geometry.startInput : false;
+            const bool segmentEndInput = i + 2 == points.size() ? geometry.endInput : true;
+
+            const float dx = end.x - start.x;
+            const float dy = end.y - start.y;
+            const float cpDistance = std::sqrt(dx * dx + dy * dy) * tension;
+            const Vec2 cp1(start.x, segmentStartInput ? start.y - cpDistance : start.y + cpDistance);
+            const Vec2 cp2(end.x, segmentEndInput ? end.y - cpDistance : end.y + cpDistance);
+            geometry.controls.push_back(cp1);
+            geometry.controls.push_back(cp2);
+
+            extendCubicAxis(start.x, cp1.x, cp2.x, end.x, geometry.min.x, geometry.max.x);
+            extendCubicAxis(start.y, cp1.y, cp2.y, end.y, geometry.min.y, geometry.max.y);
+        }
+    }
+
+    void ConnectionGeometryCache::flatten(Geometry &geometry) {
+        if (geometry.flattened) return;
+
+        const std::vector<Vec2> &points = geometry.points;
+        std::vector<Vec2> &polyline = geometry.polyline;
+        polyline.clear();
+        geometry.segmentStarts.clear();
+        geometry.arcLengths.clear();
+        geometry.flattened = true;
+
+        if (points.size() < 2) return;
+
+        polyline.push_back(points.front());
+        for (size_t i = 0; i + 1 < points.size(); ++i) {
+            geometry.segmentStarts.push_back(static_cast<uint32_t>(polyline.size() - 1));
+
+            const Vec2 &start = points[i];
+            const Vec2 &end = points[i + 1];
+            switch (geometry.key.shape) {
+                case Shape::Curve: {
+                    const Vec2 &cp1 = geometry.controls[i * 2];
+                    const Vec2 &cp2 = geometry.controls[i * 2 + 1];
+                    const int steps = curveSteps(start, cp1, cp2, end);
+                    for (int step = 1; step < steps; ++step) {
+                        polyline.push_back(cubicPoint(start, cp1, cp2, end, static_cast<float>(step) / steps));
+                    }
+                    break;
+                }
+                case Shape::Angle:
+                    polyline.push_back(Vec2(end.x, start.y));
+                    break;
+                case Shape::Metro: {
+                    const float dx = end.x - start.x;
+                    const float dy = end.y - start.y;
+                    if (std::abs(dx) > std::abs(dy)) {
+                        polyline.push_back(Vec2(start.x + dx * 0.5f, start.y));
+                        polyline.push_back(Vec2(start.x + dx * 0.5f, end.y));
+                    } else {
+                        polyline.push_back(Vec2(start.x, start.y + dy * 0.5f));
+                        polyline.push_back(Vec2(end.x, start.y + dy * 0.5f));
+                    }
+                    break;
+                }
+                case Shape::Straight:
+                    break;
+            }
+            polyline.push_back(end);
+        }
+        geometry.segmentStarts.push_back(static_cast<uint32_t>(polyline.size() - 1));
+
+        geometry.arcLengths.reserve(polyline.size());
+        float length = 0.0f;
+        geometry.arcLengths.push_back(0.0f);
+        for (size_t i = 1; i < polyline.size(); ++i) {
+            const float dx = polyline[i].x - polyline[i - 1].x;
+            const float dy = polyline[i].y - polyline[i - 1].y;
+            length += std::sqrt(dx * dx + dy * dy);
+            geometry.arcLengths.push_back(length);
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef CONNECTION_GEOMETRY_CACHE_H
+#define CONNECTION_GEOMETRY_CACHE_H
+
+#include "../../Core/Types/CoreTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace NodeEditorCore {
+    class ConnectionGeometryCache {
+    public:
+        enum class Shape : uint8_t {
+            Curve,
+            Straight,
+            Angle,
+            Metro
+        };
+
+        struct Key {
+            uint64_t graphVersion = UINT64_MAX;
+            uint64_t startStamp = 0;
+            uint64_t endStamp = 0;
+            float tension = 0.0f;
+            Shape shape = Shape::Curve;
+
+            bool operator==(const Key &other) const = default;
+        };
+
+        struct Geometry {
+            Key key;
+            bool valid = false;
+            bool flattened = false;
+            bool startInput = false;
+            bool endInput = true;
+            std::vector<Vec2> points;
+            std::vector<Vec2> controls;
+            std::vector<Vec2> polyline;
+            std::vector<float> arcLengths;
+            std::vector<uint32_t> segmentStarts;
+            Vec2 min;
+            Vec2 max;
+
+            float length() const { return arcLengths.empty() ? 0.0f : arcLengths.back(); }
+            Vec2 pointAtDistance(float distance) const;
+            float distanceTo(const Vec2 &point, int &segment) const;
+        };
+
+        static constexpr float kFlatnessTolerance = 0.5f;
+
+        Geometry &slot(uint32_t connectionId);
+        void invalidate(uint32_t connectionId);
+        void clear();
+
+        size_t validCount() const;
+        size_t memoryUsage() const;
+
+        static void build(Geometry &geometry);
+        static void flatten(Geometry &geometry);
+
+    private:
+        std::vector<Geometry> m_entries;
+    };
+}
+
+#endif
@@ -0,0 +1,260 @@
+#include "CurveDistance.h"
+#include "../../Utils/MemoryAccounting.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NODE_EDITOR_CURVE_DISTANCE_SSE 1
+#endif
+
+namespace NodeEditorCore {
+    namespace {
+        constexpr float kNewtonEpsilon = 1e-6f;
+        constexpr float kDegenerate = 1e-12f;
+
+        struct PowerBasis {
+            float ax, bx, cx, dx;
+            float ay, by, cy, dy;
+        };
+
+        PowerBasis powerBasis(const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3) {
+            return {
+                (p3.x - p0.x) + 3.0f * (p1.x - p2.x), 3.0f * (p0.x - 2.0f * p1.x + p2.x), 3.0f * (p1.x - p0.x), p0.x,
+                (p3.y - p0.y) + 3.0f * (p1.y - p2.y), 3.0f * (p0.y - 2.0f * p1.y + p2.y), 3.0f * (p1.y - p0.y), p0.y
+            };
+        }
+
+        // Projecting onto coarse chords picks the basin of the global minimum; Newton on (B(t) - P) . B'(t) = 0
+        // then polishes the projected parameter. Every iterate is a point on the curve, so the minimum over them
+        // never undershoots the true distance.
+        float distanceSquared(const PowerBasis &c, float px, float py) {
+            const float step = 1.0f / CurveDistance::kCoarseSamples;
+
+            float prevX = c.dx - px;
+            float prevY = c.dy - py;
+            float bestChord = FLT_MAX;
+            float t = 0.0f;
+            for (int k = 1; k <= CurveDistance::kCoarseSamples; ++k) {
+                const float s = static_cast<float>(k) * step;
+                const float x = ((c.ax * s + c.bx) * s + c.cx) * s + c.dx - px;
+                const float y = ((c.ay * s + c.by) * s + c.cy) * s + c.dy - py;
+                const float ex = x - prevX;
+                const float ey = y - prevY;
+                const float u = std::clamp(-(prevX * ex + prevY * ey) / std::max(ex * ex + ey * ey, kDegenerate),
+                                           0.0f, 1.0f);
+                const float rx = prevX + u * ex;
+                const float ry = prevY + u * ey;
+                const float d2 = rx * rx + ry * ry;
+                if (d2 < bestChord) {
+                    bestChord = d2;
+                    t = (static_cast<float>(k - 1) + u) * step;
+                }
+                prevX = x;
+                prevY = y;
+            }
+
+            float best = FLT_MAX;
+            for (int i = 0; i < CurveDistance::kNewtonIterations; ++i) {
+                const float x = ((c.ax * t + c.bx) * t + c.cx) * t + c.dx - px;
+                const float y = ((c.ay * t + c.by) * t + c.cy) * t + c.dy - py;
+                best = std::min(best, x * x + y * y);
+
+                const float dx1 = (3.0f * c.ax * t + 2.0f * c.bx) * t + c.cx;
+                const float dy1 = (3.0f * c.ay * t + 2.0f * c.by) * t + c.cy;
+                const float dx2 = 6.0f * c.ax * t + 2.0f * c.bx;
+                const float dy2 = 6.0f * c.ay * t + 2.0f * c.by;
+                const float f = x * dx1 + y * dy1;
+                const float speed2 = dx1 * dx1 + dy1 * dy1;
+                const float fp = speed2 + (x * dx2 + y * dy2);
+                // Beyond the centre of curvature f' turns negative; fall back to a Gauss-Newton step there.
+                const float denominator = fp > kNewtonEpsilon ? fp : speed2;
+                if (denominator > kNewtonEpsilon) {
+                    t = std::clamp(t - f / denominator, 0.0f, 1.0f);
+                }
+            }
+
+            const float x = ((c.ax * t + c.bx) * t + c.cx) * t + c.dx - px;
+            const float y = ((c.ay * t + c.by) * t + c.cy) * t + c.dy - py;
+            return std::min(best, x * x + y * y);
+        }
+    }
+
+    float CurveDistance::toCubic(const Vec2 &point, const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3) {
+        return std::sqrt(distanceSquared(powerBasis(p0, p1, p2, p3), point.x, point.y));
+    }
+
+    void CubicBatch::clear() {
+        for (auto *lane: {&m_ax, &m_bx, &m_cx, &m_dx, &m_ay, &m_by, &m_cy, &m_dy, &m_minX, &m_minY, &m_maxX, &m_maxY}) {
+            lane->clear();
+        }
+        m_size = 0;
+    }
+
+    void CubicBatch::reserve(size_t count) {
+        const size_t padded = (count + kLaneWidth - 1) / kLaneWidth * kLaneWidth;
+        for (auto *lane: {&m_ax, &m_bx, &m_cx, &m_dx, &m_ay, &m_by, &m_cy, &m_dy, &m_minX, &m_minY, &m_maxX, &m_maxY}) {
+            lane->reserve(padded);
+        }
+    }
+
+    void CubicBatch::add(const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3) {
+        if (m_size == m_ax.size()) {
+            // Padding lanes have inverted bounds so every query rejects them.
+            const size_t padded = m_size + kLaneWidth;
+            for (auto *lane: {&m_ax, &m_bx, &m_cx, &m_dx, &m_ay, &m_by, &m_cy, &m_dy}) {
+                lane->resize(padded, 0.0f);
+            }
+            m_minX.resize(padded, FLT_MAX);
+            m_minY.resize(padded, FLT_MAX);
+            m_maxX.resize(padded, -FLT_MAX);
+            m_maxY.resize(padded, -FLT_MAX);
+        }
+
+        const PowerBasis c = powerBasis(p0, p1, p2, p3);
+        m_ax[m_size] = c.ax;
+        m_bx[m_size] = c.bx;
+        m_cx[m_size] = c.cx;
+        m_dx[m_size] = c.dx;
+        m_ay[m_size] = c.ay;
+        m_by[m_size] = c.by;
+        m_cy[m_size] = c.cy;
+        m_dy[m_size] = c.dy;
+
+        // The control polygon's hull contains the curve.
+        m_minX[m_size] = std::min({p0.x, p1.x, p2.x, p3.x});
+        m_minY[m_size] = std::min({p0.y, p1.y, p2.y, p3.y});
+        m_maxX[m_size] = std::max({p0.x, p1.x, p2.x, p3.x});
+        m_maxY[m_size] = std::max({p0.y, p1.y, p2.y, p3.y});
+        m_size++;
+    }
+
+    size_t CubicBatch::memoryUsage() const {
+        size_t bytes = 0;
+        for (const auto *lane: {&m_ax, &m_bx, &m_cx, &m_dx, &m_ay, &m_by, &m_cy, &m_dy,
+                                &m_minX, &m_minY, &m_maxX, &m_maxY}) {
+            bytes += MemoryAccounting::heapBytes(*lane);
+        }
+        return bytes;
+    }
+
+    void CubicBatch::distances(const Vec2 &point, float maxDistance, float *distances) const {
+#if NODE_EDITOR_CURVE_DISTANCE_SSE
+        const __m128 px = _mm_set1_ps(point.x);
+        const __m128 py = _mm_set1_ps(point.y);
+        const __m128 reach = _mm_set1_ps(maxDistance);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        const __m128 three = _mm_set1_ps(3.0f);
+        const __m128 six = _mm_set1_ps(6.0f);
+        const __m128 epsilon = _mm_set1_ps(kNewtonEpsilon);
+        const __m128 degenerate = _mm_set1_ps(kDegenerate);
+        const float step = 1.0f / CurveDistance::kCoarseSamples;
+        const __m128 far = _mm_set1_ps(FLT_MAX);
+        alignas(16) float lanes[kLaneWidth];
+
+        for (size_t i = 0; i < m_size; i += kLaneWidth) {
+            const size_t count = std::min(kLaneWidth, m_size - i);
+
+            const __m128 outside = _mm_or_ps(
+                _mm_or_ps(_mm_cmplt_ps(px, _mm_sub_ps(_mm_loadu_ps(&m_minX[i]), reach)),
+                          _mm_cmpgt_ps(px, _mm_add_ps(_mm_loadu_ps(&m_maxX[i]), reach))),
+                _mm_or_ps(_mm_cmplt_ps(py, _mm_sub_ps(_mm_loadu_ps(&m_minY[i]), reach)),
+                          _mm_cmpgt_ps(py, _mm_add_ps(_mm_loadu_ps(&m_maxY[i]), reach))));
+            if (_mm_movemask_ps(outside) == 0xF) {
+                std::fill(distances + i, distances + i + count, FLT_MAX);
+                continue;
+            }
+
+            const __m128 ax = _mm_loadu_ps(&m_ax[i]);
+            const __m128 bx = _mm_loadu_ps(&m_bx[i]);
+            const __m128 cx = _mm_loadu_ps(&m_cx[i]);
+            const __m128 dx = _mm_loadu_ps(&m_dx[i]);
+            const __m128 ay = _mm_loadu_ps(&m_ay[i]);
+            const __m128 by = _mm_loadu_ps(&m_by[i]);
+            const __m128 cy = _mm_loadu_ps(&m_cy[i]);
+            const __m128 dy = _mm_loadu_ps(&m_dy[i]);
+
+            auto offsetX = [&](__m128 t) {
+                return _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(ax, t), bx), t),
+                                                                   cx), t), dx), px);
+            };
+            auto offsetY = [&](__m128 t) {
+                return _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(ay, t), by), t),
+                                                                   cy), t), dy), py);
+            };
+
+            __m128 prevX = _mm_sub_ps(dx, px);
+            __m128 prevY = _mm_sub_ps(dy, py);
+            __m128 bestChord = far;
+            __m128 t = zero;
+            for (int k = 1; k <= CurveDistance::kCoarseSamples; ++k) {
+                const __m128 s = _mm_set1_ps(static_cast<float>(k) * step);
+                const __m128 x = offsetX(s);
+                const __m128 y = offsetY(s);
+                const __m128 ex = _mm_sub_ps(x, prevX);
+                const __m128 ey = _mm_sub_ps(y, prevY);
+                const __m128 length2 = _mm_max_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), degenerate);
+                const __m128 along = _mm_sub_ps(zero, _mm_add_ps(_mm_mul_ps(prevX, ex), _mm_mul_ps(prevY, ey)));
+                const __m128 u = _mm_min_ps(_mm_max_ps(_mm_div_ps(along, length2), zero), one);
+                const __m128 rx = _mm_add_ps(prevX, _mm_mul_ps(u, ex));
+                const __m128 ry = _mm_add_ps(prevY, _mm_mul_ps(u, ey));
+                const __m128 d2 = _mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry));
+                const __m128 closer = _mm_cmplt_ps(d2, bestChord);
+                const __m128 projected = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(static_cast<float>(k - 1)), u),
+                                                    _mm_set1_ps(step));
+                bestChord = _mm_min_ps(d2, bestChord);
+                t = _mm_or_ps(_mm_and_ps(closer, projected), _mm_andnot_ps(closer, t));
+                prevX = x;
+                prevY = y;
+            }
+
+            __m128 best = far;
+            for (int k = 0; k < CurveDistance::kNewtonIterations; ++k) {
+                const __m128 x = offsetX(t);
+                const __m128 y = offsetY(t);
+                best = _mm_min_ps(best, _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+
+                const __m128 dx1 = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(three, ax), t),
+                                                                    _mm_mul_ps(two, bx)), t), cx);
+                const __m128 dy1 = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(three, ay), t),
+                                                                    _mm_mul_ps(two, by)), t), cy);
+                const __m128 dx2 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(six, ax), t), _mm_mul_ps(two, bx));
+                const __m128 dy2 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(six, ay), t), _mm_mul_ps(two, by));
+                const __m128 f = _mm_add_ps(_mm_mul_ps(x, dx1), _mm_mul_ps(y, dy1));
+                const __m128 speed2 = _mm_add_ps(_mm_mul_ps(dx1, dx1), _mm_mul_ps(dy1, dy1));
+                const __m128 fp = _mm_add_ps(speed2, _mm_add_ps(_mm_mul_ps(x, dx2), _mm_mul_ps(y, dy2)));
+                const __m128 useNewton = _mm_cmpgt_ps(fp, epsilon);
+                const __m128 denominator = _mm_or_ps(_mm_and_ps(useNewton, fp), _mm_andnot_ps(useNewton, speed2));
+                const __m128 delta = _mm_and_ps(_mm_cmpgt_ps(denominator, epsilon), _mm_div_ps(f, denominator));
+                t = _mm_min_ps(_mm_max_ps(_mm_sub_ps(t, delta), zero), one);
+            }
+
+            const __m128 x = offsetX(t);
+            const __m128 y = offsetY(t);
+            best = _mm_min_ps(best, _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+
+            const __m128 result = _mm_or_ps(_mm_and_ps(outside, far), _mm_andnot_ps(outside, _mm_sqrt_ps(best)));
+            _mm_store_ps(lanes, result);
+            std::copy(lanes, lanes + count, distances + i);
+        }
+#else
+        distancesScalar(point, maxDistance, distances);
+#endif
+    }
+
+    void CubicBatch::distancesScalar(const Vec2 &point, float maxDistance, float *distances) const {
+        for (size_t i = 0; i < m_size; ++i) {
+            if (point.x < m_minX[i] - maxDistance || point.x > m_maxX[i] + maxDistance ||
+                point.y < m_minY[i] - maxDistance || point.y > m_maxY[i] + maxDistance) {
+                distances[i] = FLT_MAX;
+                continue;
+            }
+
+            const PowerBasis c{m_ax[i], m_bx[i], m_cx[i], m_dx[i], m_ay[i], m_by[i], m_cy[i], m_dy[i]};
+            distances[i] = std::sqrt(distanceSquared(c, point.x, point.y));
+        }
+    }
+}
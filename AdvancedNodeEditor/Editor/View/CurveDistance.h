@@ -0,0 +1,42 @@
+#ifndef CURVE_DISTANCE_H
+#define CURVE_DISTANCE_H
+
+#include "../../Core/Types/CoreTypes.h"
+#include <cstddef>
+#include <vector>
+
+namespace NodeEditorCore {
+    namespace CurveDistance {
+        constexpr int kCoarseSamples = 16;
+        constexpr int kNewtonIterations = 6;
+
+        float toCubic(const Vec2 &point, const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3);
+    }
+
+    class CubicBatch {
+    public:
+        static constexpr size_t kLaneWidth = 4;
+
+        void clear();
+        void reserve(size_t count);
+        void add(const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3);
+
+        // distances[i] receives the distance to cubic i, or FLT_MAX when its hull lies beyond maxDistance.
+        void distances(const Vec2 &point, float maxDistance, float *distances) const;
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        size_t memoryUsage() const;
+
+    private:
+        void distancesScalar(const Vec2 &point, float maxDistance, float *distances) const;
+
+        // Power-basis coefficients, B(t) = ((a t + b) t + c) t + d, padded to whole lanes.
+        std::vector<float> m_ax, m_bx, m_cx, m_dx;
+        std::vector<float> m_ay, m_by, m_cy, m_dy;
+        std::vector<float> m_minX, m_minY, m_maxX, m_maxY;
+        size_t m_size = 0;
+    };
+}
+
+#endif
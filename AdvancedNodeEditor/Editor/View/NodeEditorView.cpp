@@ -7,68 +7,9 @@
 namespace NodeEditorCore {
     NodeEditorView::NodeEditorView(std::shared_ptr<INodeEditorController> controller)
         : m_controller(controller)
-          , m_coreEditor(std::make_shared<NodeEditorCore::NodeEditor>())
+          , m_coreEditor(controller->getModel()->getGraph())
           , m_nextLayerId(1)
           , m_viewScale(1.0f) {
-        m_controller->addEventListener(EventType::NodeCreated, [this](const Event &event) {
-            int nodeId = event.getData<int>("nodeId");
-            const auto *modelNode = m_controller->getModel()->getNode(nodeId);
-            if (modelNode) {
-                m_coreEditor->addNode(modelNode->name, modelNode->type,
-                                      NodeEditorCore::Vec2(modelNode->position.x, modelNode->position.y));
-            }
-        });
-
-        m_controller->addEventListener(EventType::NodeRemoved, [this](const Event &event) {
-            int nodeId = event.getData<int>("nodeId");
-            m_coreEditor->removeNode(nodeId);
-        });
-
-        m_controller->addEventListener(EventType::ConnectionCreated, [this](const Event &event) {
-            int connectionId = event.getData<int>("connectionId");
-            const auto *modelConn = m_controller->getModel()->getConnection(connectionId);
-            if (modelConn) {
-                m_coreEditor->addConnection(
-                    modelConn->startNodeId,
-                    modelConn->startPinId,
-                    modelConn->endNodeId,
-                    modelConn->endPinId
-                );
-            }
-        });
-
-        m_controller->addEventListener(EventType::ConnectionRemoved, [this](const Event &event) {
-            int connectionId = event.getData<int>("connectionId");
-            m_coreEditor->removeConnection(connectionId);
-        });
-
-        m_controller->addEventListener(EventType::GroupCreated, [this](const Event &event) {
-            int groupId = event.getData<int>("groupId");
-            const auto *modelGroup = m_controller->getModel()->getGroup(groupId);
-            if (modelGroup) {
-                m_coreEditor->addGroup(modelGroup->name,
-                                       NodeEditorCore::Vec2(modelGroup->position.x, modelGroup->position.y),
-                                       NodeEditorCore::Vec2(modelGroup->size.x, modelGroup->size.y));
-            }
-        });
-
-        m_controller->addEventListener(EventType::GroupRemoved, [this](const Event &event) {
-            int groupId = event.getData<int>("groupId");
-            m_coreEditor->removeGroup(groupId);
-        });
-
-        m_coreEditor->setNodeCreatedCallback([this](int nodeId, const UUID &nodeUuid) {
-        });
-
-        m_coreEditor->setNodeRemovedCallback([this](int nodeId, const UUID &nodeUuid) {
-        });
-
-        m_coreEditor->setConnectionCreatedCallback([this](int connectionId, const UUID &connectionUuid) {
-        });
-
-        m_coreEditor->setConnectionRemovedCallback([this](int connectionId, const UUID &connectionUuid) {
-        });
-
         addLayer("Grid", 0, [this](ImDrawList *drawList, const ImVec2 &canvasPos) {
         });
 
@@ -0,0 +1,179 @@
+#include "NodeGeometryStore.h"
+#include <algorithm>
+#include <limits>
+
+namespace NodeEditorCore {
+    void NodeGeometryStore::sync(const std::vector<Node> &nodes) {
+        const size_t count = nodes.size();
+        const bool resized = count != m_x.size();
+        if (resized) {
+            m_changed.clear();
+            m_changedMask.assign(count, 0);
+            m_stamps.resize(count);
+            for (auto &stamp: m_stamps) {
+                stamp = ++m_nextStamp;
+            }
+        }
+
+        m_x.resize(count);
+        m_y.resize(count);
+        m_w.resize(count);
+        m_h.resize(count);
+        m_subgraph.resize(count);
+        m_flags.resize(count);
+        m_pinSlots.resize(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            assign(i, nodes[i], !resized);
+        }
+    }
+
+    void NodeGeometryStore::write(size_t index, const Node &node) {
+        assign(index, node, true);
+    }
+
+    void NodeGeometryStore::append(const Node &node) {
+        m_x.push_back(node.position.x);
+        m_y.push_back(node.position.y);
+        m_w.push_back(node.size.x);
+        m_h.push_back(node.size.y);
+        m_subgraph.push_back(-1);
+        m_flags.push_back(0);
+        m_pinSlots.push_back(0);
+        m_stamps.push_back(++m_nextStamp);
+        m_changedMask.push_back(0);
+        assign(m_x.size() - 1, node, false);
+    }
+
+    void NodeGeometryStore::erase(size_t index) {
+        m_x.erase(m_x.begin() + index);
+        m_y.erase(m_y.begin() + index);
+        m_w.erase(m_w.begin() + index);
+        m_h.erase(m_h.begin() + index);
+        m_subgraph.erase(m_subgraph.begin() + index);
+        m_flags.erase(m_flags.begin() + index);
+        m_pinSlots.erase(m_pinSlots.begin() + index);
+        m_stamps.erase(m_stamps.begin() + index);
+
+        // Changed indices shift with the erase; consumers rebuild on structural edits anyway.
+        m_changed.clear();
+        m_changedMask.assign(m_x.size(), 0);
+    }
+
+    void NodeGeometryStore::assign(size_t index, const Node &node, bool trackChanges) {
+        size_t slots = std::max(node.inputs.size(), node.outputs.size());
+        const uint16_t pinSlots = static_cast<uint16_t>(
+            std::min<size_t>(slots, std::numeric_limits<uint16_t>::max()));
+
+        if (trackChanges && (m_x[index] != node.position.x || m_y[index] != node.position.y ||
+                             m_w[index] != node.size.x || m_h[index] != node.size.y ||
+                             m_pinSlots[index] != pinSlots)) {
+            markChanged(index);
+        }
+
+        m_x[index] = node.position.x;
+        m_y[index] = node.position.y;
+        m_w[index] = node.size.x;
+        m_h[index] = node.size.y;
+        m_subgraph[index] = node.getSubgraphId();
+        m_flags[index] = static_cast<uint8_t>((node.selected ? Selected : 0) |
+                                              (node.disabled ? Disabled : 0) |
+                                              (node.isSubgraph ? SubgraphContainer : 0));
+        m_pinSlots[index] = pinSlots;
+    }
+
+    void NodeGeometryStore::clearChanged() {
+        for (uint32_t index: m_changed) {
+            m_changedMask[index] = 0;
+        }
+        m_changed.clear();
+    }
+
+    void NodeGeometryStore::markChanged(size_t index) {
+        m_stamps[index] = ++m_nextStamp;
+        if (m_changedMask[index]) return;
+        m_changedMask[index] = 1;
+        m_changed.push_back(static_cast<uint32_t>(index));
+    }
+
+    void NodeGeometryStore::clear() {
+        m_x.clear();
+        m_y.clear();
+        m_w.clear();
+        m_h.clear();
+        m_subgraph.clear();
+        m_flags.clear();
+        m_pinSlots.clear();
+        m_changed.clear();
+        m_changedMask.clear();
+        m_stamps.clear();
+    }
+
+    void NodeGeometryStore::setPosition(size_t index, const Vec2 &position) {
+        markChanged(index);
+        m_x[index] = position.x;
+        m_y[index] = position.y;
+    }
+
+    void NodeGeometryStore::setSelected(size_t index, bool selected) {
+        m_flags[index] = static_cast<uint8_t>(selected ? (m_flags[index] | Selected) : (m_flags[index] & ~Selected));
+    }
+
+    void NodeGeometryStore::collectInSubgraph(int subgraphId, std::vector<uint32_t> &indices) const {
+        const int32_t target = subgraphId < 0 ? -1 : subgraphId;
+        const int32_t *subgraph = m_subgraph.data();
+        const size_t count = size();
+
+        indices.clear();
+        for (size_t i = 0; i < count; ++i) {
+            if (subgraph[i] == target) {
+                indices.push_back(static_cast<uint32_t>(i));
+            }
+        }
+    }
+
+    bool NodeGeometryStore::computeBounds(int subgraphId, Vec2 &min, Vec2 &max) const {
+        const int32_t target = subgraphId < 0 ? -1 : subgraphId;
+        const float *__restrict x = m_x.data();
+        const float *__restrict y = m_y.data();
+        const float *__restrict w = m_w.data();
+        const float *__restrict h = m_h.data();
+        const int32_t *__restrict subgraph = m_subgraph.data();
+        const size_t count = size();
+        const float inf = std::numeric_limits<float>::max();
+
+        float minX = inf, minY = inf, maxX = -inf, maxY = -inf;
+        for (size_t i = 0; i < count; ++i) {
+            const bool inside = subgraph[i] == target;
+            minX = std::min(minX, inside ? x[i] : inf);
+            minY = std::min(minY, inside ? y[i] : inf);
+            maxX = std::max(maxX, inside ? x[i] + w[i] : -inf);
+            maxY = std::max(maxY, inside ? y[i] + h[i] : -inf);
+        }
+
+        if (minX > maxX) return false;
+        min = Vec2(minX, minY);
+        max = Vec2(maxX, maxY);
+        return true;
+    }
+
+    void NodeGeometryStore::intersectScreenRect(const Vec2 &viewPosition, float viewScale, const Vec2 &rectMin,
+                                                const Vec2 &rectMax, std::vector<uint8_t> &mask) const {
+        const float *__restrict x = m_x.data();
+        const float *__restrict y = m_y.data();
+        const float *__restrict w = m_w.data();
+        const float *__restrict h = m_h.data();
+        const size_t count = size();
+
+        mask.resize(count);
+        uint8_t *__restrict out = mask.data();
+        for (size_t i = 0; i < count; ++i) {
+            const float minX = x[i] * viewScale + viewPosition.x;
+            const float minY = y[i] * viewScale + viewPosition.y;
+            const float maxX = minX + w[i] * viewScale;
+            const float maxY = minY + h[i] * viewScale;
+            out[i] = static_cast<uint8_t>(!((maxX < rectMin.x) | (minX > rectMax.x) |
+                                            (maxY < rectMin.y) | (minY > rectMax.y)));
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef NODE_GEOMETRY_STORE_H
+#define NODE_GEOMETRY_STORE_H
+
+#include "../../Core/Types/CoreTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace NodeEditorCore {
+    class NodeGeometryStore {
+    public:
+        enum Flags : uint8_t {
+            Selected = 1 << 0,
+            Disabled = 1 << 1,
+            SubgraphContainer = 1 << 2
+        };
+
+        void sync(const std::vector<Node> &nodes);
+        void write(size_t index, const Node &node);
+        void append(const Node &node);
+        void erase(size_t index);
+        void clear();
+
+        size_t size() const { return m_x.size(); }
+        bool empty() const { return m_x.empty(); }
+
+        const float *x() const { return m_x.data(); }
+        const float *y() const { return m_y.data(); }
+        const float *width() const { return m_w.data(); }
+        const float *height() const { return m_h.data(); }
+        const int32_t *subgraph() const { return m_subgraph.data(); }
+        const uint8_t *flags() const { return m_flags.data(); }
+        const uint16_t *pinSlots() const { return m_pinSlots.data(); }
+
+        const uint64_t *stamps() const { return m_stamps.data(); }
+        const std::vector<uint32_t> &changed() const { return m_changed; }
+        void clearChanged();
+
+        Vec2 position(size_t index) const { return Vec2(m_x[index], m_y[index]); }
+        Vec2 size(size_t index) const { return Vec2(m_w[index], m_h[index]); }
+        bool isSelected(size_t index) const { return (m_flags[index] & Selected) != 0; }
+
+        void setPosition(size_t index, const Vec2 &position);
+        void setSelected(size_t index, bool selected);
+
+        void collectInSubgraph(int subgraphId, std::vector<uint32_t> &indices) const;
+
+        bool computeBounds(int subgraphId, Vec2 &min, Vec2 &max) const;
+
+        void intersectScreenRect(const Vec2 &viewPosition, float viewScale, const Vec2 &rectMin, const Vec2 &rectMax,
+                                 std::vector<uint8_t> &mask) const;
+
+    private:
+        std::vector<float> m_x;
+        std::vector<float> m_y;
+        std::vector<float> m_w;
+        std::vector<float> m_h;
+        std::vector<int32_t> m_subgraph;
+        std::vector<uint8_t> m_flags;
+        std::vector<uint16_t> m_pinSlots;
+        std::vector<uint64_t> m_stamps;
+        uint64_t m_nextStamp = 0;
+        std::vector<uint32_t> m_changed;
+        std::vector<uint8_t> m_changedMask;
+
+        void markChanged(size_t index);
+        void assign(size_t index, const Node &node, bool trackChanges);
+    };
+}
+
+#endif
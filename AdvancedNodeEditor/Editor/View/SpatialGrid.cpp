@@ -0,0 +1,225 @@
+#include "SpatialGrid.h"
+#include "../../Utils/MemoryAccounting.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace NodeEditorCore {
+    namespace {
+        constexpr int64_t kMaxCellsPerItem = 64;
+        constexpr int32_t kCellCoordLimit = 1 << 24;
+
+        bool overlaps(const Vec2 &aMin, const Vec2 &aMax, const Vec2 &bMin, const Vec2 &bMax) {
+            return aMin.x <= bMax.x && aMax.x >= bMin.x && aMin.y <= bMax.y && aMax.y >= bMin.y;
+        }
+    }
+
+    SpatialGrid::SpatialGrid(float cellSize)
+        : m_cellSize(cellSize)
+          , m_inverseCellSize(1.0f / cellSize) {
+        clear();
+    }
+
+    void SpatialGrid::clear() {
+        m_entries.clear();
+        m_cells.clear();
+        m_oversized.clear();
+        m_queryStamps.clear();
+        m_liveCount = 0;
+        m_extentMinX = std::numeric_limits<int32_t>::max();
+        m_extentMinY = std::numeric_limits<int32_t>::max();
+        m_extentMaxX = std::numeric_limits<int32_t>::min();
+        m_extentMaxY = std::numeric_limits<int32_t>::min();
+    }
+
+    void SpatialGrid::reserve(size_t count) {
+        m_entries.reserve(count);
+        m_queryStamps.reserve(count);
+        m_cells.reserve(count);
+    }
+
+    bool SpatialGrid::update(uint32_t item, const Vec2 &min, const Vec2 &max) {
+        if (item >= m_entries.size()) {
+            m_entries.resize(static_cast<size_t>(item) + 1);
+            m_queryStamps.resize(m_entries.size(), 0);
+        }
+
+        Entry &entry = m_entries[item];
+        if (entry.live && entry.min.x == min.x && entry.min.y == min.y &&
+            entry.max.x == max.x && entry.max.y == max.y) {
+            return false;
+        }
+
+        const int32_t cellMinX = cellCoord(min.x);
+        const int32_t cellMinY = cellCoord(min.y);
+        const int32_t cellMaxX = cellCoord(max.x);
+        const int32_t cellMaxY = cellCoord(max.y);
+        if (entry.live && entry.cellMinX == cellMinX && entry.cellMinY == cellMinY &&
+            entry.cellMaxX == cellMaxX && entry.cellMaxY == cellMaxY) {
+            entry.min = min;
+            entry.max = max;
+            return true;
+        }
+
+        if (entry.live) {
+            unlink(item);
+        } else {
+            entry.live = true;
+            m_liveCount++;
+        }
+
+        entry.min = min;
+        entry.max = max;
+        entry.cellMinX = cellMinX;
+        entry.cellMinY = cellMinY;
+        entry.cellMaxX = cellMaxX;
+        entry.cellMaxY = cellMaxY;
+        link(item);
+        return true;
+    }
+
+    void SpatialGrid::remove(uint32_t item) {
+        if (!contains(item)) return;
+
+        unlink(item);
+        m_entries[item].live = false;
+        m_liveCount--;
+    }
+
+    bool SpatialGrid::contains(uint32_t item) const {
+        return item < m_entries.size() && m_entries[item].live;
+    }
+
+    bool SpatialGrid::bounds(uint32_t item, Vec2 &min, Vec2 &max) const {
+        if (!contains(item)) return false;
+        min = m_entries[item].min;
+        max = m_entries[item].max;
+        return true;
+    }
+
+    void SpatialGrid::query(const Vec2 &min, const Vec2 &max, std::vector<uint32_t> &items) const {
+        items.clear();
+        if (m_liveCount == 0) return;
+
+        const int32_t cellMinX = std::max(cellCoord(min.x), m_extentMinX);
+        const int32_t cellMinY = std::max(cellCoord(min.y), m_extentMinY);
+        const int32_t cellMaxX = std::min(cellCoord(max.x), m_extentMaxX);
+        const int32_t cellMaxY = std::min(cellCoord(max.y), m_extentMaxY);
+
+        const int64_t spannedCells = cellMinX > cellMaxX || cellMinY > cellMaxY
+                                         ? 0
+                                         : (static_cast<int64_t>(cellMaxX) - cellMinX + 1) *
+                                           (static_cast<int64_t>(cellMaxY) - cellMinY + 1);
+
+        if (spannedCells >= static_cast<int64_t>(m_cells.size())) {
+            for (uint32_t item = 0; item < m_entries.size(); ++item) {
+                const Entry &entry = m_entries[item];
+                if (entry.live && overlaps(entry.min, entry.max, min, max)) {
+                    items.push_back(item);
+                }
+            }
+            return;
+        }
+
+        const uint32_t stamp = nextQueryStamp();
+        auto visit = [&](uint32_t item) {
+            if (m_queryStamps[item] == stamp) return;
+            m_queryStamps[item] = stamp;
+            const Entry &entry = m_entries[item];
+            if (overlaps(entry.min, entry.max, min, max)) {
+                items.push_back(item);
+            }
+        };
+
+        for (int32_t y = cellMinY; y <= cellMaxY; ++y) {
+            for (int32_t x = cellMinX; x <= cellMaxX; ++x) {
+                auto it = m_cells.find(cellKey(x, y));
+                if (it == m_cells.end()) continue;
+                for (uint32_t item: it->second) {
+                    visit(item);
+                }
+            }
+        }
+
+        for (uint32_t item: m_oversized) {
+            visit(item);
+        }
+
+        std::sort(items.begin(), items.end());
+    }
+
+    size_t SpatialGrid::memoryUsage() const {
+        size_t bytes = MemoryAccounting::heapBytes(m_entries) + MemoryAccounting::heapBytes(m_cells) +
+                       MemoryAccounting::heapBytes(m_oversized) + MemoryAccounting::heapBytes(m_queryStamps);
+        for (const auto &[key, items]: m_cells) {
+            bytes += MemoryAccounting::heapBytes(items);
+        }
+        return bytes;
+    }
+
+    int32_t SpatialGrid::cellCoord(float value) const {
+        float cell = std::floor(value * m_inverseCellSize);
+        if (!(cell > -kCellCoordLimit)) return -kCellCoordLimit;
+        if (cell > kCellCoordLimit) return kCellCoordLimit;
+        return static_cast<int32_t>(cell);
+    }
+
+    void SpatialGrid::link(uint32_t item) {
+        Entry &entry = m_entries[item];
+        const int64_t spannedCells = (static_cast<int64_t>(entry.cellMaxX) - entry.cellMinX + 1) *
+                                     (static_cast<int64_t>(entry.cellMaxY) - entry.cellMinY + 1);
+
+        m_extentMinX = std::min(m_extentMinX, entry.cellMinX);
+        m_extentMinY = std::min(m_extentMinY, entry.cellMinY);
+        m_extentMaxX = std::max(m_extentMaxX, entry.cellMaxX);
+        m_extentMaxY = std::max(m_extentMaxY, entry.cellMaxY);
+
+        entry.oversized = spannedCells > kMaxCellsPerItem;
+        if (entry.oversized) {
+            m_oversized.push_back(item);
+            return;
+        }
+
+        for (int32_t y = entry.cellMinY; y <= entry.cellMaxY; ++y) {
+            for (int32_t x = entry.cellMinX; x <= entry.cellMaxX; ++x) {
+                m_cells[cellKey(x, y)].push_back(item);
+            }
+        }
+    }
+
+    void SpatialGrid::unlink(uint32_t item) {
+        const Entry &entry = m_entries[item];
+
+        auto erase = [item](std::vector<uint32_t> &items) {
+            auto it = std::find(items.begin(), items.end(), item);
+            if (it != items.end()) {
+                *it = items.back();
+                items.pop_back();
+            }
+        };
+
+        if (entry.oversized) {
+            erase(m_oversized);
+            return;
+        }
+
+        for (int32_t y = entry.cellMinY; y <= entry.cellMaxY; ++y) {
+            for (int32_t x = entry.cellMinX; x <= entry.cellMaxX; ++x) {
+                auto it = m_cells.find(cellKey(x, y));
+                if (it == m_cells.end()) continue;
+                erase(it->second);
+                if (it->second.empty()) {
+                    m_cells.erase(it);
+                }
+            }
+        }
+    }
+
+    uint32_t SpatialGrid::nextQueryStamp() const {
+        if (++m_queryStamp == 0) {
+            std::fill(m_queryStamps.begin(), m_queryStamps.end(), 0);
+            m_queryStamp = 1;
+        }
+        return m_queryStamp;
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "../../Core/Types/CoreTypes.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace NodeEditorCore {
+    class SpatialGrid {
+    public:
+        explicit SpatialGrid(float cellSize = 256.0f);
+
+        void clear();
+        void reserve(size_t count);
+
+        bool update(uint32_t item, const Vec2 &min, const Vec2 &max);
+        void remove(uint32_t item);
+
+        bool contains(uint32_t item) const;
+        bool bounds(uint32_t item, Vec2 &min, Vec2 &max) const;
+
+        void query(const Vec2 &min, const Vec2 &max, std::vector<uint32_t> &items) const;
+
+        size_t size() const { return m_liveCount; }
+        size_t cellCount() const { return m_cells.size(); }
+        float cellSize() const { return m_cellSize; }
+        size_t memoryUsage() const;
+
+    private:
+        struct Entry {
+            Vec2 min;
+            Vec2 max;
+            int32_t cellMinX = 0;
+            int32_t cellMinY = 0;
+            int32_t cellMaxX = -1;
+            int32_t cellMaxY = -1;
+            bool live = false;
+            bool oversized = false;
+        };
+
+        static uint64_t cellKey(int32_t x, int32_t y) {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+
+        int32_t cellCoord(float value) const;
+        void link(uint32_t item);
+        void unlink(uint32_t item);
+        uint32_t nextQueryStamp() const;
+
+        float m_cellSize;
+        float m_inverseCellSize;
+        std::vector<Entry> m_entries;
+        std::unordered_map<uint64_t, std::vector<uint32_t> > m_cells;
+        std::vector<uint32_t> m_oversized;
+        size_t m_liveCount = 0;
+        int32_t m_extentMinX;
+        int32_t m_extentMinY;
+        int32_t m_extentMaxX;
+        int32_t m_extentMaxY;
+        mutable std::vector<uint32_t> m_queryStamps;
+        mutable uint32_t m_queryStamp = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include "BatchKernels.h"
+
+namespace NodeEditorCore {
+    namespace BatchKernels {
+        void fill(float *__restrict output, float value, size_t laneCount) {
+            for (size_t i = 0; i < laneCount; ++i) {
+                output[i] = value;
+            }
+        }
+
+        void add(const float *__restrict a, const float *__restrict b, float *__restrict output, size_t laneCount) {
+            for (size_t i = 0; i < laneCount; ++i) {
+                output[i] = a[i] + b[i];
+            }
+        }
+
+        void multiply(const float *__restrict a, const float *__restrict b, float *__restrict output,
+                      size_t laneCount) {
+            for (size_t i = 0; i < laneCount; ++i) {
+                output[i] = a[i] * b[i];
+            }
+        }
+
+        void subtract(const float *__restrict a, const float *__restrict b, float *__restrict output,
+                      size_t laneCount) {
+            for (size_t i = 0; i < laneCount; ++i) {
+                output[i] = a[i] - b[i];
+            }
+        }
+
+        void copy(const float *__restrict input, float *__restrict output, size_t laneCount) {
+            for (size_t i = 0; i < laneCount; ++i) {
+                output[i] = input[i];
+            }
+        }
+
+        void accumulateAdd(float *__restrict output, const float *__restrict input, size_t laneCount) {
+            for (size_t i = 0; i < laneCount; ++i) {
+                output[i] += input[i];
+            }
+        }
+
+        void accumulateMultiply(float *__restrict output, const float *__restrict input, size_t laneCount) {
+            for (size_t i = 0; i < laneCount; ++i) {
+                output[i] *= input[i];
+            }
+        }
+
+        void addEvaluator(std::span<const float *const> inputs, std::span<float *const> outputs, size_t laneCount) {
+            if (outputs.empty()) return;
+            if (inputs.size() < 2) {
+                if (inputs.empty()) {
+                    fill(outputs[0], 0.0f, laneCount);
+                } else {
+                    copy(inputs[0], outputs[0], laneCount);
+                }
+                return;
+            }
+
+            add(inputs[0], inputs[1], outputs[0], laneCount);
+            for (size_t input = 2; input < inputs.size(); ++input) {
+                accumulateAdd(outputs[0], inputs[input], laneCount);
+            }
+        }
+
+        void multiplyEvaluator(std::span<const float *const> inputs, std::span<float *const> outputs,
+                               size_t laneCount) {
+            if (outputs.empty()) return;
+            if (inputs.size() < 2) {
+                if (inputs.empty()) {
+                    fill(outputs[0], 1.0f, laneCount);
+                } else {
+                    copy(inputs[0], outputs[0], laneCount);
+                }
+                return;
+            }
+
+            multiply(inputs[0], inputs[1], outputs[0], laneCount);
+            for (size_t input = 2; input < inputs.size(); ++input) {
+                accumulateMultiply(outputs[0], inputs[input], laneCount);
+            }
+        }
+
+        void subtractEvaluator(std::span<const float *const> inputs, std::span<float *const> outputs,
+                               size_t laneCount) {
+            if (outputs.empty()) return;
+            if (inputs.size() < 2) {
+                if (inputs.empty()) {
+                    fill(outputs[0], 0.0f, laneCount);
+                } else {
+                    copy(inputs[0], outputs[0], laneCount);
+                }
+                return;
+            }
+
+            subtract(inputs[0], inputs[1], outputs[0], laneCount);
+        }
+    }
+}
@@ -0,0 +1,28 @@
+#ifndef NODE_EDITOR_BATCH_KERNELS_H
+#define NODE_EDITOR_BATCH_KERNELS_H
+
+#include <cstddef>
+#include <functional>
+#include <span>
+
+namespace NodeEditorCore {
+    using BatchEvaluator = std::function<void(std::span<const float *const> inputs,
+                                              std::span<float *const> outputs,
+                                              size_t laneCount)>;
+
+    namespace BatchKernels {
+        void fill(float *output, float value, size_t laneCount);
+        void add(const float *a, const float *b, float *output, size_t laneCount);
+        void multiply(const float *a, const float *b, float *output, size_t laneCount);
+        void subtract(const float *a, const float *b, float *output, size_t laneCount);
+        void copy(const float *input, float *output, size_t laneCount);
+        void accumulateAdd(float *output, const float *input, size_t laneCount);
+        void accumulateMultiply(float *output, const float *input, size_t laneCount);
+
+        void addEvaluator(std::span<const float *const> inputs, std::span<float *const> outputs, size_t laneCount);
+        void multiplyEvaluator(std::span<const float *const> inputs, std::span<float *const> outputs, size_t laneCount);
+        void subtractEvaluator(std::span<const float *const> inputs, std::span<float *const> outputs, size_t laneCount);
+    }
+}
+
+#endif
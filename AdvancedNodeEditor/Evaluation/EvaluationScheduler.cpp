@@ -0,0 +1,120 @@
+#include "EvaluationScheduler.h"
+
+namespace NodeEditorCore {
+    EvaluationScheduler::EvaluationScheduler(size_t threadCount)
+        : m_plan(nullptr), m_task(nullptr), m_remaining(0), m_stopping(false) {
+        for (size_t i = 1; i < threadCount; ++i) {
+            m_workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    EvaluationScheduler::~EvaluationScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+
+        for (auto &worker: m_workers) {
+            worker.join();
+        }
+    }
+
+    size_t EvaluationScheduler::getThreadCount() const {
+        return m_workers.size() + 1;
+    }
+
+    void EvaluationScheduler::run(const NodeEvaluator::EvaluationPlan &plan,
+                                  const std::function<void(size_t)> &task) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_plan = &plan;
+        m_task = &task;
+        m_error = nullptr;
+        m_remaining = plan.steps.size();
+        m_pending.resize(plan.steps.size());
+        m_ready.clear();
+
+        for (size_t step = 0; step < plan.steps.size(); ++step) {
+            m_pending[step] = plan.steps[step].dependencyCount;
+            if (m_pending[step] == 0) {
+                m_ready.push_back(step);
+            }
+        }
+        m_wake.notify_all();
+
+        while (m_remaining > 0) {
+            if (!m_ready.empty()) {
+                runNext(lock);
+            } else {
+                m_done.wait(lock, [this]() { return m_remaining == 0 || !m_ready.empty(); });
+            }
+        }
+
+        m_plan = nullptr;
+        m_task = nullptr;
+
+        if (m_error) {
+            std::exception_ptr error = m_error;
+            m_error = nullptr;
+            lock.unlock();
+            std::rethrow_exception(error);
+        }
+    }
+
+    void EvaluationScheduler::workerLoop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true) {
+            m_wake.wait(lock, [this]() { return m_stopping || !m_ready.empty(); });
+            if (m_stopping) {
+                return;
+            }
+
+            runNext(lock);
+        }
+    }
+
+    void EvaluationScheduler::runNext(std::unique_lock<std::mutex> &lock) {
+        size_t step = m_ready.front();
+        m_ready.pop_front();
+
+        const NodeEvaluator::EvaluationPlan &plan = *m_plan;
+        const std::function<void(size_t)> &task = *m_task;
+
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            task(step);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        if (error && !m_error) {
+            m_error = error;
+        }
+
+        const NodeEvaluator::PlanStep &planStep = plan.steps[step];
+        size_t readied = 0;
+        for (size_t i = 0; i < planStep.dependentCount; ++i) {
+            size_t dependent = plan.dependents[planStep.firstDependent + i];
+            if (--m_pending[dependent] == 0) {
+                m_ready.push_back(dependent);
+                readied++;
+            }
+        }
+
+        m_remaining--;
+
+        if (readied > 1) {
+            m_wake.notify_all();
+        } else if (readied == 1) {
+            m_wake.notify_one();
+        }
+
+        if (m_remaining == 0 || readied > 0) {
+            m_done.notify_one();
+        }
+    }
+}
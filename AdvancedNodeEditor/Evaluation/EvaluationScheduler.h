@@ -0,0 +1,44 @@
+#ifndef NODE_EDITOR_EVALUATION_SCHEDULER_H
+#define NODE_EDITOR_EVALUATION_SCHEDULER_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "NodeEditorEvaluation.h"
+
+namespace NodeEditorCore {
+    class EvaluationScheduler {
+    public:
+        explicit EvaluationScheduler(size_t threadCount);
+        ~EvaluationScheduler();
+
+        EvaluationScheduler(const EvaluationScheduler &) = delete;
+        EvaluationScheduler &operator=(const EvaluationScheduler &) = delete;
+
+        size_t getThreadCount() const;
+
+        void run(const NodeEvaluator::EvaluationPlan &plan, const std::function<void(size_t)> &task);
+
+    private:
+        void workerLoop();
+        void runNext(std::unique_lock<std::mutex> &lock);
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+        std::deque<size_t> m_ready;
+        std::vector<size_t> m_pending;
+        const NodeEvaluator::EvaluationPlan *m_plan;
+        const std::function<void(size_t)> *m_task;
+        std::exception_ptr m_error;
+        size_t m_remaining;
+        bool m_stopping;
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef NODE_EDITOR_EVALUATION_VALUE_H
+#define NODE_EDITOR_EVALUATION_VALUE_H
+
+#include <any>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <variant>
+#include "../Core/Types/CoreTypes.h"
+
+namespace NodeEditorCore {
+    enum class ValueType : uint8_t {
+        None,
+        Float,
+        Int,
+        Vec2,
+        String
+    };
+
+    class EvaluationValue {
+    public:
+        EvaluationValue() = default;
+
+        EvaluationValue(float value) : m_storage(value) {
+        }
+
+        EvaluationValue(int value) : m_storage(value) {
+        }
+
+        EvaluationValue(const Vec2 &value) : m_storage(value) {
+        }
+
+        EvaluationValue(std::string value) : m_storage(std::move(value)) {
+        }
+
+        EvaluationValue(const char *value) : m_storage(std::string(value)) {
+        }
+
+        ValueType getType() const { return static_cast<ValueType>(m_storage.index()); }
+        bool isNone() const { return m_storage.index() == 0; }
+
+        float asFloat(float fallback = 0.0f) const {
+            if (const float *value = std::get_if<float>(&m_storage)) return *value;
+            if (const int *value = std::get_if<int>(&m_storage)) return static_cast<float>(*value);
+            return fallback;
+        }
+
+        int asInt(int fallback = 0) const {
+            if (const int *value = std::get_if<int>(&m_storage)) return *value;
+            if (const float *value = std::get_if<float>(&m_storage)) return static_cast<int>(*value);
+            return fallback;
+        }
+
+        Vec2 asVec2(const Vec2 &fallback = Vec2()) const {
+            if (const Vec2 *value = std::get_if<Vec2>(&m_storage)) return *value;
+            return fallback;
+        }
+
+        const std::string &asString() const {
+            static const std::string empty;
+            const std::string *value = std::get_if<std::string>(&m_storage);
+            return value ? *value : empty;
+        }
+
+        std::any toAny() const {
+            switch (getType()) {
+                case ValueType::Float: return std::get<float>(m_storage);
+                case ValueType::Int: return std::get<int>(m_storage);
+                case ValueType::Vec2: return std::get<Vec2>(m_storage);
+                case ValueType::String: return std::get<std::string>(m_storage);
+                default: return std::any();
+            }
+        }
+
+        static EvaluationValue fromAny(const std::any &value) {
+            if (const float *v = std::any_cast<float>(&value)) return EvaluationValue(*v);
+            if (const double *v = std::any_cast<double>(&value)) return EvaluationValue(static_cast<float>(*v));
+            if (const int *v = std::any_cast<int>(&value)) return EvaluationValue(*v);
+            if (const Vec2 *v = std::any_cast<Vec2>(&value)) return EvaluationValue(*v);
+            if (const std::string *v = std::any_cast<std::string>(&value)) return EvaluationValue(*v);
+            if (const char *const *v = std::any_cast<const char *>(&value)) return EvaluationValue(*v);
+            return EvaluationValue();
+        }
+
+    private:
+        std::variant<std::monostate, float, int, Vec2, std::string> m_storage;
+    };
+
+    using TypedEvaluator = std::function<void(std::span<const EvaluationValue> inputs,
+                                              std::span<EvaluationValue> outputs)>;
+}
+
+#endif
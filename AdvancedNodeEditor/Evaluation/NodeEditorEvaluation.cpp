@@ -3,29 +3,34 @@
 
 namespace NodeEditorCore {
     NodeEvaluator::ConnectionInfo::ConnectionInfo()
-        : connectionId(-1), connectionUuid(""),
-          sourceNodeId(-1), sourceNodeUuid(""), sourcePinId(-1), sourcePinUuid(""),
-          targetNodeId(-1), targetNodeUuid(""), targetPinId(-1), targetPinUuid("") {
+        : connectionId(-1),
+          sourceNodeId(-1), sourcePinId(-1),
+          targetNodeId(-1), targetPinId(-1) {
     }
 
     std::vector<NodeEvaluator::ConnectionInfo> NodeEditor::getInputConnections(int nodeId) {
         std::vector<NodeEvaluator::ConnectionInfo> result;
 
-        for (const auto &connection: m_state.connections) {
-            if (connection.endNodeId == nodeId) {
-                NodeEvaluator::ConnectionInfo info;
-                info.connectionId = connection.id;
-                info.connectionUuid = connection.uuid;
-                info.sourceNodeId = connection.startNodeId;
-                info.sourceNodeUuid = connection.startNodeUuid;
-                info.sourcePinId = connection.startPinId;
-                info.sourcePinUuid = connection.startPinUuid;
-                info.targetNodeId = connection.endNodeId;
-                info.targetNodeUuid = connection.endNodeUuid;
-                info.targetPinId = connection.endPinId;
-                info.targetPinUuid = connection.endPinUuid;
-                result.push_back(info);
-            }
+        auto it = m_state.nodeInputConnections.find(nodeId);
+        if (it == m_state.nodeInputConnections.end()) return result;
+
+        result.reserve(it->second.size());
+        for (int connectionId: it->second) {
+            const Connection *connection = getConnection(connectionId);
+            if (!connection) continue;
+
+            NodeEvaluator::ConnectionInfo info;
+            info.connectionId = connection->id;
+            info.connectionUuid = connection->uuid;
+            info.sourceNodeId = connection->startNodeId;
+            info.sourceNodeUuid = connection->startNodeUuid;
+            info.sourcePinId = connection->startPinId;
+            info.sourcePinUuid = connection->startPinUuid;
+            info.targetNodeId = connection->endNodeId;
+            info.targetNodeUuid = connection->endNodeUuid;
+            info.targetPinId = connection->endPinId;
+            info.targetPinUuid = connection->endPinUuid;
+            result.push_back(info);
         }
 
         return result;
@@ -40,21 +45,26 @@ namespace NodeEditorCore {
     std::vector<NodeEvaluator::ConnectionInfo> NodeEditor::getOutputConnections(int nodeId) {
         std::vector<NodeEvaluator::ConnectionInfo> result;
 
-        for (const auto &connection: m_state.connections) {
-            if (connection.startNodeId == nodeId) {
-                NodeEvaluator::ConnectionInfo info;
-                info.connectionId = connection.id;
-                info.connectionUuid = connection.uuid;
-                info.sourceNodeId = connection.startNodeId;
-                info.sourceNodeUuid = connection.startNodeUuid;
-                info.sourcePinId = connection.startPinId;
-                info.sourcePinUuid = connection.startPinUuid;
-                info.targetNodeId = connection.endNodeId;
-                info.targetNodeUuid = connection.endNodeUuid;
-                info.targetPinId = connection.endPinId;
-                info.targetPinUuid = connection.endPinUuid;
-                result.push_back(info);
-            }
+        auto it = m_state.nodeOutputConnections.find(nodeId);
+        if (it == m_state.nodeOutputConnections.end()) return result;
+
+        result.reserve(it->second.size());
+        for (int connectionId: it->second) {
+            const Connection *connection = getConnection(connectionId);
+            if (!connection) continue;
+
+            NodeEvaluator::ConnectionInfo info;
+            info.connectionId = connection->id;
+            info.connectionUuid = connection->uuid;
+            info.sourceNodeId = connection->startNodeId;
+            info.sourceNodeUuid = connection->startNodeUuid;
+            info.sourcePinId = connection->startPinId;
+            info.sourcePinUuid = connection->startPinUuid;
+            info.targetNodeId = connection->endNodeId;
+            info.targetNodeUuid = connection->endNodeUuid;
+            info.targetPinId = connection->endPinId;
+            info.targetPinUuid = connection->endPinUuid;
+            result.push_back(info);
         }
 
         return result;
@@ -66,20 +76,18 @@ namespace NodeEditorCore {
         return getOutputConnections(nodeId);
     }
 
-    std::vector<int> NodeEvaluator::getEvaluationOrder(NodeEditor &editor) {
+    std::vector<int> NodeEvaluator::getEvaluationOrder(const NodeEditor &editor) {
         NodeEvaluator evaluator(editor);
         return evaluator.getEvaluationOrder();
     }
 
-    std::vector<UUID> NodeEvaluator::getEvaluationOrderUUIDs(NodeEditor &editor) {
-        std::vector<UUID> result;
-        std::vector<int> order = getEvaluationOrder(editor);
+    std::vector<UUID> NodeEvaluator::getEvaluationOrderUUIDs(const NodeEditor &editor) {
+        const EvaluationPlan &plan = editor.getEvaluationPlan();
 
-        for (int nodeId: order) {
-            UUID uuid = editor.getNodeUUID(nodeId);
-            if (!uuid.empty()) {
-                result.push_back(uuid);
-            }
+        std::vector<UUID> result;
+        result.reserve(plan.steps.size());
+        for (const auto &step: plan.steps) {
+            result.push_back(step.nodeUuid);
         }
 
         return result;
@@ -88,17 +96,15 @@ namespace NodeEditorCore {
     NodeEvaluator::Connection *NodeEvaluator::getConnection(int connectionId) {
         static Connection result;
 
-        for (const auto &connection: m_editor.getConnections()) {
-            if (connection.id == connectionId) {
-                result.id = connection.id;
-                result.startNodeId = connection.startNodeId;
-                result.startPinId = connection.startPinId;
-                result.endNodeId = connection.endNodeId;
-                result.endPinId = connection.endPinId;
-                return &result;
-            }
-        }
-        return nullptr;
+        const NodeEditorCore::Connection *connection = m_editor.getConnection(connectionId);
+        if (!connection) return nullptr;
+
+        result.id = connection->id;
+        result.startNodeId = connection->startNodeId;
+        result.startPinId = connection->startPinId;
+        result.endNodeId = connection->endNodeId;
+        result.endPinId = connection->endPinId;
+        return &result;
     }
 
     int NodeEvaluator::getCurrentSubgraphId() const {
@@ -111,113 +117,178 @@ namespace NodeEditorCore {
     }
 
     std::vector<int> NodeEvaluator::getEvaluationOrder() {
-        std::vector<int> result;
-        std::unordered_map<int, std::vector<int> > dependencyGraph;
-        std::unordered_map<int, int> inDegree;
+        const EvaluationPlan &plan = m_editor.getEvaluationPlan();
 
-        const auto &allConnections = m_editor.getConnections();
-
-        for (const auto &connection: allConnections) {
-            int startNodeId = connection.startNodeId;
-            int endNodeId = connection.endNodeId;
+        std::vector<int> result;
+        result.reserve(plan.steps.size());
+        for (const auto &step: plan.steps) {
+            result.push_back(step.nodeId);
+        }
 
-            int currentSubgraphId = getCurrentSubgraphId();
-            if (currentSubgraphId >= 0) {
-                const Node *startNode = m_editor.getNode(startNodeId);
-                const Node *endNode = m_editor.getNode(endNodeId);
+        return result;
+    }
 
-                if (!startNode || !endNode ||
-                    !m_editor.isNodeInSubgraph(*startNode, currentSubgraphId) ||
-                    !m_editor.isNodeInSubgraph(*endNode, currentSubgraphId)) {
-                    continue;
+    NodeEvaluator::EvaluationPlan NodeEvaluator::compile() const {
+        EvaluationPlan plan;
+        plan.subgraphId = getCurrentSubgraphId();
+
+        const auto &nodes = m_editor.getNodes();
+        const auto &connections = m_editor.getConnections();
+
+        std::vector<size_t> members;
+        if (plan.subgraphId >= 0) {
+            const Subgraph *subgraph = m_editor.getSubgraph(plan.subgraphId);
+            if (subgraph) {
+                std::unordered_set<int> subgraphNodes(subgraph->nodeIds.begin(), subgraph->nodeIds.end());
+                for (size_t i = 0; i < nodes.size(); ++i) {
+                    if (subgraphNodes.count(nodes[i].id)) {
+                        members.push_back(i);
+                    }
                 }
             }
-
-            if (dependencyGraph.find(startNodeId) == dependencyGraph.end()) {
-                dependencyGraph[startNodeId] = std::vector<int>();
+        } else {
+            members.resize(nodes.size());
+            for (size_t i = 0; i < nodes.size(); ++i) {
+                members[i] = i;
             }
+        }
 
-            if (dependencyGraph.find(endNodeId) == dependencyGraph.end()) {
-                dependencyGraph[endNodeId] = std::vector<int>();
+        std::unordered_map<int, int> localIndex;
+        localIndex.reserve(members.size());
+        for (size_t i = 0; i < members.size(); ++i) {
+            localIndex[nodes[members[i]].id] = static_cast<int>(i);
+        }
+
+        auto pinKey = [](int nodeId, int pinId) {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(nodeId)) << 32) | static_cast<uint32_t>(pinId);
+        };
+
+        std::vector<std::vector<int>> successors(members.size());
+        std::vector<int> inDegree(members.size(), 0);
+        std::vector<bool> scheduled(members.size(), false);
+        std::unordered_map<uint64_t, const NodeEditorCore::Connection *> pinSources;
+        bool hasEdges = false;
+
+        for (const auto &connection: connections) {
+            auto startIt = localIndex.find(connection.startNodeId);
+            auto endIt = localIndex.find(connection.endNodeId);
+            if (startIt == localIndex.end() || endIt == localIndex.end()) {
+                continue;
             }
 
-            dependencyGraph[startNodeId].push_back(endNodeId);
-            inDegree[endNodeId]++;
+            successors[startIt->second].push_back(endIt->second);
+            inDegree[endIt->second]++;
+            scheduled[startIt->second] = true;
+            scheduled[endIt->second] = true;
+            hasEdges = true;
+            pinSources.emplace(pinKey(connection.endNodeId, connection.endPinId), &connection);
         }
 
-        if (dependencyGraph.empty()) {
-            for (const auto &node: m_editor.getNodes()) {
-                int currentSubgraphId = getCurrentSubgraphId();
-                if (currentSubgraphId >= 0 && !m_editor.isNodeInSubgraph(node, currentSubgraphId)) {
-                    continue;
-                }
+        if (!hasEdges) {
+            std::fill(scheduled.begin(), scheduled.end(), true);
+        }
 
-                if (dependencyGraph.find(node.id) == dependencyGraph.end()) {
-                    dependencyGraph[node.id] = std::vector<int>();
+        std::vector<int> order;
+        order.reserve(members.size());
+        for (size_t i = 0; i < members.size(); ++i) {
+            if (scheduled[i] && inDegree[i] == 0) {
+                order.push_back(static_cast<int>(i));
+            }
+        }
+
+        for (size_t head = 0; head < order.size(); ++head) {
+            for (int dependent: successors[order[head]]) {
+                if (--inDegree[dependent] == 0) {
+                    order.push_back(dependent);
                 }
+            }
+        }
 
-                if (node.name == "Input") {
-                    for (const auto &other: m_editor.getNodes()) {
-                        if (currentSubgraphId >= 0 && !m_editor.isNodeInSubgraph(other, currentSubgraphId)) {
-                            continue;
-                        }
+        for (size_t i = 0; i < members.size(); ++i) {
+            if (scheduled[i] && inDegree[i] > 0) {
+                plan.hasCycle = true;
+                order.push_back(static_cast<int>(i));
+            }
+        }
 
-                        if (other.name == "Process") {
-                            dependencyGraph[node.id].push_back(other.id);
-                            inDegree[other.id]++;
-                        }
-                    }
-                } else if (node.name == "Process") {
-                    for (const auto &other: m_editor.getNodes()) {
-                        if (currentSubgraphId >= 0 && !m_editor.isNodeInSubgraph(other, currentSubgraphId)) {
-                            continue;
-                        }
+        std::vector<int> stepOf(members.size(), -1);
+        for (size_t step = 0; step < order.size(); ++step) {
+            stepOf[order[step]] = static_cast<int>(step);
+        }
 
-                        if (other.name == "Output") {
-                            dependencyGraph[node.id].push_back(other.id);
-                            inDegree[other.id]++;
+        plan.steps.reserve(order.size());
+        size_t outputOffset = 0;
+        for (size_t step = 0; step < order.size(); ++step) {
+            const Node &node = nodes[members[order[step]]];
+
+            PlanStep planStep;
+            planStep.nodeId = node.id;
+            planStep.nodeUuid = node.uuid;
+            planStep.firstInput = plan.inputs.size();
+            planStep.inputCount = node.inputs.size();
+            planStep.outputCount = node.outputs.size();
+            planStep.firstOutput = outputOffset;
+            outputOffset += planStep.outputCount;
+
+            for (const auto &pin: node.inputs) {
+                InputSlot slot;
+                slot.pinId = pin.id;
+
+                auto sourceIt = pinSources.find(pinKey(node.id, pin.id));
+                if (sourceIt != pinSources.end()) {
+                    const NodeEditorCore::Connection *connection = sourceIt->second;
+                    int sourceStep = stepOf[localIndex[connection->startNodeId]];
+
+                    slot.connectionId = connection->id;
+                    slot.sourcePinId = connection->startPinId;
+                    if (sourceStep < static_cast<int>(step)) {
+                        slot.sourceStep = sourceStep;
+
+                        const auto &sourceOutputs = nodes[members[order[sourceStep]]].outputs;
+                        for (size_t output = 0; output < sourceOutputs.size(); ++output) {
+                            if (sourceOutputs[output].id == connection->startPinId) {
+                                slot.sourceOutput = static_cast<int>(output);
+                                break;
+                            }
                         }
                     }
                 }
-            }
-        }
 
-        if (dependencyGraph.empty()) {
-            for (const auto &node: m_editor.getNodes()) {
-                int currentSubgraphId = getCurrentSubgraphId();
-                if (currentSubgraphId < 0 || m_editor.isNodeInSubgraph(node, currentSubgraphId)) {
-                    result.push_back(node.id);
-                }
+                plan.inputs.push_back(slot);
             }
-            return result;
-        }
 
-        std::queue<int> q;
-        for (const auto &pair: dependencyGraph) {
-            if (inDegree[pair.first] == 0) {
-                q.push(pair.first);
-            }
+            plan.steps.push_back(std::move(planStep));
         }
 
-        while (!q.empty()) {
-            int current = q.front();
-            q.pop();
-            result.push_back(current);
+        plan.outputSlotCount = outputOffset;
 
-            for (int dependent: dependencyGraph[current]) {
-                if (--inDegree[dependent] == 0) {
-                    q.push(dependent);
-                }
+        for (const auto &slot: plan.inputs) {
+            if (slot.sourceStep >= 0) {
+                plan.steps[slot.sourceStep].dependentCount++;
             }
         }
 
-        std::unordered_set<int> visited(result.begin(), result.end());
-        for (const auto &pair: dependencyGraph) {
-            if (visited.find(pair.first) == visited.end()) {
-                result.push_back(pair.first);
+        size_t dependentOffset = 0;
+        for (auto &planStep: plan.steps) {
+            planStep.firstDependent = dependentOffset;
+            dependentOffset += planStep.dependentCount;
+            planStep.dependentCount = 0;
+        }
+
+        plan.dependents.resize(dependentOffset);
+        for (size_t step = 0; step < plan.steps.size(); ++step) {
+            PlanStep &planStep = plan.steps[step];
+            for (size_t i = 0; i < planStep.inputCount; ++i) {
+                int sourceStep = plan.inputs[planStep.firstInput + i].sourceStep;
+                if (sourceStep < 0) continue;
+
+                PlanStep &source = plan.steps[sourceStep];
+                plan.dependents[source.firstDependent + source.dependentCount++] = step;
+                planStep.dependencyCount++;
             }
         }
 
-        return result;
+        plan.valid = true;
+        return plan;
     }
 }
@@ -7,6 +7,7 @@
 #include <unordered_set>
 #include <queue>
 #include <string>
+#include <cstdint>
 #include "../Core/Types/CoreTypes.h"
 
 namespace NodeEditorCore {
@@ -37,17 +38,52 @@ namespace NodeEditorCore {
             int endPinId;
         };
 
-        NodeEvaluator(NodeEditorCore::NodeEditor &editor) : m_editor(editor) {
+        struct InputSlot {
+            int pinId = -1;
+            int connectionId = -1;
+            int sourceStep = -1;
+            int sourcePinId = -1;
+            int sourceOutput = -1;
+        };
+
+        struct PlanStep {
+            int nodeId = -1;
+            UUID nodeUuid;
+            size_t firstInput = 0;
+            size_t inputCount = 0;
+            size_t outputCount = 0;
+            size_t firstOutput = 0;
+            size_t firstDependent = 0;
+            size_t dependentCount = 0;
+            size_t dependencyCount = 0;
+        };
+
+        struct EvaluationPlan {
+            // Distinct for every compile, so caches built from a plan can tell when it was replaced.
+            uint64_t compileStamp = 0;
+            uint64_t graphVersion = 0;
+            int subgraphId = -1;
+            bool valid = false;
+            bool hasCycle = false;
+            std::vector<PlanStep> steps;
+            std::vector<InputSlot> inputs;
+            std::vector<size_t> dependents;
+            size_t outputSlotCount = 0;
+        };
+
+        NodeEvaluator(const NodeEditorCore::NodeEditor &editor) : m_editor(editor) {
         }
 
         std::vector<int> getEvaluationOrder();
 
-        static std::vector<int> getEvaluationOrder(NodeEditor &editor);
+        EvaluationPlan compile() const;
+
+        static std::vector<int> getEvaluationOrder(const NodeEditor &editor);
 
-        static std::vector<UUID> getEvaluationOrderUUIDs(NodeEditor &editor);
+        static std::vector<UUID> getEvaluationOrderUUIDs(const NodeEditor &editor);
 
     private:
-        NodeEditorCore::NodeEditor &m_editor;
+        const NodeEditorCore::NodeEditor &m_editor;
 
         Connection *getConnection(int connectionId);
 
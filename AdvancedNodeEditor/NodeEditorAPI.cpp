@@ -42,7 +42,8 @@ namespace NodeEditorCore {
                     node->iconSymbol = definition.iconSymbol;
                 }
                 return node;
-            }
+            },
+            true
         );
     }
 
@@ -99,10 +100,10 @@ namespace NodeEditorCore {
         std::unordered_map<std::string, PathSegment> previousSegment;
 
         auto createPathKey = [](const UUID &nodeId, const std::string &pinName, bool isInput) {
-            return nodeId + ":" + pinName + ":" + (isInput ? "in" : "out");
+            return nodeId.toString() + ":" + pinName + ":" + (isInput ? "in" : "out");
         };
 
-        queue.push({startNodeId, outputPinName, false, 0, ""});
+        queue.push({startNodeId, outputPinName, false, 0, UUID()});
         std::string startKey = createPathKey(startNodeId, outputPinName, false);
         visitedPaths[startKey] = {};
 
@@ -141,10 +142,10 @@ namespace NodeEditorCore {
                         std::string interfacePinName;
 
                         if (current.isInput) {
-                            interfaceNodeId = subgraph->metadata.getAttribute<int>("inputNodeId", -1);
+                            interfaceNodeId = subgraph->inputNodeId;
                             interfacePinName = current.pinName;
                         } else {
-                            interfaceNodeId = subgraph->metadata.getAttribute<int>("outputNodeId", -1);
+                            interfaceNodeId = subgraph->outputNodeId;
                             interfacePinName = current.pinName;
                         }
 
@@ -190,7 +191,7 @@ namespace NodeEditorCore {
                             nextPinName,
                             nextIsInput,
                             current.subgraphLevel,
-                            ""
+                            UUID()
                         };
 
                         std::string nextKey = createPathKey(next.nodeUUID, next.pinName, next.isInput);
@@ -217,7 +218,7 @@ namespace NodeEditorCore {
                             nextPinName,
                             nextIsInput,
                             current.subgraphLevel,
-                            ""
+                            UUID()
                         };
 
                         std::string nextKey = createPathKey(next.nodeUUID, next.pinName, next.isInput);
@@ -240,8 +241,8 @@ namespace NodeEditorCore {
                     Subgraph *subgraph = m_editor->getSubgraph(currentSubgraphId);
                     if (subgraph) {
                         int currentNodeId = m_editor->getNodeId(current.nodeUUID);
-                        isInputNode = (subgraph->metadata.getAttribute<int>("inputNodeId", -1) == currentNodeId);
-                        bool isOutputNode = (subgraph->metadata.getAttribute<int>("outputNodeId", -1) == currentNodeId);
+                        isInputNode = (subgraph->inputNodeId == currentNodeId);
+                        bool isOutputNode = (subgraph->outputNodeId == currentNodeId);
                         isInterfaceNode = isInputNode || isOutputNode;
                     }
                 }
@@ -252,7 +253,7 @@ namespace NodeEditorCore {
                         current.pinName,
                         isInputNode ? false : true,
                         current.subgraphLevel - 1,
-                        ""
+                        UUID()
                     };
 
                     std::string parentKey = createPathKey(parentSegment.nodeUUID, parentSegment.pinName,
@@ -337,8 +338,10 @@ namespace NodeEditorCore {
     UUID NodeEditorAPI::createNodeWithPins(const std::string &type, const std::string &name, const Vec2 &position) {
         UUID nodeId = m_editor->addNodeWithUUID(name, type, position);
 
-        if (m_nodeDefinitions.find(type) != m_nodeDefinitions.end()) {
-            const auto &definition = m_nodeDefinitions[type];
+        auto definitionIt = m_nodeDefinitions.find(type);
+        if (definitionIt != m_nodeDefinitions.end()) {
+            const auto &definition = definitionIt->second;
+            m_editor->reservePins(m_editor->getNodeId(nodeId), definition.inputs.size(), definition.outputs.size());
 
             for (const auto &input: definition.inputs) {
                 addPinToNode(nodeId, input.first, true, input.second);
@@ -399,14 +402,14 @@ namespace NodeEditorCore {
         int endNodeRealId = m_editor->getNodeId(endNodeId);
 
         if (startNodeRealId == -1 || endNodeRealId == -1) {
-            return "";
+            return UUID();
         }
 
         int startPinId = findPinIdByName(startNodeId, outputPinName, false);
         int endPinId = findPinIdByName(endNodeId, inputPinName, true);
 
         if (startPinId == -1 || endPinId == -1) {
-            return "";
+            return UUID();
         }
 
         UUID connectionUuid = m_editor->addConnectionWithUUID(startNodeRealId, startPinId, endNodeRealId, endPinId);
@@ -416,17 +419,17 @@ namespace NodeEditorCore {
     UUID NodeEditorAPI::addRerouteToConnection(const UUID& connectionId, const Vec2& position) {
         int connectionRealId = m_editor->getConnectionId(connectionId);
         if (connectionRealId == -1) {
-            return "";
+            return UUID();
         }
         
         int rerouteId = m_editor->addReroute(connectionRealId, position, -1);
         if (rerouteId == -1) {
-            return "";
+            return UUID();
         }
         
         const Reroute* reroute = m_editor->getReroute(rerouteId);
         if (!reroute) {
-            return "";
+            return UUID();
         }
         
         return reroute->uuid;
@@ -442,6 +445,14 @@ namespace NodeEditorCore {
         return true;
     }
 
+    void NodeEditorAPI::beginBatch(size_t nodeCapacity, size_t connectionCapacity) {
+        m_editor->beginBatch(nodeCapacity, connectionCapacity);
+    }
+
+    void NodeEditorAPI::endBatch() {
+        m_editor->endBatch();
+    }
+
     UUID NodeEditorAPI::createGroup(const std::string &name, const Vec2 &position, const Vec2 &size) {
         return m_editor->addGroupWithUUID(name, position, size);
     }
@@ -457,59 +468,433 @@ namespace NodeEditorCore {
     void NodeEditorAPI::registerEvaluator(const std::string &nodeType,
                                           std::function<std::any(const std::vector<std::any> &)> evaluator) {
         m_evaluators[nodeType] = std::move(evaluator);
+        m_cacheInvalidated = true;
+    }
+
+    void NodeEditorAPI::registerPinEvaluator(const std::string &nodeType, PinEvaluator evaluator) {
+        m_pinEvaluators[nodeType] = std::move(evaluator);
+        m_cacheInvalidated = true;
+    }
+
+    void NodeEditorAPI::registerTypedEvaluator(const std::string &nodeType, TypedEvaluator evaluator) {
+        m_typedEvaluators[nodeType] = std::move(evaluator);
+        m_typedDispatchDirty = true;
     }
 
     NodeEditorAPI::EvaluationResult NodeEditorAPI::evaluateGraph(const UUID &outputNodeId) {
         EvaluationResult result;
 
-        std::vector<UUID> evaluationOrderUUIDs = m_editor->getEvaluationOrderUUIDs();
-        result.evaluationOrder = evaluationOrderUUIDs;
+        const NodeEvaluator::EvaluationPlan &plan = m_editor->getEvaluationPlan();
 
-        std::unordered_map<UUID, std::any> nodeValues;
+        result.evaluationOrder.reserve(plan.steps.size());
+        for (const auto &step: plan.steps) {
+            result.evaluationOrder.push_back(step.nodeUuid);
+        }
 
-        for (const auto &nodeUUID: evaluationOrderUUIDs) {
-            Node *node = m_editor->getNodeByUUID(nodeUUID);
-            if (!node) continue;
+        if (m_cacheInvalidated) {
+            m_resultCache.clear();
+            m_cacheInvalidated = false;
+        } else if (m_cachedGraphVersion != plan.graphVersion) {
+            std::unordered_set<int> liveNodes;
+            liveNodes.reserve(plan.steps.size());
+            for (const auto &step: plan.steps) {
+                liveNodes.insert(step.nodeId);
+            }
 
-            std::vector<std::any> inputValues;
+            for (auto it = m_resultCache.begin(); it != m_resultCache.end();) {
+                it = liveNodes.count(it->first) ? std::next(it) : m_resultCache.erase(it);
+            }
+        }
 
-            for (size_t i = 0; i < node->inputs.size(); i++) {
-                const Pin &pin = node->inputs[i];
-                std::any pinValue;
-                bool valueFound = false;
+        // A subgraph switch recompiles the plan without a version bump, and the same node can be wired differently.
+        bool checkInputSources = m_cachedPlanStamp != plan.compileStamp;
+        m_cachedGraphVersion = plan.graphVersion;
+        m_cachedPlanStamp = plan.compileStamp;
+
+        struct StepState {
+            CachedNodeResult *cached = nullptr;
+            const std::any *constant = nullptr;
+            const std::function<std::any(const std::vector<std::any> &)> *evaluator = nullptr;
+            const PinEvaluator *pinEvaluator = nullptr;
+            bool dirty = false;
+            bool recomputed = false;
+        };
 
-                auto connections = m_editor->getInputConnectionsByUUID(nodeUUID);
+        std::vector<StepState> steps(plan.steps.size());
+        int outputStep = -1;
 
-                for (const auto &conn: connections) {
-                    if (conn.targetPinId == pin.id) {
-                        if (nodeValues.count(conn.sourceNodeUuid)) {
-                            pinValue = nodeValues[conn.sourceNodeUuid];
-                            valueFound = true;
-                        }
-                        break;
+        for (size_t stepIndex = 0; stepIndex < plan.steps.size(); stepIndex++) {
+            const auto &step = plan.steps[stepIndex];
+            if (step.nodeUuid == outputNodeId) {
+                outputStep = static_cast<int>(stepIndex);
+            }
+
+            const Node *node = m_editor->getNode(step.nodeId);
+            if (!node) continue;
+
+            StepState &state = steps[stepIndex];
+            state.cached = &m_resultCache[step.nodeId];
+            Handle handle = m_editor->getNodeHandle(step.nodeId);
+            if (state.cached->handle != handle) {
+                *state.cached = CachedNodeResult();
+                state.cached->handle = handle;
+            }
+            state.dirty = !state.cached->valid || m_dirtyNodes.count(step.nodeUuid) > 0;
+
+            auto constantIt = m_constantValues.find(step.nodeUuid);
+            if (constantIt != m_constantValues.end()) {
+                state.constant = &constantIt->second;
+            } else if (auto pinEvaluatorIt = m_pinEvaluators.find(node->type); pinEvaluatorIt != m_pinEvaluators.end()) {
+                state.pinEvaluator = &pinEvaluatorIt->second;
+            } else if (auto evaluatorIt = m_evaluators.find(node->type); evaluatorIt != m_evaluators.end()) {
+                state.evaluator = &evaluatorIt->second;
+            }
+
+            state.cached->inputRevisions.resize(step.inputCount);
+            if (checkInputSources || state.dirty) {
+                auto &inputSources = state.cached->inputSources;
+                inputSources.resize(step.inputCount);
+                for (size_t i = 0; i < step.inputCount; i++) {
+                    const auto &slot = plan.inputs[step.firstInput + i];
+                    std::pair<int, int> source(slot.sourceStep >= 0 ? plan.steps[slot.sourceStep].nodeId : -1,
+                                               slot.sourceStep >= 0 ? slot.sourcePinId : -1);
+                    if (inputSources[i] != source) {
+                        inputSources[i] = source;
+                        state.dirty = true;
                     }
                 }
-
-                inputValues.push_back(pinValue);
             }
+        }
 
-            std::any nodeResult;
+        auto evaluateStep = [this, &plan, &steps](size_t stepIndex) {
+            const auto &step = plan.steps[stepIndex];
+            StepState &state = steps[stepIndex];
+            if (!state.cached) return;
+
+            // Sources may have been recomputed by a different plan (another subgraph), so compare revisions rather
+            // than only looking at what this run recomputed.
+            CachedNodeResult &cached = *state.cached;
+            bool dirty = state.dirty;
+            for (size_t i = 0; i < step.inputCount; i++) {
+                const auto &slot = plan.inputs[step.firstInput + i];
+                const CachedNodeResult *source = slot.sourceStep >= 0 ? steps[slot.sourceStep].cached : nullptr;
+                const uint64_t sourceRevision = source ? source->revision : 0;
+                if (cached.inputRevisions[i] != sourceRevision) {
+                    cached.inputRevisions[i] = sourceRevision;
+                    dirty = true;
+                }
+            }
+            if (!dirty) return;
+
+            cached.outputs.clear();
+
+            if (state.constant) {
+                cached.value = *state.constant;
+            } else if (state.evaluator || state.pinEvaluator) {
+                std::vector<std::any> inputValues;
+                inputValues.reserve(step.inputCount);
+                for (size_t i = 0; i < step.inputCount; i++) {
+                    const auto &slot = plan.inputs[step.firstInput + i];
+                    const CachedNodeResult *source = slot.sourceStep >= 0 ? steps[slot.sourceStep].cached : nullptr;
+                    if (!source) {
+                        inputValues.emplace_back();
+                    } else if (slot.sourceOutput >= 0 && static_cast<size_t>(slot.sourceOutput) < source->outputs.size()) {
+                        inputValues.push_back(source->outputs[slot.sourceOutput]);
+                    } else {
+                        inputValues.push_back(source->value);
+                    }
+                }
 
-            if (m_constantValues.count(nodeUUID)) {
-                nodeResult = m_constantValues[nodeUUID];
-            } else if (m_evaluators.count(node->type)) {
-                nodeResult = m_evaluators[node->type](inputValues);
+                if (state.pinEvaluator) {
+                    cached.outputs.resize(step.outputCount);
+                    (*state.pinEvaluator)(inputValues, cached.outputs);
+                    cached.outputs.resize(step.outputCount);
+                    cached.value = cached.outputs.empty() ? std::any() : cached.outputs.front();
+                } else {
+                    cached.value = (*state.evaluator)(inputValues);
+                }
             } else {
-                nodeResult = std::any();
+                cached.value.reset();
+            }
+
+            cached.valid = true;
+            cached.revision = ++m_resultRevision;
+            state.recomputed = true;
+        };
+
+        if (m_scheduler) {
+            m_scheduler->run(plan, evaluateStep);
+        } else {
+            for (size_t stepIndex = 0; stepIndex < plan.steps.size(); stepIndex++) {
+                evaluateStep(stepIndex);
+            }
+        }
+
+        for (const auto &state: steps) {
+            if (state.recomputed) {
+                result.recomputedNodes++;
+            }
+        }
+
+        // Marks on nodes outside this plan stay until a plan that contains them runs.
+        if (!m_dirtyNodes.empty()) {
+            for (const auto &step: plan.steps) {
+                m_dirtyNodes.erase(step.nodeUuid);
+            }
+        }
+
+        int resultStep = !outputNodeId.empty() && outputStep >= 0 ? outputStep : static_cast<int>(steps.size()) - 1;
+        if (resultStep >= 0) {
+            const CachedNodeResult *cached = steps[resultStep].cached;
+            if (cached) {
+                result.value = cached->value;
+                result.outputValues = cached->outputs.empty()
+                                          ? std::vector<std::any>(plan.steps[resultStep].outputCount, cached->value)
+                                          : cached->outputs;
+            }
+        }
+
+        return result;
+    }
+
+    void NodeEditorAPI::updateTypedDispatch(const NodeEvaluator::EvaluationPlan &plan) {
+        // Arenas always follow the current plan, even when the dispatch table can be reused.
+        m_inputArena.resize(plan.inputs.size());
+        m_outputArena.resize(plan.outputSlotCount);
+
+        if (!m_typedDispatchDirty && m_typedDispatchStamp == plan.compileStamp) {
+            return;
+        }
+
+        m_typedDispatch.assign(plan.steps.size(), nullptr);
+        m_typedConstants.assign(plan.steps.size(), nullptr);
+
+        for (size_t stepIndex = 0; stepIndex < plan.steps.size(); stepIndex++) {
+            const auto &step = plan.steps[stepIndex];
+
+            auto constantIt = m_constantValues.find(step.nodeUuid);
+            if (constantIt != m_constantValues.end()) {
+                m_typedConstants[stepIndex] = &constantIt->second;
+                continue;
+            }
+
+            const Node *node = m_editor->getNode(step.nodeId);
+            if (!node) continue;
+
+            auto evaluatorIt = m_typedEvaluators.find(node->type);
+            if (evaluatorIt != m_typedEvaluators.end()) {
+                m_typedDispatch[stepIndex] = &evaluatorIt->second;
+            }
+        }
+
+        std::fill(m_inputArena.begin(), m_inputArena.end(), EvaluationValue());
+        std::fill(m_outputArena.begin(), m_outputArena.end(), EvaluationValue());
+        m_typedDispatchStamp = plan.compileStamp;
+        m_typedDispatchDirty = false;
+    }
+
+    NodeEditorAPI::TypedEvaluationResult NodeEditorAPI::evaluateGraphTyped(const UUID &outputNodeId) {
+        TypedEvaluationResult result;
+
+        const NodeEvaluator::EvaluationPlan &plan = m_editor->getEvaluationPlan();
+        updateTypedDispatch(plan);
+
+        std::vector<char> evaluated(plan.steps.size(), 0);
+
+        auto evaluateStep = [this, &plan, &evaluated](size_t stepIndex) {
+            const auto &step = plan.steps[stepIndex];
+            std::span<EvaluationValue> outputs(m_outputArena.data() + step.firstOutput, step.outputCount);
+
+            if (const std::any *constant = m_typedConstants[stepIndex]) {
+                EvaluationValue value = EvaluationValue::fromAny(*constant);
+                for (auto &output: outputs) {
+                    output = value;
+                }
+                evaluated[stepIndex] = 1;
+                return;
+            }
+
+            const TypedEvaluator *evaluator = m_typedDispatch[stepIndex];
+            if (!evaluator) {
+                for (auto &output: outputs) {
+                    output = EvaluationValue();
+                }
+                return;
             }
 
-            nodeValues[nodeUUID] = nodeResult;
+            for (size_t i = 0; i < step.inputCount; i++) {
+                const auto &slot = plan.inputs[step.firstInput + i];
+                EvaluationValue &input = m_inputArena[step.firstInput + i];
+                if (slot.sourceStep >= 0 && slot.sourceOutput >= 0) {
+                    input = m_outputArena[plan.steps[slot.sourceStep].firstOutput + slot.sourceOutput];
+                } else {
+                    input = EvaluationValue();
+                }
+            }
+
+            std::span<const EvaluationValue> inputs(m_inputArena.data() + step.firstInput, step.inputCount);
+            (*evaluator)(inputs, outputs);
+            evaluated[stepIndex] = 1;
+        };
+
+        if (m_scheduler) {
+            m_scheduler->run(plan, evaluateStep);
+        } else {
+            for (size_t stepIndex = 0; stepIndex < plan.steps.size(); stepIndex++) {
+                evaluateStep(stepIndex);
+            }
+        }
+
+        for (char wasEvaluated: evaluated) {
+            result.evaluatedNodes += wasEvaluated ? 1 : 0;
         }
 
-        if (!outputNodeId.empty() && nodeValues.count(outputNodeId)) {
-            result.value = nodeValues[outputNodeId];
-        } else if (!evaluationOrderUUIDs.empty()) {
-            result.value = nodeValues[evaluationOrderUUIDs.back()];
+        int resultStep = static_cast<int>(plan.steps.size()) - 1;
+        if (!outputNodeId.empty()) {
+            for (size_t stepIndex = 0; stepIndex < plan.steps.size(); stepIndex++) {
+                if (plan.steps[stepIndex].nodeUuid == outputNodeId) {
+                    resultStep = static_cast<int>(stepIndex);
+                    break;
+                }
+            }
+        }
+
+        if (resultStep >= 0) {
+            const auto &step = plan.steps[resultStep];
+            result.outputValues.assign(m_outputArena.begin() + step.firstOutput,
+                                       m_outputArena.begin() + step.firstOutput + step.outputCount);
+            if (!result.outputValues.empty()) {
+                result.value = result.outputValues.front();
+            }
+        }
+
+        return result;
+    }
+
+    void NodeEditorAPI::registerBatchEvaluator(const std::string &nodeType, BatchEvaluator evaluator) {
+        m_batchEvaluators[nodeType] = std::move(evaluator);
+    }
+
+    void NodeEditorAPI::registerBuiltinBatchEvaluators() {
+        registerBatchEvaluator("Math.Add", BatchKernels::addEvaluator);
+        registerBatchEvaluator("Math.Multiply", BatchKernels::multiplyEvaluator);
+        registerBatchEvaluator("Math.Subtract", BatchKernels::subtractEvaluator);
+    }
+
+    NodeEditorAPI::BatchEvaluationResult NodeEditorAPI::evaluateGraphBatch(
+        const std::unordered_map<UUID, std::span<const float>> &constantColumns, size_t laneCount,
+        const UUID &outputNodeId) {
+        BatchEvaluationResult result;
+        result.laneCount = laneCount;
+        if (laneCount == 0) return result;
+
+        const NodeEvaluator::EvaluationPlan &plan = m_editor->getEvaluationPlan();
+        updateTypedDispatch(plan);
+
+        m_batchArena.resize(plan.outputSlotCount * laneCount);
+        m_batchZeroColumn.assign(laneCount, 0.0f);
+        m_batchSlots.assign(plan.outputSlotCount, m_batchZeroColumn.data());
+        m_batchInputs.resize(plan.inputs.size());
+
+        std::vector<const BatchEvaluator *> batchDispatch(plan.steps.size(), nullptr);
+        for (size_t stepIndex = 0; stepIndex < plan.steps.size(); stepIndex++) {
+            if (m_typedConstants[stepIndex]) continue;
+
+            const Node *node = m_editor->getNode(plan.steps[stepIndex].nodeId);
+            if (!node) continue;
+
+            auto evaluatorIt = m_batchEvaluators.find(node->type);
+            if (evaluatorIt != m_batchEvaluators.end()) {
+                batchDispatch[stepIndex] = &evaluatorIt->second;
+            }
+        }
+
+        auto evaluateStep = [this, &plan, &constantColumns, &batchDispatch, laneCount](size_t stepIndex) {
+            const auto &step = plan.steps[stepIndex];
+            std::vector<float *> outputs(step.outputCount);
+            for (size_t i = 0; i < step.outputCount; i++) {
+                outputs[i] = m_batchArena.data() + (step.firstOutput + i) * laneCount;
+                m_batchSlots[step.firstOutput + i] = outputs[i];
+            }
+
+            auto columnIt = constantColumns.find(step.nodeUuid);
+            if (columnIt != constantColumns.end() && columnIt->second.size() >= laneCount) {
+                for (size_t i = 0; i < step.outputCount; i++) {
+                    m_batchSlots[step.firstOutput + i] = columnIt->second.data();
+                }
+                return;
+            }
+
+            if (const std::any *constant = m_typedConstants[stepIndex]) {
+                float value = EvaluationValue::fromAny(*constant).asFloat();
+                for (float *output: outputs) {
+                    BatchKernels::fill(output, value, laneCount);
+                }
+                return;
+            }
+
+            for (size_t i = 0; i < step.inputCount; i++) {
+                const auto &slot = plan.inputs[step.firstInput + i];
+                m_batchInputs[step.firstInput + i] = slot.sourceStep >= 0 && slot.sourceOutput >= 0
+                                                         ? m_batchSlots[plan.steps[slot.sourceStep].firstOutput +
+                                                                        slot.sourceOutput]
+                                                         : m_batchZeroColumn.data();
+            }
+            std::span<const float *const> inputs(m_batchInputs.data() + step.firstInput, step.inputCount);
+
+            if (const BatchEvaluator *evaluator = batchDispatch[stepIndex]) {
+                (*evaluator)(inputs, std::span<float *const>(outputs), laneCount);
+                return;
+            }
+
+            const TypedEvaluator *typedEvaluator = m_typedDispatch[stepIndex];
+            if (!typedEvaluator) {
+                for (float *output: outputs) {
+                    BatchKernels::fill(output, 0.0f, laneCount);
+                }
+                return;
+            }
+
+            std::vector<EvaluationValue> laneInputs(step.inputCount);
+            std::vector<EvaluationValue> laneOutputs(step.outputCount);
+            for (size_t lane = 0; lane < laneCount; lane++) {
+                for (size_t i = 0; i < step.inputCount; i++) {
+                    laneInputs[i] = inputs[i][lane];
+                }
+                (*typedEvaluator)(laneInputs, laneOutputs);
+                for (size_t i = 0; i < step.outputCount; i++) {
+                    outputs[i][lane] = laneOutputs[i].asFloat();
+                }
+            }
+        };
+
+        if (m_scheduler) {
+            m_scheduler->run(plan, evaluateStep);
+        } else {
+            for (size_t stepIndex = 0; stepIndex < plan.steps.size(); stepIndex++) {
+                evaluateStep(stepIndex);
+            }
+        }
+
+        int resultStep = static_cast<int>(plan.steps.size()) - 1;
+        if (!outputNodeId.empty()) {
+            for (size_t stepIndex = 0; stepIndex < plan.steps.size(); stepIndex++) {
+                if (plan.steps[stepIndex].nodeUuid == outputNodeId) {
+                    resultStep = static_cast<int>(stepIndex);
+                    break;
+                }
+            }
+        }
+
+        if (resultStep >= 0) {
+            const auto &step = plan.steps[resultStep];
+            for (size_t i = 0; i < step.outputCount; i++) {
+                const float *column = m_batchSlots[step.firstOutput + i];
+                result.outputValues.emplace_back(column, column + laneCount);
+            }
+            if (!result.outputValues.empty()) {
+                result.values = result.outputValues.front();
+            }
         }
 
         return result;
@@ -517,6 +902,32 @@ namespace NodeEditorCore {
 
     void NodeEditorAPI::setConstantValue(const UUID &nodeId, const std::any &value) {
         m_constantValues[nodeId] = value;
+        m_dirtyNodes.insert(nodeId);
+        m_typedDispatchDirty = true;
+    }
+
+    void NodeEditorAPI::setEvaluationThreadCount(size_t threadCount) {
+        if (threadCount == 0) {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        if (threadCount <= 1) {
+            m_scheduler.reset();
+        } else if (!m_scheduler || m_scheduler->getThreadCount() != threadCount) {
+            m_scheduler = std::make_unique<EvaluationScheduler>(threadCount);
+        }
+    }
+
+    size_t NodeEditorAPI::getEvaluationThreadCount() const {
+        return m_scheduler ? m_scheduler->getThreadCount() : 1;
+    }
+
+    void NodeEditorAPI::invalidateEvaluation(const UUID &nodeId) {
+        if (nodeId.empty()) {
+            m_cacheInvalidated = true;
+        } else {
+            m_dirtyNodes.insert(nodeId);
+        }
     }
 
     std::any NodeEditorAPI::getConstantValue(const UUID &nodeId) const {
@@ -2,12 +2,17 @@
 #define NODE_EDITOR_API_ROBUST_H
 
 #include "Core/NodeEditor.h"
+#include "Evaluation/EvaluationScheduler.h"
+#include "Evaluation/EvaluationValue.h"
+#include "Evaluation/BatchKernels.h"
 #include <functional>
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <any>
+#include <atomic>
 
 namespace NodeEditorCore {
 
@@ -25,7 +30,23 @@ public:
 
     struct EvaluationResult {
         std::any value;
+        std::vector<std::any> outputValues;
         std::vector<UUID> evaluationOrder;
+        size_t recomputedNodes = 0;
+    };
+
+    using PinEvaluator = std::function<void(const std::vector<std::any>& inputs, std::vector<std::any>& outputs)>;
+
+    struct TypedEvaluationResult {
+        EvaluationValue value;
+        std::vector<EvaluationValue> outputValues;
+        size_t evaluatedNodes = 0;
+    };
+
+    struct BatchEvaluationResult {
+        size_t laneCount = 0;
+        std::vector<float> values;
+        std::vector<std::vector<float>> outputValues;
     };
 
     NodeEditorAPI();
@@ -77,6 +98,9 @@ public:
                      const UUID& endNodeId, const std::string& inputPinName);
     bool disconnectNodes(const UUID& connectionId);
 
+    void beginBatch(size_t nodeCapacity = 0, size_t connectionCapacity = 0);
+    void endBatch();
+
     UUID addRerouteToConnection(const UUID& connectionId, const Vec2& position);
 
     UUID createGroup(const std::string& name, const Vec2& position, const Vec2& size);
@@ -85,10 +109,20 @@ public:
 
     void registerEvaluator(const std::string& nodeType,
                           std::function<std::any(const std::vector<std::any>&)> evaluator);
-    EvaluationResult evaluateGraph(const UUID& outputNodeId = "");
+    void registerPinEvaluator(const std::string& nodeType, PinEvaluator evaluator);
+    void registerTypedEvaluator(const std::string& nodeType, TypedEvaluator evaluator);
+    EvaluationResult evaluateGraph(const UUID& outputNodeId = UUID());
+    TypedEvaluationResult evaluateGraphTyped(const UUID& outputNodeId = UUID());
+    void registerBatchEvaluator(const std::string& nodeType, BatchEvaluator evaluator);
+    void registerBuiltinBatchEvaluators();
+    BatchEvaluationResult evaluateGraphBatch(const std::unordered_map<UUID, std::span<const float>>& constantColumns,
+                                             size_t laneCount, const UUID& outputNodeId = UUID());
 
     void setConstantValue(const UUID& nodeId, const std::any& value);
     std::any getConstantValue(const UUID& nodeId) const;
+    void invalidateEvaluation(const UUID& nodeId = UUID());
+    void setEvaluationThreadCount(size_t threadCount);
+    size_t getEvaluationThreadCount() const;
 
     void setNodeCreatedCallback(std::function<void(const UUID&)> callback);
     void setNodeRemovedCallback(std::function<void(const UUID&)> callback);
@@ -101,10 +135,45 @@ public:
 
 private:
     std::unique_ptr<NodeEditor> m_editor;
-    std::unordered_map<std::string, std::function<std::any(const std::vector<std::any>&)>> m_evaluators;
+    std::unordered_map<Symbol, std::function<std::any(const std::vector<std::any>&)>> m_evaluators;
+    std::unordered_map<Symbol, PinEvaluator> m_pinEvaluators;
     std::unordered_map<UUID, std::any> m_constantValues;
     std::unordered_map<std::string, NodeDefinition> m_nodeDefinitions;
 
+    struct CachedNodeResult {
+        std::any value;
+        std::vector<std::any> outputs;
+        std::vector<std::pair<int, int>> inputSources;
+        std::vector<uint64_t> inputRevisions;
+        uint64_t revision = 0;
+        Handle handle;
+        bool valid = false;
+    };
+
+    std::unordered_map<int, CachedNodeResult> m_resultCache;
+    std::unordered_set<UUID> m_dirtyNodes;
+    std::atomic<uint64_t> m_resultRevision{0};
+    uint64_t m_cachedGraphVersion = 0;
+    uint64_t m_cachedPlanStamp = 0;
+    bool m_cacheInvalidated = true;
+    std::unique_ptr<EvaluationScheduler> m_scheduler;
+
+    std::unordered_map<Symbol, TypedEvaluator> m_typedEvaluators;
+    std::vector<EvaluationValue> m_inputArena;
+    std::vector<EvaluationValue> m_outputArena;
+    std::vector<const TypedEvaluator*> m_typedDispatch;
+    std::vector<const std::any*> m_typedConstants;
+    uint64_t m_typedDispatchStamp = 0;
+    bool m_typedDispatchDirty = true;
+
+    std::unordered_map<Symbol, BatchEvaluator> m_batchEvaluators;
+    std::vector<float> m_batchArena;
+    std::vector<float> m_batchZeroColumn;
+    std::vector<const float*> m_batchSlots;
+    std::vector<const float*> m_batchInputs;
+
+    void updateTypedDispatch(const NodeEvaluator::EvaluationPlan& plan);
+
     UUID createNodeWithPins(const std::string& type, const std::string& name, const Vec2& position);
     int findPinIdByName(const UUID& nodeId, const std::string& pinName, bool isInput);
 };
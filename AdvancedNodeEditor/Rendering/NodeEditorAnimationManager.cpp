@@ -1,4 +1,5 @@
 #include "NodeEditorAnimationManager.h"
+#include "../Utils/MemoryAccounting.h"
 #include <algorithm>
 #include <cmath>
 
@@ -140,4 +141,16 @@ namespace NodeEditorCore {
         state.connectionGlowAngle = 0.0f;
         state.lastConnectedPinType = pinType;
     }
+
+    void AnimationManager::removeNode(int nodeId) {
+        m_nodeAnimations.erase(nodeId);
+    }
+
+    void AnimationManager::removeConnection(int connectionId) {
+        m_connectionAnimations.erase(connectionId);
+    }
+
+    size_t AnimationManager::getMemoryUsage() const {
+        return MemoryAccounting::heapBytes(m_nodeAnimations) + MemoryAccounting::heapBytes(m_connectionAnimations);
+    }
 }
@@ -44,6 +44,13 @@ namespace NodeEditorCore {
         void activateConnectionFlow(int connectionId, bool infinite = true, float duration = 3.0f);
         void deactivateConnectionFlow(int connectionId);
 
+        void removeNode(int nodeId);
+        void removeConnection(int connectionId);
+
+        size_t getNodeAnimationCount() const { return m_nodeAnimations.size(); }
+        size_t getConnectionAnimationCount() const { return m_connectionAnimations.size(); }
+        size_t getMemoryUsage() const;
+
         void updateNodePositions(std::vector<Node>& nodes, float deltaTime);
         void updateConnectionFlows(std::vector<Connection>& connections, float deltaTime);
 
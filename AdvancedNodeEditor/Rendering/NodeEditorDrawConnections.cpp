@@ -5,10 +5,16 @@ namespace NodeEditorCore {
     void NodeEditor::drawConnections(ImDrawList *drawList, const ImVec2 &canvasPos) {
         if (!drawList) return;
 
-        std::vector<Connection> visibleConnections = getVisibleConnections();
+        collectVisibleConnections(m_cullMin, m_cullMax, m_connectionIndexScratch);
 
-        for (const auto &connection: visibleConnections) {
-            drawSingleConnection(drawList, connection, canvasPos);
+        const DetailLevel detail = getDetailLevel();
+        for (uint32_t connectionIndex: m_connectionIndexScratch) {
+            const Connection &connection = m_state.connections[connectionIndex];
+            if (detail == DetailLevel::Full) {
+                drawSingleConnection(drawList, connection, canvasPos);
+            } else {
+                drawReducedConnection(drawList, connection, detail);
+            }
         }
 
         if (m_state.connecting && m_state.connectingNodeId != -1 && m_state.connectingPinId != -1) {
@@ -16,70 +22,53 @@ namespace NodeEditorCore {
         }
     }
 
-    std::vector<Connection> NodeEditor::getVisibleConnections() const {
-        std::vector<Connection> visibleConnections;
-        const int currentSubgraphId = m_state.currentSubgraphId;
-
-        for (const auto &connection: m_state.connections) {
-            const Node *startNode = getNode(connection.startNodeId);
-            const Node *endNode = getNode(connection.endNodeId);
-
-            if (!startNode || !endNode) continue;
+    void NodeEditor::drawSingleConnection(ImDrawList *drawList, const Connection &connection, const ImVec2 &canvasPos) {
+        const ConnectionGeometryCache::Geometry *geometry = connectionGeometry(connection);
+        if (!geometry) return;
 
-            bool startInCurrentSubgraph = (currentSubgraphId >= 0 && startNode->getSubgraphId() == currentSubgraphId) ||
-                                          (currentSubgraphId == -1 && startNode->getSubgraphId() == -1);
+        const Pin *startPin = getNode(connection.startNodeId)->findPin(connection.startPinId);
+        const Pin *endPin = getNode(connection.endNodeId)->findPin(connection.endPinId);
 
-            bool endInCurrentSubgraph = (currentSubgraphId >= 0 && endNode->getSubgraphId() == currentSubgraphId) ||
-                                        (currentSubgraphId == -1 && endNode->getSubgraphId() == -1);
+        Color startCol = getPinConnectionColor(*startPin);
+        Color endCol = getPinConnectionColor(*endPin);
 
-            if (startInCurrentSubgraph && endInCurrentSubgraph) {
-                visibleConnections.push_back(connection);
+        if (geometry->key.shape == ConnectionGeometryCache::Shape::Curve) {
+            m_connectionPointScratch.clear();
+            for (const auto &point: geometry->polyline) {
+                m_connectionPointScratch.push_back(canvasToScreen(point).toImVec2());
             }
+
+            m_connectionStyleManager.drawConnectionPath(
+                drawList, m_connectionPointScratch.data(), static_cast<int>(m_connectionPointScratch.size()),
+                connection.selected, m_state.hoveredConnectionId == connection.id,
+                startCol, endCol, m_state.viewScale
+            );
+        } else {
+            drawConnectionSegments(drawList, connection, *geometry, startCol, endCol);
         }
 
-        return visibleConnections;
+        drawConnectionAnimation(drawList, connection, *geometry, startCol, endCol);
     }
 
-    void NodeEditor::drawSingleConnection(ImDrawList *drawList, const Connection &connection, const ImVec2 &canvasPos) {
-        const Node *startNode = getNode(connection.startNodeId);
-        const Node *endNode = getNode(connection.endNodeId);
-
-        if (!startNode || !endNode) return;
-
-        const Pin *startPin = startNode->findPin(connection.startPinId);
-        const Pin *endPin = endNode->findPin(connection.endPinId);
-
-        if (!startPin || !endPin) return;
+    void NodeEditor::drawReducedConnection(ImDrawList *drawList, const Connection &connection, DetailLevel detail) {
+        // Minimal detail runs straight through the endpoints and reroutes, so curves are never flattened for it.
+        const bool straight = detail == DetailLevel::Minimal;
+        const ConnectionGeometryCache::Geometry *geometry = connectionGeometry(connection, !straight);
+        if (!geometry) return;
 
-        Pin apiStartPin;
-        apiStartPin.id = startPin->id;
-        apiStartPin.name = startPin->name;
-        apiStartPin.isInput = startPin->isInput;
-        apiStartPin.type = static_cast<PinType>(startPin->type);
-        apiStartPin.shape = static_cast<PinShape>(startPin->shape);
+        const Pin *startPin = getNode(connection.startNodeId)->findPin(connection.startPinId);
+        const Pin *endPin = getNode(connection.endNodeId)->findPin(connection.endPinId);
 
-        Pin apiEndPin;
-        apiEndPin.id = endPin->id;
-        apiEndPin.name = endPin->name;
-        apiEndPin.isInput = endPin->isInput;
-        apiEndPin.type = static_cast<PinType>(endPin->type);
-        apiEndPin.shape = static_cast<PinShape>(endPin->shape);
-
-        ImVec2 p1 = getPinPos(*startNode, apiStartPin, canvasPos);
-        ImVec2 p2 = getPinPos(*endNode, apiEndPin, canvasPos);
-
-        Color startCol = getPinConnectionColor(*startPin);
-        Color endCol = getPinConnectionColor(*endPin);
-
-        std::vector<Reroute> reroutes = getReroutesForConnection(connection.id);
-
-        if (reroutes.empty()) {
-            drawConnectionLine(drawList, p1, p2, connection, apiStartPin, apiEndPin, startCol, endCol);
-        } else {
-            drawConnectionWithReroutes(drawList, connection, p1, p2, startCol, endCol);
+        m_connectionPointScratch.clear();
+        for (const auto &point: straight ? geometry->points : geometry->polyline) {
+            m_connectionPointScratch.push_back(canvasToScreen(point).toImVec2());
         }
 
-        drawConnectionAnimation(drawList, p1, p2, connection, apiStartPin, apiEndPin, startCol, endCol);
+        m_connectionStyleManager.drawSimplifiedPath(
+            drawList, m_connectionPointScratch.data(), static_cast<int>(m_connectionPointScratch.size()),
+            connection.selected, m_state.hoveredConnectionId == connection.id,
+            getPinConnectionColor(*startPin), getPinConnectionColor(*endPin), m_state.viewScale
+        );
     }
 
     Color NodeEditor::getPinConnectionColor(const Pin &pin) const {
@@ -97,198 +86,28 @@ namespace NodeEditorCore {
         );
     }
 
-    void NodeEditor::drawConnectionLine(ImDrawList *drawList, const ImVec2 &p1, const ImVec2 &p2,
-                                      const Connection &connection, const Pin &startPin, const Pin &endPin,
-                                      const Color &startCol, const Color &endCol) {
-        m_connectionStyleManager.drawConnection(
-            drawList, p1, p2,
-            startPin.isInput, endPin.isInput,
-            connection.selected, m_state.hoveredConnectionId == connection.id,
-            startCol, endCol, m_state.viewScale
-        );
-    }
-
-    void NodeEditor::drawConnectionAnimation(ImDrawList *drawList, const ImVec2 &p1, const ImVec2 &p2,
-                                           const Connection &connection, const Pin &startPin, const Pin &endPin,
+    void NodeEditor::drawConnectionAnimation(ImDrawList *drawList, const Connection &connection,
+                                           const ConnectionGeometryCache::Geometry &geometry,
                                            const Color &startCol, const Color &endCol) {
         auto& connAnimState = m_animationManager.getConnectionAnimationState(connection.id);
 
         if (connAnimState.flowSpeed <= 0.0f) return;
 
-        std::vector<ImVec2> pathPoints;
-        std::vector<Reroute> reroutes = getReroutesForConnection(connection.id);
-
-        if (reroutes.empty()) {
-            pathPoints = calculateAnimationPath(p1, p2, startPin, endPin, connAnimState);
-        } else {
-            updateConnectionAnimationWithReroutes(connection, p1, p2, connAnimState, pathPoints);
-        }
-
-        if (pathPoints.empty()) return;
-
-        renderAnimationParticles(drawList, pathPoints, startCol, endCol);
-    }
-
-    std::vector<ImVec2> NodeEditor::calculateAnimationPath(const ImVec2 &p1, const ImVec2 &p2,
-                                                         const Pin &startPin, const Pin &endPin,
-                                                         const ConnectionAnimationState &animState) const {
-        std::vector<ImVec2> pathPoints;
+        const float length = geometry.length();
+        if (length <= 0.0f) return;
 
-        ConnectionStyleManager::ConnectionStyle style = m_connectionStyleManager.getDefaultStyle();
         const int particleCount = 5;
-
-        switch (style) {
-            case ConnectionStyleManager::ConnectionStyle::Bezier:
-                pathPoints = calculateBezierAnimationPath(p1, p2, startPin, endPin, animState, particleCount);
-                break;
-
-            case ConnectionStyleManager::ConnectionStyle::StraightLine:
-                pathPoints = calculateStraightAnimationPath(p1, p2, animState, particleCount);
-                break;
-
-            case ConnectionStyleManager::ConnectionStyle::AngleLine:
-                pathPoints = calculateAngleAnimationPath(p1, p2, animState, particleCount);
-                break;
-
-            case ConnectionStyleManager::ConnectionStyle::MetroLine:
-                pathPoints = calculateMetroAnimationPath(p1, p2, animState, particleCount);
-                break;
-
-            default:
-                pathPoints = calculateStraightAnimationPath(p1, p2, animState, particleCount);
-                break;
-        }
-
-        return pathPoints;
-    }
-
-    std::vector<ImVec2> NodeEditor::calculateBezierAnimationPath(const ImVec2 &p1, const ImVec2 &p2,
-                                                               const Pin &startPin, const Pin &endPin,
-                                                               const ConnectionAnimationState &animState, int particleCount) const {
         std::vector<ImVec2> pathPoints;
-
-        const float distance = std::sqrt(std::pow(p2.x - p1.x, 2) + std::pow(p2.y - p1.y, 2));
-        const float tension = m_connectionStyleManager.getConfig().curveTension;
-        const float cpDistance = distance * tension;
-
-        ImVec2 cp1, cp2;
-        if (startPin.isInput) {
-            cp1 = ImVec2(p1.x, p1.y - cpDistance);
-        } else {
-            cp1 = ImVec2(p1.x, p1.y + cpDistance);
-        }
-
-        if (endPin.isInput) {
-            cp2 = ImVec2(p2.x, p2.y - cpDistance);
-        } else {
-            cp2 = ImVec2(p2.x, p2.y + cpDistance);
-        }
+        pathPoints.reserve(particleCount);
 
         for (int i = 0; i < particleCount; i++) {
-            float t = (animState.flowAnimation + (float)i / particleCount) -
-                    std::floor(animState.flowAnimation + (float)i / particleCount);
-
-            float u = 1.0f - t;
-            float w1 = u * u * u;
-            float w2 = 3 * u * u * t;
-            float w3 = 3 * u * t * t;
-            float w4 = t * t * t;
-
-            ImVec2 particlePos(
-                w1 * p1.x + w2 * cp1.x + w3 * cp2.x + w4 * p2.x,
-                w1 * p1.y + w2 * cp1.y + w3 * cp2.y + w4 * p2.y
-            );
-
-            pathPoints.push_back(particlePos);
-        }
-
-        return pathPoints;
-    }
-
-    std::vector<ImVec2> NodeEditor::calculateStraightAnimationPath(const ImVec2 &p1, const ImVec2 &p2,
-                                                                 const ConnectionAnimationState &animState, int particleCount) const {
-        std::vector<ImVec2> pathPoints;
-
-        for (int i = 0; i < particleCount; i++) {
-            float t = (animState.flowAnimation + (float)i / particleCount) -
-                    std::floor(animState.flowAnimation + (float)i / particleCount);
-
-            ImVec2 particlePos = ImVec2(
-                p1.x + (p2.x - p1.x) * t,
-                p1.y + (p2.y - p1.y) * t
-            );
-            pathPoints.push_back(particlePos);
-        }
-
-        return pathPoints;
-    }
-
-    std::vector<ImVec2> NodeEditor::calculateAngleAnimationPath(const ImVec2 &p1, const ImVec2 &p2,
-                                                              const ConnectionAnimationState &animState, int particleCount) const {
-        std::vector<ImVec2> pathPoints;
-        ImVec2 middle = ImVec2(p2.x, p1.y);
-
-        for (int i = 0; i < particleCount; i++) {
-            float t = (animState.flowAnimation + (float)i / particleCount) -
-                    std::floor(animState.flowAnimation + (float)i / particleCount);
-
-            ImVec2 particlePos;
-            if (t < 0.5f) {
-                float segmentT = t * 2.0f;
-                particlePos = ImVec2(
-                    p1.x + (middle.x - p1.x) * segmentT,
-                    p1.y + (middle.y - p1.y) * segmentT
-                );
-            } else {
-                float segmentT = (t - 0.5f) * 2.0f;
-                particlePos = ImVec2(
-                    middle.x + (p2.x - middle.x) * segmentT,
-                    middle.y + (p2.y - middle.y) * segmentT
-                );
-            }
-            pathPoints.push_back(particlePos);
-        }
-
-        return pathPoints;
-    }
-
-    std::vector<ImVec2> NodeEditor::calculateMetroAnimationPath(const ImVec2 &p1, const ImVec2 &p2,
-                                                              const ConnectionAnimationState &animState, int particleCount) const {
-        std::vector<ImVec2> pathPoints;
-
-        float dx = p2.x - p1.x;
-        float dy = p2.y - p1.y;
-
-        ImVec2 middle1, middle2;
-        if (std::abs(dx) > std::abs(dy)) {
-            middle1 = ImVec2(p1.x + dx * 0.5f, p1.y);
-            middle2 = ImVec2(p1.x + dx * 0.5f, p2.y);
-        } else {
-            middle1 = ImVec2(p1.x, p1.y + dy * 0.5f);
-            middle2 = ImVec2(p2.x, p1.y + dy * 0.5f);
-        }
-
-        std::vector<ImVec2> metroPoints = {p1, middle1, middle2, p2};
-
-        for (int i = 0; i < particleCount; i++) {
-            float t = (animState.flowAnimation + (float)i / particleCount) -
-                    std::floor(animState.flowAnimation + (float)i / particleCount);
-
-            float segmentLength = 1.0f / (metroPoints.size() - 1);
-            int segment = std::min(static_cast<int>(t / segmentLength),
-                                static_cast<int>(metroPoints.size()) - 2);
-
-            float segmentT = (t - segment * segmentLength) / segmentLength;
-
-            ImVec2 particlePos = ImVec2(
-                metroPoints[segment].x + (metroPoints[segment + 1].x - metroPoints[segment].x) * segmentT,
-                metroPoints[segment].y + (metroPoints[segment + 1].y - metroPoints[segment].y) * segmentT
-            );
+            float t = connAnimState.flowAnimation + static_cast<float>(i) / particleCount;
+            t = t - std::floor(t);
 
-            pathPoints.push_back(particlePos);
+            pathPoints.push_back(canvasToScreen(geometry.pointAtDistance(t * length)).toImVec2());
         }
 
-        return pathPoints;
+        renderAnimationParticles(drawList, pathPoints, startCol, endCol);
     }
 
     void NodeEditor::renderAnimationParticles(ImDrawList *drawList, const std::vector<ImVec2> &pathPoints,
@@ -330,87 +149,20 @@ namespace NodeEditorCore {
         }
     }
 
-    void NodeEditor::drawConnectionWithReroutes(ImDrawList *drawList, const Connection &connection,
-                                              const ImVec2 &p1, const ImVec2 &p2,
-                                              const Color &startCol, const Color &endCol) {
-        std::vector<Reroute> reroutes = getReroutesForConnection(connection.id);
-
-        if (reroutes.empty()) {
-            const Node* startNode = getNode(connection.startNodeId);
-            const Node* endNode = getNode(connection.endNodeId);
-            if (!startNode || !endNode) return;
-
-            const Pin* startPin = startNode->findPin(connection.startPinId);
-            const Pin* endPin = endNode->findPin(connection.endPinId);
-            if (!startPin || !endPin) return;
-
-            Pin apiStartPin;
-            apiStartPin.id = startPin->id;
-            apiStartPin.isInput = startPin->isInput;
-            apiStartPin.type = static_cast<PinType>(startPin->type);
-
-            Pin apiEndPin;
-            apiEndPin.id = endPin->id;
-            apiEndPin.isInput = endPin->isInput;
-            apiEndPin.type = static_cast<PinType>(endPin->type);
-
-            m_connectionStyleManager.drawConnection(
-                drawList, p1, p2,
-                apiStartPin.isInput, apiEndPin.isInput,
-                connection.selected, m_state.hoveredConnectionId == connection.id,
-                startCol, endCol, m_state.viewScale
-            );
-            return;
-        }
-
-        const Node* startNode = getNode(connection.startNodeId);
-        const Node* endNode = getNode(connection.endNodeId);
-        if (!startNode || !endNode) return;
-
-        const Pin* startPin = startNode->findPin(connection.startPinId);
-        const Pin* endPin = endNode->findPin(connection.endPinId);
-        if (!startPin || !endPin) return;
-
-        Pin apiStartPin;
-        apiStartPin.id = startPin->id;
-        apiStartPin.isInput = startPin->isInput;
-        apiStartPin.type = static_cast<PinType>(startPin->type);
-
-        Pin apiEndPin;
-        apiEndPin.id = endPin->id;
-        apiEndPin.isInput = endPin->isInput;
-        apiEndPin.type = static_cast<PinType>(endPin->type);
-
-        std::vector<ImVec2> pathPoints;
-        pathPoints.push_back(p1);
-
-        for (const auto& reroute : reroutes) {
-            Vec2 rerouteScreenPos = canvasToScreen(reroute.position);
-            pathPoints.push_back(rerouteScreenPos.toImVec2());
-        }
-
-        pathPoints.push_back(p2);
+    void NodeEditor::drawConnectionSegments(ImDrawList *drawList, const Connection &connection,
+                                          const ConnectionGeometryCache::Geometry &geometry,
+                                          const Color &startCol, const Color &endCol) {
+        const std::vector<Vec2> &pathPoints = geometry.points;
 
         bool isSelected = connection.selected;
         bool isHovered = m_state.hoveredConnectionId == connection.id;
 
         for (size_t i = 0; i < pathPoints.size() - 1; i++) {
-            ImVec2 segmentStart = pathPoints[i];
-            ImVec2 segmentEnd = pathPoints[i + 1];
+            ImVec2 segmentStart = canvasToScreen(pathPoints[i]).toImVec2();
+            ImVec2 segmentEnd = canvasToScreen(pathPoints[i + 1]).toImVec2();
 
-            bool segmentStartInput, segmentEndInput;
-
-            if (i == 0) {
-                segmentStartInput = apiStartPin.isInput;
-            } else {
-                segmentStartInput = false;
-            }
-
-            if (i == pathPoints.size() - 2) {
-                segmentEndInput = apiEndPin.isInput;
-            } else {
-                segmentEndInput = true;
-            }
+            bool segmentStartInput = i == 0 ? geometry.startInput : false;
+            bool segmentEndInput = i == pathPoints.size() - 2 ? geometry.endInput : true;
 
             Color segmentStartCol = startCol;
             Color segmentEndCol = endCol;
@@ -442,64 +194,97 @@ namespace NodeEditorCore {
         }
     }
 
-    void NodeEditor::updateConnectionAnimationWithReroutes(const Connection& connection, const ImVec2& p1, const ImVec2& p2,
-                                                          const ConnectionAnimationState& animState,
-                                                          std::vector<ImVec2>& particlePoints) const {
-        std::vector<ImVec2> pathPoints = getConnectionPathWithReroutes(connection, p1, p2);
-
-        if (pathPoints.size() < 2) return;
+    bool NodeEditor::buildConnectionPath(const Connection &connection,
+                                         ConnectionGeometryCache::Geometry &geometry) const {
+        const Node *startNode = getNode(connection.startNodeId);
+        const Node *endNode = getNode(connection.endNodeId);
+        if (!startNode || !endNode) return false;
 
-        float totalLength = 0.0f;
-        std::vector<float> segmentLengths;
+        const Pin *startPin = startNode->findPin(connection.startPinId);
+        const Pin *endPin = endNode->findPin(connection.endPinId);
 
-        for (size_t i = 0; i < pathPoints.size() - 1; i++) {
-            float dx = pathPoints[i + 1].x - pathPoints[i].x;
-            float dy = pathPoints[i + 1].y - pathPoints[i].y;
-            float length = sqrt(dx * dx + dy * dy);
-            segmentLengths.push_back(length);
-            totalLength += length;
+        Vec2 start, end;
+        if (!startPin || !endPin || !pinCanvasPosition(*startNode, startPin->id, start) ||
+            !pinCanvasPosition(*endNode, endPin->id, end)) {
+            return false;
         }
 
-        const int particleCount = 5;
-        particlePoints.clear();
-
-        for (int i = 0; i < particleCount; i++) {
-            float t = (animState.flowAnimation + (float)i / particleCount);
-            t = t - std::floor(t);
-
-            float targetDistance = t * totalLength;
-            float currentDistance = 0.0f;
-
-            for (size_t j = 0; j < segmentLengths.size(); j++) {
-                if (currentDistance + segmentLengths[j] >= targetDistance) {
-                    float segmentT = (targetDistance - currentDistance) / segmentLengths[j];
-
-                    ImVec2 particlePos = ImVec2(
-                        pathPoints[j].x + (pathPoints[j + 1].x - pathPoints[j].x) * segmentT,
-                        pathPoints[j].y + (pathPoints[j + 1].y - pathPoints[j].y) * segmentT
-                    );
-
-                    particlePoints.push_back(particlePos);
-                    break;
-                }
-                currentDistance += segmentLengths[j];
+        geometry.key.graphVersion = m_state.graphVersion;
+        geometry.key.tension = m_connectionStyleManager.getConfig().curveTension;
+        geometry.key.shape = connectionShape();
+        geometry.startInput = startPin->isInput;
+        geometry.endInput = endPin->isInput;
+
+        geometry.points.clear();
+        geometry.points.push_back(start);
+        if (!m_reroutes.empty()) {
+            for (uint32_t index: rerouteIndicesForConnection(connection.id)) {
+                geometry.points.push_back(m_reroutes[index].position);
             }
         }
-    }
-
-    std::vector<ImVec2> NodeEditor::getConnectionPathWithReroutes(const Connection& connection, const ImVec2& p1, const ImVec2& p2) const {
-        std::vector<ImVec2> pathPoints;
-        std::vector<Reroute> reroutes = getReroutesForConnection(connection.id);
+        geometry.points.push_back(end);
 
-        pathPoints.push_back(p1);
+        ConnectionGeometryCache::build(geometry);
+        return true;
+    }
 
-        for (const auto& reroute : reroutes) {
-            Vec2 rerouteScreenPos = canvasToScreen(reroute.position);
-            pathPoints.push_back(rerouteScreenPos.toImVec2());
+    ConnectionGeometryCache::Shape NodeEditor::connectionShape() const {
+        switch (m_connectionStyleManager.getDefaultStyle()) {
+            case ConnectionStyleManager::ConnectionStyle::StraightLine:
+                return ConnectionGeometryCache::Shape::Straight;
+            case ConnectionStyleManager::ConnectionStyle::AngleLine:
+                return ConnectionGeometryCache::Shape::Angle;
+            case ConnectionStyleManager::ConnectionStyle::MetroLine:
+                return ConnectionGeometryCache::Shape::Metro;
+            default:
+                return ConnectionGeometryCache::Shape::Curve;
         }
+    }
 
-        pathPoints.push_back(p2);
+    const ConnectionGeometryCache::Geometry *NodeEditor::connectionGeometry(const Connection &connection,
+                                                                            bool flattened) const {
+        if (connection.id < 0) return nullptr;
+
+        const uint32_t startIndex = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(connection.startNodeId));
+        const uint32_t endIndex = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(connection.endNodeId));
+        if (startIndex >= m_state.nodes.size() || endIndex >= m_state.nodes.size()) return nullptr;
+
+        // Node stamps only describe the endpoints while the geometry store is in sync with them; a node
+        // moved since the last sync is built uncached.
+        auto synced = [this](uint32_t index) {
+            const Node &node = m_state.nodes[index];
+            return m_nodeGeometry.x()[index] == node.position.x && m_nodeGeometry.y()[index] == node.position.y &&
+                   m_nodeGeometry.width()[index] == node.size.x && m_nodeGeometry.height()[index] == node.size.y;
+        };
+        const bool tracked = m_nodeGeometryVersion == m_state.graphVersion &&
+                             m_nodeGeometry.size() == m_state.nodes.size() && synced(startIndex) && synced(endIndex);
+        const uint64_t startStamp = tracked ? m_nodeGeometry.stamps()[startIndex] : 0;
+        const uint64_t endStamp = tracked ? m_nodeGeometry.stamps()[endIndex] : 0;
+
+        ConnectionGeometryCache::Key key;
+        key.graphVersion = m_state.graphVersion;
+        key.startStamp = startStamp;
+        key.endStamp = endStamp;
+        key.tension = m_connectionStyleManager.getConfig().curveTension;
+        key.shape = connectionShape();
+
+        ConnectionGeometryCache::Geometry &geometry = m_connectionGeometry.slot(static_cast<uint32_t>(connection.id));
+        const bool current = geometry.valid && geometry.key == key;
+
+        if (!current || !tracked) {
+            if (!buildConnectionPath(connection, geometry)) {
+                geometry.valid = false;
+                return nullptr;
+            }
+            geometry.key.startStamp = startStamp;
+            geometry.key.endStamp = endStamp;
+            geometry.valid = tracked;
+        }
 
-        return pathPoints;
+        // Curves are hit-tested analytically; the other shapes are measured against their corner polyline.
+        if (flattened || geometry.key.shape != ConnectionGeometryCache::Shape::Curve) {
+            ConnectionGeometryCache::flatten(geometry);
+        }
+        return &geometry;
     }
-}
\ No newline at end of file
+}
@@ -3,17 +3,24 @@
 
 namespace NodeEditorCore {
     void NodeEditor::drawGroups(ImDrawList *drawList, const ImVec2 &canvasPos) {
-        std::vector<Group> visibleGroups;
+        std::vector<const Group *> visibleGroups;
         int currentSubgraphId = m_state.currentSubgraphId;
 
         for (const auto &group: m_state.groups) {
+            if (group.position.x > m_cullMax.x || group.position.y > m_cullMax.y ||
+                group.position.x + group.size.x < m_cullMin.x || group.position.y + group.size.y < m_cullMin.y) {
+                continue;
+            }
+
             if ((currentSubgraphId == -1 && group.getSubgraphId() == -1) ||
                 (currentSubgraphId >= 0 && group.getSubgraphId() == currentSubgraphId)) {
-                visibleGroups.push_back(group);
+                visibleGroups.push_back(&group);
             }
         }
 
-        for (const auto &group: visibleGroups) {
+        const DetailLevel detail = getDetailLevel();
+        for (const Group *visibleGroup: visibleGroups) {
+            const Group &group = *visibleGroup;
             ImVec2 groupPos = canvasToScreen(group.position).toImVec2();
             ImVec2 groupSize = Vec2(group.size.x * m_state.viewScale, group.size.y * m_state.viewScale).toImVec2();
 
@@ -22,6 +29,15 @@ namespace NodeEditorCore {
             ImU32 titleColor = IM_COL32(220, 220, 240, 255);
             float titleHeight = 20.0f * m_state.viewScale;
 
+            if (detail == DetailLevel::Minimal) {
+                drawList->AddRect(
+                    groupPos,
+                    ImVec2(groupPos.x + groupSize.x, groupPos.y + groupSize.y),
+                    borderColor, 0.0f, 0, 1.0f
+                );
+                continue;
+            }
+
             drawList->AddRectFilled(
                 groupPos,
                 ImVec2(groupPos.x + groupSize.x, groupPos.y + groupSize.y),
@@ -40,6 +56,8 @@ namespace NodeEditorCore {
                 IM_COL32(50, 50, 60, 230), 4.0f, ImDrawFlags_RoundCornersTop
             );
 
+            if (detail == DetailLevel::Simplified) continue;
+
             ImVec2 textSize = ImGui::CalcTextSize(group.name.c_str());
             drawList->AddText(
                 ImVec2(groupPos.x + (groupSize.x - textSize.x) * 0.5f, groupPos.y + (titleHeight - textSize.y) * 0.5f),
@@ -3,40 +3,26 @@
 
 namespace NodeEditorCore {
     void NodeEditor::drawNodes(ImDrawList *drawList, const ImVec2 &canvasPos) {
-    std::vector<Node*> visibleNodes;
     int currentSubgraphId = m_state.currentSubgraphId;
 
-    for (auto &node : m_state.nodes) {
-        bool shouldDraw = false;
+    const NodeGeometryStore &geometry = nodeGeometry();
+    const DetailLevel detail = getDetailLevel();
+    std::vector<uint32_t> visibleNodes;
+    collectVisibleNodes(m_cullMin, m_cullMax, visibleNodes);
 
-        if (currentSubgraphId >= 0) {
-            shouldDraw = (node.getSubgraphId() == currentSubgraphId);
-        } else {
-            shouldDraw = (node.getSubgraphId() == -1);
-        }
+    std::stable_partition(visibleNodes.begin(), visibleNodes.end(),
+        [&geometry](uint32_t index) { return !geometry.isSelected(index); });
 
-        if (shouldDraw) {
-            visibleNodes.push_back(&node);
-        }
-    }
-
-    std::stable_sort(visibleNodes.begin(), visibleNodes.end(),
-        [](const Node *a, const Node *b) {
-            if (a->selected && !b->selected) return false;
-            if (!a->selected && b->selected) return true;
-            return false;
-        });
-
-    for (Node* nodePtr : visibleNodes) {
-        const Node& node = *nodePtr;
+    for (uint32_t nodeIndex : visibleNodes) {
+        const Node& node = m_state.nodes[nodeIndex];
         bool isInputNode = false;
         bool isOutputNode = false;
 
         if (currentSubgraphId >= 0) {
             Subgraph *subgraph = getSubgraph(currentSubgraphId);
             if (subgraph) {
-                int inputNodeId = subgraph->metadata.getAttribute<int>("inputNodeId", -1);
-                int outputNodeId = subgraph->metadata.getAttribute<int>("outputNodeId", -1);
+                int inputNodeId = subgraph->inputNodeId;
+                int outputNodeId = subgraph->outputNodeId;
 
                 isInputNode = (node.id == inputNodeId);
                 isOutputNode = (node.id == outputNodeId);
@@ -46,6 +32,11 @@ namespace NodeEditorCore {
         ImVec2 nodePos = canvasToScreen(node.position).toImVec2();
         ImVec2 nodeSize = Vec2(node.size.x * m_state.viewScale, node.size.y * m_state.viewScale).toImVec2();
 
+        if (detail != DetailLevel::Full) {
+            drawReducedNode(drawList, node, nodePos, nodeSize, detail, isInputNode, isOutputNode);
+            continue;
+        }
+
         const float cornerRadius = 4.0f * m_state.viewScale;
         const float headerHeight = 14.0f * m_state.viewScale;
         const float accentLineHeight = 1.0f * m_state.viewScale;
@@ -73,80 +64,14 @@ namespace NodeEditorCore {
             executionPulseIntensity = std::sin(nodeAnimState.executionPulse * 3.14159f * 2.0f) * 0.5f + 0.5f;
         }
 
-        ImU32 baseColor, headerColor, accentColor, borderColor, selectedColor, hoveredColor, glowColor;
-
-        if (isInputNode) {
-            baseColor = IM_COL32(30, 80, 30, 230);
-            headerColor = IM_COL32(20, 60, 20, 230);
-            accentColor = IM_COL32(80, 180, 80, 255);
-            borderColor = IM_COL32(40, 100, 40, 200);
-            selectedColor = IM_COL32(100, 200, 100, 200);
-            hoveredColor = IM_COL32(60, 150, 60, 180);
-            glowColor = IM_COL32(40, 120, 40, 120);
-        } else if (isOutputNode) {
-            baseColor = IM_COL32(80, 30, 30, 230);
-            headerColor = IM_COL32(60, 20, 20, 230);
-            accentColor = IM_COL32(180, 80, 80, 255);
-            borderColor = IM_COL32(100, 40, 40, 200);
-            selectedColor = IM_COL32(200, 100, 100, 200);
-            hoveredColor = IM_COL32(150, 60, 60, 180);
-            glowColor = IM_COL32(120, 40, 40, 120);
-        } else {
-            const internal::NodeColors &nodeColors = m_state.style.nodeColors.count(node.type)
-                                                         ? m_state.style.nodeColors.at(node.type)
-                                                         : m_state.style.nodeColors.at("Default");
-
-            baseColor = IM_COL32(
-                nodeColors.base.r * 255,
-                nodeColors.base.g * 255,
-                nodeColors.base.b * 255,
-                nodeColors.base.a * 255
-            );
+        const NodePalette palette = resolveNodePalette(node, isInputNode, isOutputNode);
+        ImU32 baseColor = palette.base;
+        ImU32 headerColor = palette.header;
+        ImU32 accentColor = palette.accent;
+        ImU32 actualSelectedColor = palette.selected;
+        ImU32 hoveredColor = palette.hovered;
 
-            headerColor = IM_COL32(
-                nodeColors.header.r * 255,
-                nodeColors.header.g * 255,
-                nodeColors.header.b * 255,
-                nodeColors.header.a * 255
-            );
-
-            accentColor = IM_COL32(
-                nodeColors.accent.r * 255,
-                nodeColors.accent.g * 255,
-                nodeColors.accent.b * 255,
-                nodeColors.accent.a * 255
-            );
-
-            borderColor = IM_COL32(
-                nodeColors.border.r * 255,
-                nodeColors.border.g * 255,
-                nodeColors.border.b * 255,
-                nodeColors.border.a * 255
-            );
-
-            selectedColor = IM_COL32(
-                nodeColors.selected.r * 255,
-                nodeColors.selected.g * 255,
-                nodeColors.selected.b * 255,
-                nodeColors.selected.a * 255
-            );
-
-            hoveredColor = IM_COL32(
-                nodeColors.hovered.r * 255,
-                nodeColors.hovered.g * 255,
-                nodeColors.hovered.b * 255,
-                nodeColors.hovered.a * 255
-            );
-
-            glowColor = IM_COL32(
-                nodeColors.glow.r * 255,
-                nodeColors.glow.g * 255,
-                nodeColors.glow.b * 255,
-                nodeColors.glow.a * 255
-            );
-        }
-
-        if (executionPulseIntensity > 0.0f) {
+        if (executionPulseIntensity > 0.0f && !node.disabled) {
             ImVec4 baseColorVec4 = ImGui::ColorConvertU32ToFloat4(baseColor);
             ImVec4 accentColorVec4 = ImGui::ColorConvertU32ToFloat4(accentColor);
 
@@ -162,16 +87,6 @@ namespace NodeEditorCore {
             accentColor = ImGui::ColorConvertFloat4ToU32(accentColorVec4);
         }
 
-        if (node.disabled) {
-            baseColor = IM_COL32(40, 40, 40, 180);
-            headerColor = IM_COL32(30, 30, 35, 180);
-            accentColor = IM_COL32(70, 70, 80, 150);
-            borderColor = IM_COL32(60, 60, 60, 180);
-        }
-
-        bool isSelectable = isNodeSelectableForDelete(node.id);
-        ImU32 actualSelectedColor = isSelectable ? selectedColor : IM_COL32(100, 100, 100, 150);
-
         if (node.selected || isHovered) {
             float glowSize = node.selected ? 8.0f : 6.0f;
 
@@ -608,10 +523,87 @@ namespace NodeEditorCore {
     }
 }
 
+    NodeEditor::NodePalette NodeEditor::resolveNodePalette(const Node &node, bool isInputNode,
+                                                           bool isOutputNode) const {
+        NodePalette palette;
+
+        if (isInputNode) {
+            palette.base = IM_COL32(30, 80, 30, 230);
+            palette.header = IM_COL32(20, 60, 20, 230);
+            palette.accent = IM_COL32(80, 180, 80, 255);
+            palette.border = IM_COL32(40, 100, 40, 200);
+            palette.selected = IM_COL32(100, 200, 100, 200);
+            palette.hovered = IM_COL32(60, 150, 60, 180);
+            palette.glow = IM_COL32(40, 120, 40, 120);
+        } else if (isOutputNode) {
+            palette.base = IM_COL32(80, 30, 30, 230);
+            palette.header = IM_COL32(60, 20, 20, 230);
+            palette.accent = IM_COL32(180, 80, 80, 255);
+            palette.border = IM_COL32(100, 40, 40, 200);
+            palette.selected = IM_COL32(200, 100, 100, 200);
+            palette.hovered = IM_COL32(150, 60, 60, 180);
+            palette.glow = IM_COL32(120, 40, 40, 120);
+        } else {
+            const internal::NodeColors &nodeColors = m_state.style.nodeColors.count(node.type)
+                                                         ? m_state.style.nodeColors.at(node.type)
+                                                         : m_state.style.nodeColors.at("Default");
+            palette.base = nodeColors.base.toImU32();
+            palette.header = nodeColors.header.toImU32();
+            palette.accent = nodeColors.accent.toImU32();
+            palette.border = nodeColors.border.toImU32();
+            palette.selected = nodeColors.selected.toImU32();
+            palette.hovered = nodeColors.hovered.toImU32();
+            palette.glow = nodeColors.glow.toImU32();
+        }
+
+        if (node.disabled) {
+            palette.base = IM_COL32(40, 40, 40, 180);
+            palette.header = IM_COL32(30, 30, 35, 180);
+            palette.accent = IM_COL32(70, 70, 80, 150);
+            palette.border = IM_COL32(60, 60, 60, 180);
+        }
+
+        if (!isNodeSelectableForDelete(node.id)) {
+            palette.selected = IM_COL32(100, 100, 100, 150);
+        }
+
+        return palette;
+    }
+
+    void NodeEditor::drawReducedNode(ImDrawList *drawList, const Node &node, const ImVec2 &nodePos,
+                                     const ImVec2 &nodeSize, DetailLevel detail, bool isInputNode, bool isOutputNode) {
+        const NodePalette palette = resolveNodePalette(node, isInputNode, isOutputNode);
+        const ImU32 baseColor = palette.base;
+        const ImU32 headerColor = palette.header;
+        const ImU32 borderColor = palette.border;
+        const ImU32 selectedColor = palette.selected;
+
+        const ImVec2 nodeMax(nodePos.x + nodeSize.x, nodePos.y + nodeSize.y);
+
+        if (detail == DetailLevel::Minimal) {
+            drawList->AddRectFilled(nodePos, nodeMax, node.selected ? selectedColor : baseColor);
+            return;
+        }
+
+        const float cornerRadius = 4.0f * m_state.viewScale;
+        const float headerHeight = 14.0f * m_state.viewScale;
+
+        drawList->AddRectFilled(nodePos, nodeMax, baseColor, cornerRadius);
+        drawList->AddRectFilled(
+            nodePos,
+            ImVec2(nodeMax.x, nodePos.y + headerHeight),
+            headerColor, cornerRadius, ImDrawFlags_RoundCornersTop
+        );
+        drawList->AddRect(
+            nodePos, nodeMax,
+            node.selected ? selectedColor : borderColor, cornerRadius, 0, node.selected ? 2.0f : 1.0f
+        );
+    }
+
     bool NodeEditor::isNodeSelectableForDelete(int nodeId) const {
         for (const auto &subgraphPair: m_subgraphs) {
-            int inputNodeId = subgraphPair.second->metadata.getAttribute<int>("inputNodeId", -1);
-            int outputNodeId = subgraphPair.second->metadata.getAttribute<int>("outputNodeId", -1);
+            int inputNodeId = subgraphPair.second->inputNodeId;
+            int outputNodeId = subgraphPair.second->outputNodeId;
 
             if (nodeId == inputNodeId || nodeId == outputNodeId) {
                 return false;
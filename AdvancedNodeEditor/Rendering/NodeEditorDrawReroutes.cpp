@@ -31,136 +31,21 @@ std::pair<ImVec2, ImVec2> NodeEditor::calculateBezierControlPoints(
 }
 
 float NodeEditor::getDistanceToConnection(const Connection& connection, const ImVec2& mousePos, const ImVec2& canvasPos, int& insertIndex) const {
-    const Node* startNode = getNode(connection.startNodeId);
-    const Node* endNode = getNode(connection.endNodeId);
-
-    if (!startNode || !endNode) {
-        return FLT_MAX;
-    }
-
-    const Pin* startPin = startNode->findPin(connection.startPinId);
-    const Pin* endPin = endNode->findPin(connection.endPinId);
-
-    if (!startPin || !endPin) {
-        return FLT_MAX;
-    }
-
-    Pin apiStartPin;
-    apiStartPin.id = startPin->id;
-    apiStartPin.isInput = startPin->isInput;
-    apiStartPin.type = static_cast<PinType>(startPin->type);
-
-    Pin apiEndPin;
-    apiEndPin.id = endPin->id;
-    apiEndPin.isInput = endPin->isInput;
-    apiEndPin.type = static_cast<PinType>(endPin->type);
-
-    ImVec2 p1 = getPinPos(*startNode, apiStartPin, canvasPos);
-    ImVec2 p2 = getPinPos(*endNode, apiEndPin, canvasPos);
-
-    std::vector<ImVec2> pathPoints = getConnectionPathWithReroutesForDetection(connection, canvasPos);
-
-    ConnectionStyleManager::ConnectionStyle style = m_connectionStyleManager.getDefaultStyle();
-    float minDistance = FLT_MAX;
     insertIndex = 0;
 
-    const float tension = m_connectionStyleManager.getConfig().curveTension;
-
-    for (size_t i = 0; i < pathPoints.size() - 1; i++) {
-        ImVec2 segStart = pathPoints[i];
-        ImVec2 segEnd = pathPoints[i + 1];
-        float segmentDistance = FLT_MAX;
-
-        bool segmentStartInput, segmentEndInput;
-
-        if (i == 0) {
-            segmentStartInput = startPin->isInput;
-        } else {
-            segmentStartInput = false;
-        }
-
-        if (i == pathPoints.size() - 2) {
-            segmentEndInput = endPin->isInput;
-        } else {
-            segmentEndInput = true;
-        }
-
-        switch (style) {
-            case ConnectionStyleManager::ConnectionStyle::Bezier: {
-                auto [cp1, cp2] = calculateBezierControlPoints(segStart, segEnd, segmentStartInput, segmentEndInput, tension);
-                segmentDistance = getDistanceToBezierCubic(mousePos, segStart, cp1, cp2, segEnd);
-                break;
-            }
-
-            case ConnectionStyleManager::ConnectionStyle::AngleLine: {
-                ImVec2 middle = ImVec2(segEnd.x, segStart.y);
-                float dist1 = getDistanceToLineSegment(mousePos, segStart, middle);
-                float dist2 = getDistanceToLineSegment(mousePos, middle, segEnd);
-                segmentDistance = std::min(dist1, dist2);
-                break;
-            }
-
-            case ConnectionStyleManager::ConnectionStyle::MetroLine: {
-                float dx = segEnd.x - segStart.x;
-                float dy = segEnd.y - segStart.y;
-
-                ImVec2 middle1, middle2;
-                if (std::abs(dx) > std::abs(dy)) {
-                    middle1 = ImVec2(segStart.x + dx * 0.5f, segStart.y);
-                    middle2 = ImVec2(segStart.x + dx * 0.5f, segEnd.y);
-                } else {
-                    middle1 = ImVec2(segStart.x, segStart.y + dy * 0.5f);
-                    middle2 = ImVec2(segEnd.x, segStart.y + dy * 0.5f);
-                }
-
-                float dist1 = getDistanceToLineSegment(mousePos, segStart, middle1);
-                float dist2 = getDistanceToLineSegment(mousePos, middle1, middle2);
-                float dist3 = getDistanceToLineSegment(mousePos, middle2, segEnd);
-                segmentDistance = std::min({dist1, dist2, dist3});
-                break;
-            }
-
-            default:
-                segmentDistance = getDistanceToLineSegment(mousePos, segStart, segEnd);
-                break;
-        }
-
-        if (segmentDistance < minDistance) {
-            minDistance = segmentDistance;
-            insertIndex = static_cast<int>(i);
-        }
+    const ConnectionGeometryCache::Geometry* geometry = connectionGeometry(connection, false);
+    if (!geometry) {
+        return FLT_MAX;
     }
 
-    return minDistance;
+    const Vec2 canvasMouse = screenToCanvas(Vec2(mousePos.x, mousePos.y));
+    const float distance = geometry->distanceTo(canvasMouse, insertIndex);
+    return distance == FLT_MAX ? FLT_MAX : distance * m_state.viewScale;
 }
 
 float NodeEditor::getDistanceToBezierCubic(const ImVec2& point, const ImVec2& p0, const ImVec2& p1, const ImVec2& p2, const ImVec2& p3) const {
-    float minDistance = FLT_MAX;
-
-    const int samples = 50;
-
-    ImVec2 prev = p0;
-    for (int i = 1; i <= samples; i++) {
-        float t = static_cast<float>(i) / samples;
-
-        float u = 1.0f - t;
-        float w1 = u * u * u;
-        float w2 = 3 * u * u * t;
-        float w3 = 3 * u * t * t;
-        float w4 = t * t * t;
-
-        ImVec2 current(
-            w1 * p0.x + w2 * p1.x + w3 * p2.x + w4 * p3.x,
-            w1 * p0.y + w2 * p1.y + w3 * p2.y + w4 * p3.y
-        );
-
-        float dist = getDistanceToLineSegment(point, prev, current);
-        minDistance = std::min(minDistance, dist);
-
-        prev = current;
-    }
-
-    return minDistance;
+    return CurveDistance::toCubic(Vec2::fromImVec2(point), Vec2::fromImVec2(p0), Vec2::fromImVec2(p1),
+                                  Vec2::fromImVec2(p2), Vec2::fromImVec2(p3));
 }
 
 float NodeEditor::getDistanceToLineSegment(const ImVec2& point, const ImVec2& lineStart, const ImVec2& lineEnd) const {
@@ -211,26 +96,20 @@ void NodeEditor::processRerouteInteraction(const ImVec2& mousePos) {
             return;
         }
 
-        for (const auto& connection : m_state.connections) {
-            if (!isNodeInCurrentSubgraph(*getNode(connection.startNodeId)) ||
-                !isNodeInCurrentSubgraph(*getNode(connection.endNodeId))) continue;
-
-            int insertIndex;
-            float distance = getDistanceToConnection(connection, mousePos, ImVec2(0, 0), insertIndex);
+        ensureSpatialIndex();
+        const Vec2 canvasMouse = screenToCanvas(Vec2(mousePos.x, mousePos.y));
+        const Vec2 reach(12.0f, 12.0f);
+        collectVisibleConnections(canvasMouse - reach, canvasMouse + reach, m_connectionIndexScratch);
 
-            const float clickThreshold = 12.0f * m_state.viewScale;
+        int insertIndex;
+        const int connectionIndex = findConnectionWithin(canvasMouse, reach.x, insertIndex);
+        if (connectionIndex >= 0) {
+            int newRerouteId = addReroute(m_state.connections[connectionIndex].id, canvasMouse, insertIndex);
 
-            if (distance <= clickThreshold) {
-                Vec2 canvasPos = screenToCanvas(Vec2(mousePos.x, mousePos.y));
-                int newRerouteId = addReroute(connection.id, canvasPos, insertIndex);
-
-                selectReroute(newRerouteId);
-                m_activeRerouteId = newRerouteId;
-                m_state.interactionMode = InteractionMode::DragReroute;
-                m_state.dragStart = Vec2(mousePos.x, mousePos.y);
-
-                return;
-            }
+            selectReroute(newRerouteId);
+            m_activeRerouteId = newRerouteId;
+            m_state.interactionMode = InteractionMode::DragReroute;
+            m_state.dragStart = Vec2(mousePos.x, mousePos.y);
         }
     }
 
@@ -271,6 +150,8 @@ int NodeEditor::addReroute(int connectionId, const Vec2& position, int insertInd
 
     Reroute newReroute(rerouteId, connectionId, position, insertIndex);
     m_reroutes.push_back(newReroute);
+    m_rerouteOrderDirty = true;
+    m_connectionGeometry.invalidate(static_cast<uint32_t>(connectionId));
 
     return rerouteId;
 }
@@ -284,6 +165,8 @@ void NodeEditor::removeReroute(int rerouteId) {
         int removedIndex = it->index;
 
         m_reroutes.erase(it);
+        m_rerouteOrderDirty = true;
+        m_connectionGeometry.invalidate(static_cast<uint32_t>(connectionId));
 
         for (auto& reroute : m_reroutes) {
             if (reroute.connectionId == connectionId && reroute.index > removedIndex) {
@@ -300,20 +183,38 @@ void NodeEditor::removeAllReroutesFromConnection(int connectionId) {
             [connectionId](const Reroute& r) { return r.connectionId == connectionId; }),
         m_reroutes.end()
     );
+    if (m_reroutes.size() != count) {
+        m_rerouteOrderDirty = true;
+    }
+    m_connectionGeometry.invalidate(static_cast<uint32_t>(connectionId));
 }
 
-std::vector<Reroute> NodeEditor::getReroutesForConnection(int connectionId) const {
-    std::vector<Reroute> result;
-
-    for (const auto& reroute : m_reroutes) {
-        if (reroute.connectionId == connectionId) {
-            result.push_back(reroute);
+std::span<const uint32_t> NodeEditor::rerouteIndicesForConnection(int connectionId) const {
+    if (m_rerouteOrderDirty || m_rerouteOrder.size() != m_reroutes.size()) {
+        m_rerouteOrder.resize(m_reroutes.size());
+        for (size_t i = 0; i < m_reroutes.size(); ++i) {
+            m_rerouteOrder[i] = static_cast<uint32_t>(i);
         }
+        std::sort(m_rerouteOrder.begin(), m_rerouteOrder.end(), [this](uint32_t a, uint32_t b) {
+            const Reroute& lhs = m_reroutes[a];
+            const Reroute& rhs = m_reroutes[b];
+            return lhs.connectionId != rhs.connectionId ? lhs.connectionId < rhs.connectionId : lhs.index < rhs.index;
+        });
+        m_rerouteOrderDirty = false;
     }
 
-    std::sort(result.begin(), result.end(),
-        [](const Reroute& a, const Reroute& b) { return a.index < b.index; });
+    auto first = std::lower_bound(m_rerouteOrder.begin(), m_rerouteOrder.end(), connectionId,
+        [this](uint32_t index, int id) { return m_reroutes[index].connectionId < id; });
+    auto last = std::upper_bound(first, m_rerouteOrder.end(), connectionId,
+        [this](int id, uint32_t index) { return id < m_reroutes[index].connectionId; });
+    return {first, last};
+}
 
+std::vector<Reroute> NodeEditor::getReroutesForConnection(int connectionId) const {
+    std::vector<Reroute> result;
+    for (uint32_t index : rerouteIndicesForConnection(connectionId)) {
+        result.push_back(m_reroutes[index]);
+    }
     return result;
 }
 
@@ -330,7 +231,11 @@ const Reroute* NodeEditor::getReroute(int rerouteId) const {
 }
 
 void NodeEditor::drawReroutes(ImDrawList* drawList, const ImVec2& canvasPos) {
-    for (const auto& reroute : m_reroutes) {
+    m_rerouteSpatialIndex.query(m_cullMin, m_cullMax, m_rerouteIndexScratch);
+
+    for (uint32_t rerouteIndex : m_rerouteIndexScratch) {
+        const Reroute& reroute = m_reroutes[rerouteIndex];
+
         const Connection* connection = getConnection(reroute.connectionId);
         if (!connection) continue;
 
@@ -400,20 +305,20 @@ void NodeEditor::updateRerouteHover(const ImVec2& mousePos, const ImVec2& canvas
     for (auto& reroute : m_reroutes) {
         reroute.hoveredInner = false;
         reroute.hoveredOuter = false;
+    }
 
-        RerouteHitZone hitZone = getRerouteHitZone(reroute, mousePos, canvasPos);
+    RerouteHitZone hitZone;
+    int rerouteIndex = findRerouteIndexAtPosition(mousePos, hitZone);
+    if (rerouteIndex < 0) return;
 
-        if (hitZone != RerouteHitZone::None) {
-            m_hoveredRerouteId = reroute.id;
-            m_rerouteHitZone = hitZone;
+    Reroute& reroute = m_reroutes[rerouteIndex];
+    m_hoveredRerouteId = reroute.id;
+    m_rerouteHitZone = hitZone;
 
-            if (hitZone == RerouteHitZone::Inner) {
-                reroute.hoveredInner = true;
-            } else if (hitZone == RerouteHitZone::Outer) {
-                reroute.hoveredOuter = true;
-            }
-            break;
-        }
+    if (hitZone == RerouteHitZone::Inner) {
+        reroute.hoveredInner = true;
+    } else if (hitZone == RerouteHitZone::Outer) {
+        reroute.hoveredOuter = true;
     }
 }
 
@@ -425,6 +330,21 @@ void NodeEditor::processRerouteDrag(const ImVec2& mousePos) {
 
     Vec2 newCanvasPos = screenToCanvas(Vec2(mousePos.x, mousePos.y));
     reroute->position = newCanvasPos;
+    m_connectionGeometry.invalidate(static_cast<uint32_t>(reroute->connectionId));
+
+    const uint32_t rerouteIndex = static_cast<uint32_t>(reroute - m_reroutes.data());
+    if (m_rerouteSpatialIndex.contains(rerouteIndex)) {
+        const Vec2 extent(rerouteSpatialRadius(), rerouteSpatialRadius());
+        m_rerouteSpatialIndex.update(rerouteIndex, newCanvasPos - extent, newCanvasPos + extent);
+    }
+
+    // The reroute grid is already current, so updateSpatialIndex() will not see this move.
+    const uint32_t connectionIndex = m_state.connectionHandles.denseIndex(static_cast<uint32_t>(reroute->connectionId));
+    Vec2 min, max;
+    if (m_connectionSpatialIndex.contains(connectionIndex) &&
+        connectionSpatialBounds(m_state.connections[connectionIndex], min, max)) {
+        m_connectionSpatialIndex.update(connectionIndex, min, max);
+    }
 }
 
 RerouteHitZone NodeEditor::getRerouteHitZone(const Reroute& reroute, const ImVec2& mousePos, const ImVec2& canvasPos) const {
@@ -447,12 +367,29 @@ RerouteHitZone NodeEditor::getRerouteHitZone(const Reroute& reroute, const ImVec
 }
 
 int NodeEditor::findRerouteAtPosition(const ImVec2& mousePos, const ImVec2& canvasPos, RerouteHitZone& hitZone) const {
-    for (const auto& reroute : m_reroutes) {
-        hitZone = getRerouteHitZone(reroute, mousePos, canvasPos);
-        if (hitZone != RerouteHitZone::None) {
-            return reroute.id;
+    int rerouteIndex = findRerouteIndexAtPosition(mousePos, hitZone);
+    return rerouteIndex >= 0 ? m_reroutes[rerouteIndex].id : -1;
+}
+
+int NodeEditor::findRerouteIndexAtPosition(const ImVec2& mousePos, RerouteHitZone& hitZone) const {
+    auto hitTest = [&](size_t index) {
+        hitZone = getRerouteHitZone(m_reroutes[index], mousePos, ImVec2(0, 0));
+        return hitZone != RerouteHitZone::None;
+    };
+
+    if (m_rerouteSpatialIndex.size() != m_reroutes.size()) {
+        for (size_t i = 0; i < m_reroutes.size(); ++i) {
+            if (hitTest(i)) return static_cast<int>(i);
+        }
+    } else {
+        std::vector<uint32_t> candidates;
+        const Vec2 canvasMouse = screenToCanvas(Vec2(mousePos.x, mousePos.y));
+        m_rerouteSpatialIndex.query(canvasMouse, canvasMouse, candidates);
+        for (uint32_t index : candidates) {
+            if (hitTest(index)) return static_cast<int>(index);
         }
     }
+
     hitZone = RerouteHitZone::None;
     return -1;
 }
@@ -3,6 +3,7 @@
 #include "../Editor/View/MinimapManager.h"
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
 
 namespace NodeEditorCore {
     void NodeEditor::render() {
@@ -17,6 +18,8 @@ namespace NodeEditorCore {
         m_animationManager.update(deltaTime);
 
         m_animationManager.updateNodePositions(m_state.nodes, deltaTime);
+        syncNodeGeometry();
+        m_nodeGeometryFrameSynced = true;
 
         m_animationManager.updateConnectionFlows(m_state.connections, deltaTime);
 
@@ -55,6 +58,17 @@ namespace NodeEditorCore {
             processInteraction();
         }
 
+        renderCanvas(drawList, canvasPos, canvasSize);
+
+        m_nodeGeometryFrameSynced = false;
+        ImGui::EndChild();
+    }
+
+    void NodeEditor::renderCanvas(ImDrawList *drawList, const ImVec2 &canvasPos, const ImVec2 &canvasSize) {
+        nodeGeometry();
+        updateSpatialIndex();
+        setCullRect(Vec2::fromImVec2(canvasPos), Vec2(canvasPos.x + canvasSize.x, canvasPos.y + canvasSize.y));
+
         drawGrid(drawList, canvasPos);
         drawGroups(drawList, canvasPos);
         drawConnections(drawList, canvasPos);
@@ -94,6 +108,7 @@ namespace NodeEditorCore {
 
         if (m_debugMode) {
             drawDebugHitboxes(drawList, canvasPos);
+            drawMemoryStatsOverlay(drawList, canvasPos);
         }
 
         if (m_minimapEnabled) {
@@ -102,8 +117,44 @@ namespace NodeEditorCore {
             updateMinimapBounds();
             m_minimapManager.draw(drawList, canvasPos, canvasSize);
         }
+    }
 
-        ImGui::EndChild();
+    void NodeEditor::drawMemoryStatsOverlay(ImDrawList *drawList, const ImVec2 &canvasPos) {
+        MemoryStats stats = getMemoryStats();
+        const std::pair<const char *, const MemoryStats::Category *> rows[] = {
+            {"Nodes", &stats.nodes},
+            {"Pins", &stats.pins},
+            {"Connections", &stats.connections},
+            {"Reroutes", &stats.reroutes},
+            {"Groups", &stats.groups},
+            {"Subgraphs", &stats.subgraphs},
+            {"Metadata", &stats.metadata},
+            {"UUID maps", &stats.uuidMaps},
+            {"Indices", &stats.graphIndices},
+            {"Animation", &stats.animationState},
+            {"Command log", &stats.commandLog},
+            {"Display ids", &stats.displayIdCache},
+            {"Symbols", &stats.symbols},
+            {"Graph pool", &stats.graphPool}
+        };
+
+        const float lineHeight = 14.0f;
+        const size_t rowCount = sizeof(rows) / sizeof(rows[0]);
+        ImVec2 panelMin(canvasPos.x + 10.0f, canvasPos.y + 10.0f);
+        ImVec2 panelMax(panelMin.x + 250.0f, panelMin.y + lineHeight * (rowCount + 1) + 10.0f);
+        drawList->AddRectFilled(panelMin, panelMax, IM_COL32(20, 20, 25, 200), 4.0f);
+
+        char text[96];
+        ImVec2 textPos(panelMin.x + 5.0f, panelMin.y + 5.0f);
+        std::snprintf(text, sizeof(text), "Graph memory: %.1f KB", stats.totalBytes() / 1024.0);
+        drawList->AddText(textPos, IM_COL32(255, 255, 255, 255), text);
+
+        for (const auto &[label, category]: rows) {
+            textPos.y += lineHeight;
+            std::snprintf(text, sizeof(text), "%-12s %8zu %10.1f KB", label, category->count,
+                          category->bytes / 1024.0);
+            drawList->AddText(textPos, IM_COL32(200, 200, 200, 255), text);
+        }
     }
 
     void NodeEditor::arrangeNodesWithAnimation(const std::vector<int> &nodeIds, const ArrangementType type) {
@@ -416,22 +467,237 @@ namespace NodeEditorCore {
         if (path.empty()) return;
     }
 
-    void NodeEditor::updateMinimapBounds() {
-        Vec2 min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-        Vec2 max(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+    void NodeEditor::syncNodeGeometry() {
+        m_nodeGeometry.sync(m_state.nodes);
+        m_nodeGeometryVersion = m_state.graphVersion;
+    }
+
+    // Inside render() the store was gathered once at frame start and the editor's own edits write through
+    // to it; outside a frame nodes may have been changed through Node pointers, so gather again.
+    const NodeGeometryStore &NodeEditor::nodeGeometry() {
+        if (!m_nodeGeometryFrameSynced || !nodeGeometryCurrent()) {
+            syncNodeGeometry();
+        }
+        return m_nodeGeometry;
+    }
+
+    bool NodeEditor::nodeGeometryCurrent() const {
+        return m_nodeGeometryVersion == m_state.graphVersion && m_nodeGeometry.size() == m_state.nodes.size();
+    }
+
+    void NodeEditor::writeNodeGeometry(size_t index) {
+        if (nodeGeometryCurrent()) {
+            m_nodeGeometry.write(index, m_state.nodes[index]);
+        }
+    }
+
+    void NodeEditor::updateSpatialIndex() {
+        const NodeGeometryStore &geometry = nodeGeometry();
+        const float tension = m_connectionStyleManager.getConfig().curveTension;
+        const bool rebuild = m_spatialIndexVersion != m_state.graphVersion || m_spatialIndexTension != tension ||
+                             m_spatialIndexPinRadius != m_state.style.pinRadius ||
+                             m_nodeSpatialIndex.size() != geometry.size() ||
+                             m_connectionSpatialIndex.size() > m_state.connections.size();
+
+        if (rebuild) {
+            m_nodeSpatialIndex.clear();
+            m_connectionSpatialIndex.clear();
+            m_nodeSpatialIndex.reserve(geometry.size());
+            m_connectionSpatialIndex.reserve(m_state.connections.size());
+        }
+
+        auto updateNode = [&](size_t index) {
+            Vec2 min, max;
+            nodeSpatialBounds(index, min, max);
+            return m_nodeSpatialIndex.update(static_cast<uint32_t>(index), min, max);
+        };
+
+        m_connectionIndexScratch.clear();
+        if (rebuild) {
+            for (size_t i = 0; i < geometry.size(); ++i) {
+                updateNode(i);
+            }
+            for (size_t i = 0; i < m_state.connections.size(); ++i) {
+                m_connectionIndexScratch.push_back(static_cast<uint32_t>(i));
+            }
+        } else {
+            for (uint32_t index: geometry.changed()) {
+                if (!updateNode(index)) continue;
+
+                const int nodeId = m_state.nodes[index].id;
+                for (const auto *adjacency: {&m_state.nodeInputConnections, &m_state.nodeOutputConnections}) {
+                    auto it = adjacency->find(nodeId);
+                    if (it == adjacency->end()) continue;
+                    for (int connectionId: it->second) {
+                        m_connectionIndexScratch.push_back(
+                            m_state.connectionHandles.denseIndex(static_cast<uint32_t>(connectionId)));
+                    }
+                }
+            }
+
+        }
+
+        // Only connections whose reroutes moved need new bounds; a shrunken reroute list re-inserts every
+        // reroute, and since removed reroutes can no longer name their connection, all paths are refreshed.
+        bool reroutesRemoved = false;
+        if (m_rerouteSpatialIndex.size() > m_reroutes.size()) {
+            m_rerouteSpatialIndex.clear();
+            reroutesRemoved = !rebuild;
+        }
+        const Vec2 rerouteExtent(rerouteSpatialRadius(), rerouteSpatialRadius());
+        for (size_t i = 0; i < m_reroutes.size(); ++i) {
+            const Vec2 &position = m_reroutes[i].position;
+            if (m_rerouteSpatialIndex.update(static_cast<uint32_t>(i), position - rerouteExtent,
+                                             position + rerouteExtent)) {
+                m_connectionGeometry.invalidate(static_cast<uint32_t>(m_reroutes[i].connectionId));
+                if (!rebuild && !reroutesRemoved) {
+                    m_connectionIndexScratch.push_back(
+                        m_state.connectionHandles.denseIndex(static_cast<uint32_t>(m_reroutes[i].connectionId)));
+                }
+            }
+        }
+
+        if (reroutesRemoved) {
+            m_connectionIndexScratch.clear();
+            for (size_t i = 0; i < m_state.connections.size(); ++i) {
+                m_connectionIndexScratch.push_back(static_cast<uint32_t>(i));
+            }
+        } else if (!rebuild) {
+            std::sort(m_connectionIndexScratch.begin(), m_connectionIndexScratch.end());
+            m_connectionIndexScratch.erase(std::unique(m_connectionIndexScratch.begin(), m_connectionIndexScratch.end()),
+                                           m_connectionIndexScratch.end());
+        }
 
-        bool hasNodes = false;
+        for (uint32_t index: m_connectionIndexScratch) {
+            if (index >= m_state.connections.size()) continue;
 
-        for (const auto &node: m_state.nodes) {
-            if (!isNodeInCurrentSubgraph(node)) continue;
+            Vec2 min, max;
+            if (connectionSpatialBounds(m_state.connections[index], min, max)) {
+                m_connectionSpatialIndex.update(index, min, max);
+            } else {
+                m_connectionSpatialIndex.remove(index);
+            }
+        }
 
-            min.x = std::min(min.x, node.position.x);
-            min.y = std::min(min.y, node.position.y);
-            max.x = std::max(max.x, node.position.x + node.size.x);
-            max.y = std::max(max.y, node.position.y + node.size.y);
+        m_nodeGeometry.clearChanged();
+        m_spatialIndexVersion = m_state.graphVersion;
+        m_spatialIndexTension = tension;
+        m_spatialIndexPinRadius = m_state.style.pinRadius;
+    }
 
-            hasNodes = true;
+    void NodeEditor::ensureSpatialIndex() {
+        if (m_spatialIndexVersion != m_state.graphVersion || m_nodeSpatialIndex.size() != m_state.nodes.size() ||
+            m_rerouteSpatialIndex.size() != m_reroutes.size()) {
+            syncNodeGeometry();
+            updateSpatialIndex();
         }
+    }
+
+    float NodeEditor::rerouteSpatialRadius() const {
+        return m_rerouteStyle.outerRadius * std::max({1.0f, m_rerouteStyle.selectedScale, m_rerouteStyle.hoverScale});
+    }
+
+    void NodeEditor::nodeSpatialBounds(size_t index, Vec2 &min, Vec2 &max) const {
+        const float margin = m_state.style.pinRadius * 3.0f + 1.0f;
+        const float pinExtent = pinSlotOffset(static_cast<float>(m_nodeGeometry.pinSlots()[index]) - 1.0f);
+        const float x = m_nodeGeometry.x()[index];
+        const float y = m_nodeGeometry.y()[index];
+
+        min = Vec2(x - margin, y - margin);
+        max = Vec2(x + std::max(m_nodeGeometry.width()[index], pinExtent) + margin,
+                   y + m_nodeGeometry.height()[index] + margin);
+    }
+
+    bool NodeEditor::connectionSpatialBounds(const Connection &connection, Vec2 &min, Vec2 &max) const {
+        if (!buildConnectionPath(connection, m_connectionBoundsScratch)) return false;
+
+        min = m_connectionBoundsScratch.min;
+        max = m_connectionBoundsScratch.max;
+        return true;
+    }
+
+    bool NodeEditor::pinCanvasPosition(const Node &node, int pinId, Vec2 &position) const {
+        for (size_t i = 0; i < node.inputs.size(); ++i) {
+            if (node.inputs[i].id == pinId) {
+                position = Vec2(node.position.x + pinSlotOffset(static_cast<float>(i)), node.position.y);
+                return true;
+            }
+        }
+        for (size_t i = 0; i < node.outputs.size(); ++i) {
+            if (node.outputs[i].id == pinId) {
+                position = Vec2(node.position.x + pinSlotOffset(static_cast<float>(i)), node.position.y + node.size.y);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void NodeEditor::setCullRect(const Vec2 &screenMin, const Vec2 &screenMax) {
+        // Side labels and selection glows are drawn in screen pixels outside the node rect.
+        const Vec2 margin(256.0f, 64.0f);
+        m_cullMin = screenToCanvas(screenMin - margin);
+        m_cullMax = screenToCanvas(screenMax + margin);
+    }
+
+    void NodeEditor::collectVisibleNodes(const Vec2 &min, const Vec2 &max, std::vector<uint32_t> &indices) const {
+        const int32_t target = m_state.currentSubgraphId < 0 ? -1 : m_state.currentSubgraphId;
+        const int32_t *subgraph = m_nodeGeometry.subgraph();
+
+        m_nodeSpatialIndex.query(min, max, indices);
+        indices.erase(std::remove_if(indices.begin(), indices.end(),
+                                     [subgraph, target](uint32_t index) { return subgraph[index] != target; }),
+                      indices.end());
+    }
+
+    void NodeEditor::collectVisibleConnections(const Vec2 &min, const Vec2 &max,
+                                               std::vector<uint32_t> &indices) const {
+        const int32_t target = m_state.currentSubgraphId < 0 ? -1 : m_state.currentSubgraphId;
+        const int32_t *subgraph = m_nodeGeometry.subgraph();
+        auto inCurrentSubgraph = [&](int nodeId) {
+            uint32_t index = m_state.nodeHandles.denseIndex(static_cast<uint32_t>(nodeId));
+            return index < m_nodeGeometry.size() && subgraph[index] == target;
+        };
+
+        m_connectionSpatialIndex.query(min, max, indices);
+        indices.erase(std::remove_if(indices.begin(), indices.end(), [&](uint32_t index) {
+                          const Connection &connection = m_state.connections[index];
+                          return !inCurrentSubgraph(connection.startNodeId) ||
+                                 !inCurrentSubgraph(connection.endNodeId);
+                      }),
+                      indices.end());
+    }
+
+    std::vector<int> NodeEditor::getNodesInViewport(const Vec2 &screenMin, const Vec2 &screenMax) {
+        nodeGeometry();
+        updateSpatialIndex();
+        collectVisibleNodes(screenToCanvas(screenMin), screenToCanvas(screenMax), m_nodeIndexScratch);
+
+        std::vector<int> nodeIds;
+        nodeIds.reserve(m_nodeIndexScratch.size());
+        for (uint32_t index: m_nodeIndexScratch) {
+            nodeIds.push_back(m_state.nodes[index].id);
+        }
+        return nodeIds;
+    }
+
+    std::vector<int> NodeEditor::getConnectionsInViewport(const Vec2 &screenMin, const Vec2 &screenMax) {
+        nodeGeometry();
+        updateSpatialIndex();
+        collectVisibleConnections(screenToCanvas(screenMin), screenToCanvas(screenMax), m_connectionIndexScratch);
+
+        std::vector<int> connectionIds;
+        connectionIds.reserve(m_connectionIndexScratch.size());
+        for (uint32_t index: m_connectionIndexScratch) {
+            connectionIds.push_back(m_state.connections[index].id);
+        }
+        return connectionIds;
+    }
+
+    void NodeEditor::updateMinimapBounds() {
+        Vec2 min;
+        Vec2 max;
+
+        bool hasNodes = nodeGeometry().computeBounds(m_state.currentSubgraphId, min, max);
 
         float margin = 200.0f;
 
@@ -30,4 +30,12 @@ CommandRouter& CommandManager::getBackendRouter() {
 
 CommandRouter& CommandManager::getUIRouter() {
     return toUI;
+}
+
+const CommandRouter& CommandManager::getBackendRouter() const {
+    return toBackend;
+}
+
+const CommandRouter& CommandManager::getUIRouter() const {
+    return toUI;
 }
\ No newline at end of file
@@ -22,6 +22,8 @@ public:
     
     CommandRouter& getBackendRouter();
     CommandRouter& getUIRouter();
+    const CommandRouter& getBackendRouter() const;
+    const CommandRouter& getUIRouter() const;
     
     template<typename T>
     void dispatchTypedToBackend(const std::string& command, const T& data) {
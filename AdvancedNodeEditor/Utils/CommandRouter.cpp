@@ -1,4 +1,5 @@
 #include "CommandRouter.h"
+#include "MemoryAccounting.h"
 
 void CommandRouter::bind(const std::string& command, std::function<void(const std::any&)> handler) {
     handlers[command] = handler;
@@ -42,4 +43,16 @@ std::vector<std::string> CommandRouter::getBoundCommands() const {
 
 const std::vector<std::pair<std::string, std::any>>& CommandRouter::getLoggedCalls() const {
     return loggedCalls;
+}
+
+void CommandRouter::clearLoggedCalls() {
+    loggedCalls.clear();
+}
+
+size_t CommandRouter::getLoggedCallsMemoryUsage() const {
+    size_t bytes = NodeEditorCore::MemoryAccounting::heapBytes(loggedCalls);
+    for (const auto& [command, _] : loggedCalls) {
+        bytes += NodeEditorCore::MemoryAccounting::heapBytes(command);
+    }
+    return bytes;
 }
\ No newline at end of file
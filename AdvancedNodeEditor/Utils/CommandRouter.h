@@ -26,6 +26,8 @@ public:
     void setLoggingEnabled(bool enabled);
     std::vector<std::string> getBoundCommands() const;
     const std::vector<std::pair<std::string, std::any>>& getLoggedCalls() const;
+    void clearLoggedCalls();
+    size_t getLoggedCallsMemoryUsage() const;
 
     void setErrorHandler(std::function<void(const std::string&, const std::any&)> handler) {
         errorHandler = handler;
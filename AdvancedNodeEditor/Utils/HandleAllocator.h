@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace NodeEditorCore {
+    struct Handle {
+        uint32_t index = 0;
+        uint32_t generation = 0;
+
+        bool isNull() const { return index == 0; }
+
+        uint64_t packed() const {
+            return (static_cast<uint64_t>(generation) << 32) | index;
+        }
+
+        bool operator==(const Handle &other) const = default;
+    };
+
+    class HandleAllocator {
+    public:
+        static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t kMaxIndex = (1u << 24) - 1;
+
+        HandleAllocator() {
+            clear();
+        }
+
+        Handle allocate(uint32_t denseIndex) {
+            if (m_freeListDirty) {
+                rebuildFreeList();
+            }
+
+            uint32_t index;
+            if (!m_freeList.empty()) {
+                index = m_freeList.back();
+                m_freeList.pop_back();
+            } else {
+                index = static_cast<uint32_t>(m_dense.size());
+                m_dense.push_back(npos);
+                m_generations.push_back(0);
+            }
+
+            m_dense[index] = denseIndex;
+            m_liveCount++;
+            return Handle{index, m_generations[index]};
+        }
+
+        bool acquire(uint32_t index, uint32_t denseIndex) {
+            if (index == 0 || index > kMaxIndex) return false;
+
+            if (index >= m_dense.size()) {
+                m_dense.resize(static_cast<size_t>(index) + 1, npos);
+                m_generations.resize(static_cast<size_t>(index) + 1, 0);
+            }
+            if (m_dense[index] != npos) return false;
+
+            m_dense[index] = denseIndex;
+            m_liveCount++;
+            m_freeListDirty = true;
+            return true;
+        }
+
+        bool release(uint32_t index) {
+            if (!isLive(index)) return false;
+
+            m_dense[index] = npos;
+            m_generations[index]++;
+            m_liveCount--;
+            if (!m_freeListDirty) {
+                m_freeList.push_back(index);
+            }
+            return true;
+        }
+
+        void clear() {
+            m_dense.assign(1, npos);
+            m_generations.assign(1, 0);
+            m_freeList.clear();
+            m_freeListDirty = false;
+            m_liveCount = 0;
+        }
+
+        void reserve(size_t capacity) {
+            m_dense.reserve(capacity + 1);
+            m_generations.reserve(capacity + 1);
+        }
+
+        bool isLive(uint32_t index) const {
+            return index < m_dense.size() && m_dense[index] != npos;
+        }
+
+        bool isValid(const Handle &handle) const {
+            return isLive(handle.index) && m_generations[handle.index] == handle.generation;
+        }
+
+        Handle handle(uint32_t index) const {
+            return isLive(index) ? Handle{index, m_generations[index]} : Handle{};
+        }
+
+        uint32_t denseIndex(uint32_t index) const {
+            return index < m_dense.size() ? m_dense[index] : npos;
+        }
+
+        bool setDenseIndex(uint32_t index, uint32_t denseIndex) {
+            if (!isLive(index)) return false;
+
+            m_dense[index] = denseIndex;
+            return true;
+        }
+
+        size_t liveCount() const { return m_liveCount; }
+        size_t capacity() const { return m_dense.size() - 1; }
+
+        size_t memoryUsage() const {
+            return (m_dense.capacity() + m_generations.capacity() + m_freeList.capacity()) * sizeof(uint32_t);
+        }
+
+    private:
+        void rebuildFreeList() {
+            m_freeList.clear();
+            for (size_t i = m_dense.size(); i-- > 1;) {
+                if (m_dense[i] == npos) {
+                    m_freeList.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            m_freeListDirty = false;
+        }
+
+        std::vector<uint32_t> m_dense;
+        std::vector<uint32_t> m_generations;
+        std::vector<uint32_t> m_freeList;
+        size_t m_liveCount = 0;
+        bool m_freeListDirty = false;
+    };
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory_resource>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace NodeEditorCore {
+    namespace MemoryAccounting {
+        inline size_t heapBytes(const std::string &value) {
+            return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+        }
+
+        template<typename T, typename Allocator>
+        size_t heapBytes(const std::vector<T, Allocator> &values) {
+            return values.capacity() * sizeof(T);
+        }
+
+        template<typename Key, typename Value, typename Hash, typename Equal, typename Allocator>
+        size_t heapBytes(const std::unordered_map<Key, Value, Hash, Equal, Allocator> &map) {
+            return map.bucket_count() * sizeof(void *) +
+                   map.size() * (sizeof(std::pair<const Key, Value>) + sizeof(void *) + sizeof(size_t));
+        }
+
+        template<typename Key, typename Value, typename Compare, typename Allocator>
+        size_t heapBytes(const std::map<Key, Value, Compare, Allocator> &map) {
+            return map.size() * (sizeof(std::pair<const Key, Value>) + 4 * sizeof(void *));
+        }
+
+        template<typename Key, typename Hash, typename Equal, typename Allocator>
+        size_t heapBytes(const std::unordered_set<Key, Hash, Equal, Allocator> &set) {
+            return set.bucket_count() * sizeof(void *) + set.size() * (sizeof(Key) + sizeof(void *) + sizeof(size_t));
+        }
+
+        // Sits under a pool resource so the bytes the pool holds from the heap can be reported.
+        class CountingResource : public std::pmr::memory_resource {
+        public:
+            explicit CountingResource(std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+                : m_upstream(upstream) {
+            }
+
+            size_t bytes() const { return m_bytes; }
+            size_t blocks() const { return m_blocks; }
+
+        private:
+            void *do_allocate(size_t bytes, size_t alignment) override {
+                void *block = m_upstream->allocate(bytes, alignment);
+                m_bytes += bytes;
+                ++m_blocks;
+                return block;
+            }
+
+            void do_deallocate(void *block, size_t bytes, size_t alignment) override {
+                m_upstream->deallocate(block, bytes, alignment);
+                m_bytes -= bytes;
+                --m_blocks;
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+                return this == &other;
+            }
+
+            std::pmr::memory_resource *m_upstream;
+            size_t m_bytes = 0;
+            size_t m_blocks = 0;
+        };
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "UuidGenerator.h"
+
+namespace NodeEditorCore {
+    template<typename T>
+    class SortedUuidIndex {
+    public:
+        using value_type = std::pair<Uuid, T>;
+        using iterator = typename std::vector<value_type>::iterator;
+        using const_iterator = typename std::vector<value_type>::const_iterator;
+
+        void reserve(size_t capacity) {
+            m_entries.reserve(capacity);
+        }
+
+        bool insert(const Uuid &key, const T &value) {
+            if (m_entries.empty() || m_entries.back().first < key) {
+                m_entries.emplace_back(key, value);
+                return true;
+            }
+
+            auto it = lowerBound(key);
+            if (it != m_entries.end() && it->first == key) {
+                it->second = value;
+                return false;
+            }
+
+            m_entries.emplace(it, key, value);
+            return true;
+        }
+
+        T *find(const Uuid &key) {
+            auto it = lowerBound(key);
+            return it != m_entries.end() && it->first == key ? &it->second : nullptr;
+        }
+
+        const T *find(const Uuid &key) const {
+            return const_cast<SortedUuidIndex *>(this)->find(key);
+        }
+
+        bool contains(const Uuid &key) const {
+            return find(key) != nullptr;
+        }
+
+        bool erase(const Uuid &key) {
+            auto it = lowerBound(key);
+            if (it == m_entries.end() || it->first != key) return false;
+            m_entries.erase(it);
+            return true;
+        }
+
+        void clear() {
+            m_entries.clear();
+        }
+
+        size_t size() const { return m_entries.size(); }
+        bool empty() const { return m_entries.empty(); }
+
+        iterator begin() { return m_entries.begin(); }
+        iterator end() { return m_entries.end(); }
+        const_iterator begin() const { return m_entries.begin(); }
+        const_iterator end() const { return m_entries.end(); }
+
+    private:
+        iterator lowerBound(const Uuid &key) {
+            return std::lower_bound(m_entries.begin(), m_entries.end(), key,
+                                    [](const value_type &entry, const Uuid &uuid) { return entry.first < uuid; });
+        }
+
+        std::vector<value_type> m_entries;
+    };
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "MemoryAccounting.h"
+
+namespace NodeEditorCore {
+    // Entries are never freed, so only repeated identifiers such as node types belong here. User-editable
+    // text (node and pin names, labels) stays in owned strings.
+    class SymbolTable {
+    public:
+        static SymbolTable &getInstance() {
+            static SymbolTable instance;
+            return instance;
+        }
+
+        uint32_t intern(std::string_view text) {
+            if (text.empty()) return 0;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_ids.find(text);
+            if (it != m_ids.end()) {
+                return it->second;
+            }
+
+            uint32_t id = m_count.load(std::memory_order_relaxed);
+            size_t chunkIndex = id / kChunkSize;
+            if (chunkIndex >= kMaxChunks) {
+                // Id 0 means the empty string, so handing it out here would silently alias every new name.
+                throw std::length_error("SymbolTable is full; only intern identifiers, not free text");
+            }
+
+            std::string *chunk = m_chunks[chunkIndex].load(std::memory_order_relaxed);
+            if (!chunk) {
+                chunk = new std::string[kChunkSize];
+                m_chunks[chunkIndex].store(chunk, std::memory_order_release);
+            }
+
+            std::string &stored = chunk[id % kChunkSize];
+            stored.assign(text);
+            m_ids.emplace(std::string_view(stored), id);
+            m_count.store(id + 1, std::memory_order_release);
+            return id;
+        }
+
+        uint32_t find(std::string_view text) const {
+            if (text.empty()) return 0;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_ids.find(text);
+            return it != m_ids.end() ? it->second : 0;
+        }
+
+        const std::string &str(uint32_t id) const {
+            if (id >= m_count.load(std::memory_order_acquire)) {
+                return m_chunks[0].load(std::memory_order_relaxed)[0];
+            }
+            return m_chunks[id / kChunkSize].load(std::memory_order_acquire)[id % kChunkSize];
+        }
+
+        size_t size() const {
+            return m_count.load(std::memory_order_acquire);
+        }
+
+        size_t memoryUsage() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const size_t count = m_count.load(std::memory_order_relaxed);
+            const size_t chunks = (count + kChunkSize - 1) / kChunkSize;
+
+            size_t bytes = sizeof(m_chunks) + chunks * kChunkSize * sizeof(std::string) +
+                           MemoryAccounting::heapBytes(m_ids);
+            for (size_t id = 1; id < count; ++id) {
+                const std::string *chunk = m_chunks[id / kChunkSize].load(std::memory_order_relaxed);
+                bytes += MemoryAccounting::heapBytes(chunk[id % kChunkSize]);
+            }
+            return bytes;
+        }
+
+    private:
+        static constexpr size_t kChunkSize = 1024;
+        static constexpr size_t kMaxChunks = 4096;
+
+        SymbolTable() {
+            m_chunks[0].store(new std::string[kChunkSize], std::memory_order_relaxed);
+        }
+
+        ~SymbolTable() {
+            for (auto &chunk: m_chunks) {
+                delete[] chunk.load(std::memory_order_relaxed);
+            }
+        }
+
+        SymbolTable(const SymbolTable &) = delete;
+
+        SymbolTable &operator=(const SymbolTable &) = delete;
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<std::string_view, uint32_t> m_ids;
+        std::array<std::atomic<std::string *>, kMaxChunks> m_chunks{};
+        std::atomic<uint32_t> m_count{1};
+    };
+
+    class Symbol {
+    public:
+        Symbol() noexcept : m_id(0) {
+        }
+
+        Symbol(std::string_view text) : m_id(SymbolTable::getInstance().intern(text)) {
+        }
+
+        Symbol(const std::string &text) : Symbol(std::string_view(text)) {
+        }
+
+        Symbol(const char *text) : Symbol(text ? std::string_view(text) : std::string_view()) {
+        }
+
+        static Symbol find(std::string_view text) {
+            Symbol symbol;
+            symbol.m_id = SymbolTable::getInstance().find(text);
+            return symbol;
+        }
+
+        uint32_t id() const noexcept { return m_id; }
+        bool empty() const noexcept { return m_id == 0; }
+
+        const std::string &str() const { return SymbolTable::getInstance().str(m_id); }
+        const char *c_str() const { return str().c_str(); }
+        size_t size() const { return str().size(); }
+        size_t length() const { return str().size(); }
+
+        operator const std::string &() const { return str(); }
+
+        bool operator==(const Symbol &other) const noexcept { return m_id == other.m_id; }
+        bool operator==(const std::string &text) const { return str() == text; }
+        bool operator==(const char *text) const { return str() == text; }
+        bool operator<(const Symbol &other) const { return str() < other.str(); }
+
+        friend std::ostream &operator<<(std::ostream &stream, const Symbol &symbol) {
+            return stream << symbol.str();
+        }
+
+    private:
+        uint32_t m_id;
+    };
+}
+
+namespace std {
+    template<>
+    struct hash<NodeEditorCore::Symbol> {
+        std::size_t operator()(const NodeEditorCore::Symbol &symbol) const noexcept {
+            return symbol.id();
+        }
+    };
+}
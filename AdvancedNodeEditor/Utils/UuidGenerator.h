@@ -4,10 +4,9 @@
 #include <cstdint>
 #include <random>
 #include <string>
-#include <sstream>
-#include <iomanip>
+#include <ostream>
 #include <functional>
-#include <mutex>
+#include <vector>
 #include <chrono>
 #include <atomic>
 
@@ -22,22 +21,59 @@ namespace NodeEditorCore {
         explicit Uuid(const value_type &data) noexcept : m_data(data) {
         }
 
-        explicit Uuid(const std::string &str) {
-            if (str.size() != 36 || str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
-                throw std::invalid_argument("Invalid UUID format");
+        // Text that is not a canonical UUID is hashed into a name-based v8 UUID; use tryParse where
+        // malformed input must be rejected instead.
+        explicit Uuid(const std::string &str) : m_data{} {
+            assign(str.data(), str.size());
+        }
+
+        explicit Uuid(const char *str) : m_data{} {
+            if (str) {
+                assign(str, std::char_traits<char>::length(str));
             }
+        }
 
-            std::string hexStr = str.substr(0, 8) + str.substr(9, 4) + str.substr(14, 4) +
-                                 str.substr(19, 4) + str.substr(24);
+        static bool tryParse(const char *str, size_t length, Uuid &result) noexcept {
+            if (length != 36 || str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
+                return false;
+            }
 
+            value_type data{};
+            size_t position = 0;
             for (size_t i = 0; i < 16; ++i) {
-                std::string byteStr = hexStr.substr(i * 2, 2);
-                try {
-                    m_data[i] = static_cast<uint8_t>(std::stoi(byteStr, nullptr, 16));
-                } catch (const std::exception &) {
-                    throw std::invalid_argument("UUID contains non-hexadecimal characters");
+                if (position == 8 || position == 13 || position == 18 || position == 23) {
+                    ++position;
                 }
+                int high = hexValue(str[position]);
+                int low = hexValue(str[position + 1]);
+                if (high < 0 || low < 0) return false;
+                data[i] = static_cast<uint8_t>((high << 4) | low);
+                position += 2;
+            }
+
+            result.m_data = data;
+            return true;
+        }
+
+        static Uuid fromName(const char *str, size_t length) noexcept {
+            uint64_t first = 0xcbf29ce484222325ULL;
+            uint64_t second = 0x84222325cbf29ce4ULL;
+            for (size_t i = 0; i < length; ++i) {
+                first = (first ^ static_cast<uint8_t>(str[i])) * 0x100000001b3ULL;
+                second = (second ^ static_cast<uint8_t>(str[i])) * 0x100000001b3ULL;
+                second ^= second >> 29;
+            }
+
+            value_type data;
+            for (size_t i = 0; i < 8; ++i) {
+                data[i] = static_cast<uint8_t>(first >> (56 - i * 8));
+                data[8 + i] = static_cast<uint8_t>(second >> (56 - i * 8));
             }
+
+            Uuid uuid(data);
+            uuid.setVersion(8);
+            uuid.setVariant();
+            return uuid;
         }
 
         uint8_t getVersion() const noexcept {
@@ -52,18 +88,22 @@ namespace NodeEditorCore {
             m_data[8] = (m_data[8] & 0x3F) | 0x80;
         }
 
-        std::string toString() const {
-            std::stringstream ss;
-            ss << std::hex << std::setfill('0');
+        void toChars(char *out) const noexcept {
+            static constexpr char digits[] = "0123456789abcdef";
 
             for (size_t i = 0; i < 16; ++i) {
                 if (i == 4 || i == 6 || i == 8 || i == 10) {
-                    ss << '-';
+                    *out++ = '-';
                 }
-                ss << std::setw(2) << static_cast<int>(m_data[i]);
+                *out++ = digits[m_data[i] >> 4];
+                *out++ = digits[m_data[i] & 0x0F];
             }
+        }
 
-            return ss.str();
+        std::string toString() const {
+            std::string result(36, '-');
+            toChars(result.data());
+            return result;
         }
 
         const value_type &getData() const noexcept {
@@ -77,6 +117,26 @@ namespace NodeEditorCore {
             return true;
         }
 
+        bool empty() const noexcept {
+            return isNil();
+        }
+
+        void clear() noexcept {
+            m_data.fill(0);
+        }
+
+        uint64_t high() const noexcept {
+            uint64_t value = 0;
+            for (size_t i = 0; i < 8; ++i) value = (value << 8) | m_data[i];
+            return value;
+        }
+
+        uint64_t low() const noexcept {
+            uint64_t value = 0;
+            for (size_t i = 8; i < 16; ++i) value = (value << 8) | m_data[i];
+            return value;
+        }
+
         bool operator==(const Uuid &other) const noexcept {
             return m_data == other.m_data;
         }
@@ -97,16 +157,39 @@ namespace NodeEditorCore {
             return !isNil();
         }
 
+        friend std::ostream &operator<<(std::ostream &stream, const Uuid &uuid) {
+            return stream << uuid.toString();
+        }
+
         int32_t toId() const noexcept {
-            std::hash<std::string> hasher;
-            size_t hashValue = hasher(toString());
+            uint64_t hashValue = high() ^ (low() * 0x9E3779B97F4A7C15ULL);
+            hashValue ^= hashValue >> 32;
             return static_cast<int32_t>(hashValue & 0x7FFFFFFF);
         }
 
     private:
+        static int hexValue(char c) noexcept {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+
+        void assign(const char *str, size_t length) noexcept {
+            if (length == 0) return;
+            if (!tryParse(str, length, *this)) {
+                *this = fromName(str, length);
+            }
+        }
+
         value_type m_data;
     };
 
+    enum class UuidVersion {
+        V4,
+        V7
+    };
+
     class UuidGenerator {
     public:
         static UuidGenerator &getInstance() {
@@ -114,31 +197,53 @@ namespace NodeEditorCore {
             return instance;
         }
 
-        Uuid generateV4() {
-            std::lock_guard<std::mutex> lock(m_mutex);
+        void setDefaultVersion(UuidVersion version) {
+            m_defaultVersion.store(version, std::memory_order_relaxed);
+        }
 
-            Uuid::value_type data;
-            for (size_t i = 0; i < data.size(); ++i) {
-                data[i] = static_cast<uint8_t>(m_distribution(m_rng));
-            }
+        UuidVersion getDefaultVersion() const {
+            return m_defaultVersion.load(std::memory_order_relaxed);
+        }
 
-            Uuid uuid(data);
-            uuid.setVersion(4);
-            uuid.setVariant();
+        Uuid generate() {
+            return getDefaultVersion() == UuidVersion::V7 ? generateV7() : generateV4();
+        }
 
-            if (m_lastGenerated == uuid) {
-                return generateV4();
-            }
+        Uuid generateV4() {
+            ThreadState &state = threadState();
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            return makeV4(state.rng(), state.rng());
+        }
 
-            m_lastGenerated = uuid;
-            m_count++;
+        std::vector<Uuid> generateBatch(size_t count) {
+            std::vector<Uuid> uuids(count);
+            generateBatch(uuids.data(), count);
+            return uuids;
+        }
 
-            return uuid;
+        void generateBatch(Uuid *out, size_t count) {
+            ThreadState &state = threadState();
+            if (getDefaultVersion() == UuidVersion::V7) {
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = makeV7(state);
+                }
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    uint64_t high = state.rng();
+                    uint64_t low = state.rng();
+                    out[i] = makeV4(high, low);
+                }
+            }
+            m_count.fetch_add(count, std::memory_order_relaxed);
         }
 
-        Uuid generateV1() {
-            std::lock_guard<std::mutex> lock(m_mutex);
+        Uuid generateV7() {
+            ThreadState &state = threadState();
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            return makeV7(state);
+        }
 
+        Uuid generateV1() {
             auto now = std::chrono::high_resolution_clock::now();
             auto epochNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
                 now.time_since_epoch()).count();
@@ -164,46 +269,103 @@ namespace NodeEditorCore {
             data[8] = static_cast<uint8_t>((clockSeq >> 8) & 0xFF);
             data[9] = static_cast<uint8_t>(clockSeq & 0xFF);
 
+            uint64_t node = threadState().rng();
             for (int i = 0; i < 6; ++i) {
-                data[10 + i] = static_cast<uint8_t>(m_distribution(m_rng));
+                data[10 + i] = static_cast<uint8_t>(node >> (i * 8));
             }
 
             Uuid uuid(data);
             uuid.setVersion(1);
             uuid.setVariant();
 
+            m_count.fetch_add(1, std::memory_order_relaxed);
             return uuid;
         }
 
         uint64_t getGenerationCount() const {
-            return m_count;
+            return m_count.load(std::memory_order_relaxed);
         }
 
         void reseed(uint64_t seed = 0) {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            if (seed == 0) {
-                std::random_device rd;
-                seed = static_cast<uint64_t>(rd()) << 32 | rd();
-            }
-            m_rng.seed(seed);
+            m_seed.store(seed, std::memory_order_relaxed);
+            m_seedEpoch.fetch_add(1, std::memory_order_release);
         }
 
     private:
-        UuidGenerator() {
-            std::random_device rd;
-            m_rng.seed(static_cast<uint64_t>(rd()) << 32 | rd());
-        }
+        struct ThreadState {
+            std::mt19937_64 rng;
+            uint64_t epoch = 0;
+            uint64_t ordinal = 0;
+            uint64_t lastMillis = 0;
+            uint16_t sequence = 0;
+        };
+
+        UuidGenerator() = default;
 
         UuidGenerator(const UuidGenerator &) = delete;
 
         UuidGenerator &operator=(const UuidGenerator &) = delete;
 
-        std::mt19937_64 m_rng;
-        std::uniform_int_distribution<unsigned int> m_distribution{0, 255};
-        std::mutex m_mutex;
-        Uuid m_lastGenerated;
+        static Uuid makeV4(uint64_t high, uint64_t low) noexcept {
+            Uuid::value_type data;
+            for (size_t i = 0; i < 8; ++i) {
+                data[i] = static_cast<uint8_t>(high >> (56 - i * 8));
+                data[8 + i] = static_cast<uint8_t>(low >> (56 - i * 8));
+            }
+
+            Uuid uuid(data);
+            uuid.setVersion(4);
+            uuid.setVariant();
+            return uuid;
+        }
+
+        static Uuid makeV7(ThreadState &state) {
+            uint64_t millis = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+
+            if (millis > state.lastMillis) {
+                state.lastMillis = millis;
+                state.sequence = static_cast<uint16_t>(state.rng() & 0x01FF);
+            } else if (++state.sequence > 0x0FFF) {
+                ++state.lastMillis;
+                state.sequence = 0;
+            }
+
+            uint64_t high = (state.lastMillis << 16) | state.sequence;
+            uint64_t low = state.rng();
+
+            Uuid uuid = makeV4(high, low);
+            uuid.setVersion(7);
+            return uuid;
+        }
+
+        ThreadState &threadState() {
+            thread_local ThreadState state;
+
+            uint64_t epoch = m_seedEpoch.load(std::memory_order_acquire);
+            if (state.epoch != epoch) {
+                if (state.epoch == 0) {
+                    state.ordinal = m_threadCounter.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                uint64_t seed = m_seed.load(std::memory_order_relaxed);
+                if (seed == 0) {
+                    std::random_device rd;
+                    seed = static_cast<uint64_t>(rd()) << 32 | rd();
+                }
+                state.rng.seed(seed ^ (state.ordinal * 0x9E3779B97F4A7C15ULL));
+                state.epoch = epoch;
+            }
+
+            return state;
+        }
+
         std::atomic<uint64_t> m_count{0};
+        std::atomic<uint64_t> m_seed{0};
+        std::atomic<uint64_t> m_seedEpoch{1};
+        std::atomic<uint64_t> m_threadCounter{0};
         std::atomic<uint16_t> m_sequenceCounter{0};
+        std::atomic<UuidVersion> m_defaultVersion{UuidVersion::V4};
     };
 }
 
@@ -211,14 +373,9 @@ namespace std {
     template<>
     struct hash<NodeEditorCore::Uuid> {
         std::size_t operator()(const NodeEditorCore::Uuid &uuid) const {
-            const auto &data = uuid.getData();
-            std::size_t h = 0;
-
-            for (auto byte: data) {
-                h = h * 31 + byte;
-            }
-
-            return h;
+            uint64_t h = uuid.high() ^ (uuid.low() * 0x9E3779B97F4A7C15ULL);
+            h ^= h >> 32;
+            return static_cast<std::size_t>(h);
         }
     };
 }
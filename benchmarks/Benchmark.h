@@ -0,0 +1,92 @@
+#ifndef NODE_EDITOR_BENCHMARK_H
+#define NODE_EDITOR_BENCHMARK_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NodeEditorBenchmarks {
+    size_t allocatedBytes();
+    size_t allocationCount();
+
+    class BenchmarkContext {
+    public:
+        explicit BenchmarkContext(size_t size) : m_size(size) {
+        }
+
+        size_t size() const { return m_size; }
+
+        template<typename Function>
+        void measure(size_t iterations, Function &&function) {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; ++i) {
+                function();
+            }
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            m_iterations += iterations;
+            m_elapsed += std::chrono::duration<double, std::nano>(elapsed).count();
+        }
+
+        void setItemsProcessed(size_t items) { m_itemsProcessed = items; }
+        void setCounter(const std::string &name, double value) { m_counters.emplace_back(name, value); }
+
+        size_t iterations() const { return m_iterations; }
+        double elapsedNs() const { return m_elapsed; }
+        size_t itemsProcessed() const { return m_itemsProcessed; }
+        const std::vector<std::pair<std::string, double>> &counters() const { return m_counters; }
+
+    private:
+        size_t m_size;
+        size_t m_iterations = 0;
+        size_t m_itemsProcessed = 0;
+        double m_elapsed = 0.0;
+        std::vector<std::pair<std::string, double>> m_counters;
+    };
+
+    struct BenchmarkDefinition {
+        std::string name;
+        std::function<void(BenchmarkContext &)> function;
+        size_t maxSize;
+    };
+
+    inline std::vector<BenchmarkDefinition> &benchmarkRegistry() {
+        static std::vector<BenchmarkDefinition> registry;
+        return registry;
+    }
+
+    struct BenchmarkRegistrar {
+        BenchmarkRegistrar(const std::string &name, std::function<void(BenchmarkContext &)> function,
+                           size_t maxSize = static_cast<size_t>(-1)) {
+            benchmarkRegistry().push_back({name, std::move(function), maxSize});
+        }
+    };
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    inline const void *volatile optimizationSink = nullptr;
+
+    template<typename T>
+    inline void doNotOptimize(const T &value) {
+        optimizationSink = &value;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+#else
+    template<typename T>
+    inline void doNotOptimize(const T &value) {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+#endif
+}
+
+#define NODE_EDITOR_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define NODE_EDITOR_BENCHMARK_CONCAT(a, b) NODE_EDITOR_BENCHMARK_CONCAT_INNER(a, b)
+
+#define NODE_EDITOR_BENCHMARK(name, ...) \
+    static void name(NodeEditorBenchmarks::BenchmarkContext &context); \
+    static NodeEditorBenchmarks::BenchmarkRegistrar NODE_EDITOR_BENCHMARK_CONCAT(name, _registrar)(#name, name, ##__VA_ARGS__); \
+    static void name(NodeEditorBenchmarks::BenchmarkContext &context)
+
+#endif
@@ -0,0 +1,177 @@
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include "Benchmark.h"
+
+using namespace NodeEditorBenchmarks;
+
+static std::atomic<size_t> s_allocatedBytes{0};
+static std::atomic<size_t> s_allocationCount{0};
+static constexpr size_t kAllocationHeader = alignof(std::max_align_t);
+
+void *operator new(size_t size) {
+    void *block = std::malloc(size + kAllocationHeader);
+    if (!block) throw std::bad_alloc();
+    *static_cast<size_t *>(block) = size;
+    s_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return static_cast<char *>(block) + kAllocationHeader;
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    try {
+        return ::operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void *pointer) noexcept {
+    if (!pointer) return;
+    void *block = static_cast<char *>(pointer) - kAllocationHeader;
+    s_allocatedBytes.fetch_sub(*static_cast<size_t *>(block), std::memory_order_relaxed);
+    std::free(block);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    ::operator delete(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+    ::operator delete(pointer);
+}
+
+size_t NodeEditorBenchmarks::allocatedBytes() {
+    return s_allocatedBytes.load(std::memory_order_relaxed);
+}
+
+size_t NodeEditorBenchmarks::allocationCount() {
+    return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+struct BenchmarkRecord {
+    std::string name;
+    size_t size;
+    size_t iterations;
+    double elapsedNs;
+    size_t itemsProcessed;
+    std::vector<std::pair<std::string, double>> counters;
+};
+
+static std::vector<size_t> parseSizes(const std::string &text) {
+    std::vector<size_t> sizes;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            sizes.push_back(static_cast<size_t>(std::strtoull(item.c_str(), nullptr, 10)));
+        }
+    }
+    return sizes;
+}
+
+static std::string escapeJson(const std::string &text) {
+    std::string escaped;
+    for (char c: text) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+static void writeJson(FILE *output, const std::vector<BenchmarkRecord> &records) {
+    std::fprintf(output, "{\n  \"context\": {\n");
+#if defined(__clang__)
+    std::fprintf(output, "    \"compiler\": \"clang %d.%d\",\n", __clang_major__, __clang_minor__);
+#elif defined(__GNUC__)
+    std::fprintf(output, "    \"compiler\": \"gcc %d.%d\",\n", __GNUC__, __GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    std::fprintf(output, "    \"compiler\": \"msvc %d\",\n", _MSC_VER);
+#else
+    std::fprintf(output, "    \"compiler\": \"unknown\",\n");
+#endif
+#ifdef NDEBUG
+    std::fprintf(output, "    \"assertions\": false\n");
+#else
+    std::fprintf(output, "    \"assertions\": true\n");
+#endif
+    std::fprintf(output, "  },\n  \"benchmarks\": [");
+
+    for (size_t i = 0; i < records.size(); ++i) {
+        const auto &record = records[i];
+        double perIteration = record.elapsedNs / static_cast<double>(record.iterations);
+        double itemsPerSecond = record.elapsedNs > 0.0
+                                    ? static_cast<double>(record.itemsProcessed) * 1e9 / record.elapsedNs
+                                    : 0.0;
+
+        std::fprintf(output, "%s\n    {\"name\": \"%s\", \"size\": %zu, \"iterations\": %zu, "
+                             "\"total_ns\": %.0f, \"ns_per_iteration\": %.1f, \"items_per_second\": %.1f",
+                     i == 0 ? "" : ",", escapeJson(record.name).c_str(), record.size, record.iterations,
+                     record.elapsedNs, perIteration, itemsPerSecond);
+
+        for (const auto &[name, value]: record.counters) {
+            std::fprintf(output, ", \"%s\": %.1f", escapeJson(name).c_str(), value);
+        }
+        std::fprintf(output, "}");
+    }
+
+    std::fprintf(output, "\n  ]\n}\n");
+}
+
+int main(int argc, char **argv) {
+    std::vector<size_t> sizes = {100, 1000, 10000, 100000};
+    std::string filter;
+    std::string outputPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--sizes" && i + 1 < argc) {
+            sizes = parseSizes(argv[++i]);
+        } else if (argument == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (argument == "--output" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            std::fprintf(stderr, "usage: %s [--sizes 100,1000] [--filter name] [--output results.json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<BenchmarkRecord> records;
+
+    for (const auto &benchmark: benchmarkRegistry()) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) continue;
+
+        for (size_t size: sizes) {
+            if (size > benchmark.maxSize) continue;
+
+            BenchmarkContext context(size);
+            benchmark.function(context);
+            if (context.iterations() == 0) continue;
+
+            records.push_back({benchmark.name, size, context.iterations(), context.elapsedNs(),
+                               context.itemsProcessed(), context.counters()});
+            std::fprintf(stderr, "%-40s %8zu %14.1f ns/iter\n", benchmark.name.c_str(), size,
+                         context.elapsedNs() / static_cast<double>(context.iterations()));
+        }
+    }
+
+    FILE *output = stdout;
+    if (!outputPath.empty()) {
+        output = std::fopen(outputPath.c_str(), "w");
+        if (!output) {
+            std::fprintf(stderr, "cannot open %s\n", outputPath.c_str());
+            return 1;
+        }
+    }
+
+    writeJson(output, records);
+
+    if (output != stdout) {
+        std::fclose(output);
+    }
+
+    return 0;
+}
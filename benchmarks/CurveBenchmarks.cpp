@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include "Benchmark.h"
+#include "../AdvancedNodeEditor/Editor/View/CurveDistance.h"
+
+using namespace NodeEditorCore;
+using namespace NodeEditorBenchmarks;
+
+struct CubicSet {
+    std::vector<Vec2> points;
+    CubicBatch batch;
+    Vec2 query;
+};
+
+static CubicSet randomConnections(size_t count) {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> coordinate(0.0f, 2000.0f);
+
+    CubicSet set;
+    set.points.reserve(count * 4);
+    set.batch.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const Vec2 start(coordinate(random), coordinate(random));
+        const Vec2 end(coordinate(random), coordinate(random));
+        const float cpDistance = std::sqrt((end.x - start.x) * (end.x - start.x) +
+                                           (end.y - start.y) * (end.y - start.y)) * 0.5f;
+        const Vec2 cp1(start.x, start.y + cpDistance);
+        const Vec2 cp2(end.x, end.y - cpDistance);
+
+        set.points.insert(set.points.end(), {start, cp1, cp2, end});
+        set.batch.add(start, cp1, cp2, end);
+    }
+    set.query = Vec2(1000.0f, 1000.0f);
+    return set;
+}
+
+// The previous hit test: 50 uniform chords, distance to each.
+static float sampledDistance(const Vec2 &point, const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3) {
+    float minDistance = FLT_MAX;
+    Vec2 prev = p0;
+    for (int i = 1; i <= 50; i++) {
+        const float t = static_cast<float>(i) / 50;
+        const float u = 1.0f - t;
+        const float w1 = u * u * u;
+        const float w2 = 3 * u * u * t;
+        const float w3 = 3 * u * t * t;
+        const float w4 = t * t * t;
+        const Vec2 current(w1 * p0.x + w2 * p1.x + w3 * p2.x + w4 * p3.x,
+                           w1 * p0.y + w2 * p1.y + w3 * p2.y + w4 * p3.y);
+
+        const float dx = current.x - prev.x;
+        const float dy = current.y - prev.y;
+        const float length2 = dx * dx + dy * dy;
+        float s = length2 > 0.0001f ? ((point.x - prev.x) * dx + (point.y - prev.y) * dy) / length2 : 0.0f;
+        s = std::clamp(s, 0.0f, 1.0f);
+        const float ex = point.x - (prev.x + s * dx);
+        const float ey = point.y - (prev.y + s * dy);
+        minDistance = std::min(minDistance, std::sqrt(ex * ex + ey * ey));
+
+        prev = current;
+    }
+    return minDistance;
+}
+
+NODE_EDITOR_BENCHMARK(CubicDistanceSampled) {
+    CubicSet set = randomConnections(context.size());
+    std::vector<float> distances(context.size());
+
+    context.measure(16, [&]() {
+        for (size_t i = 0; i < context.size(); ++i) {
+            const Vec2 *p = &set.points[i * 4];
+            distances[i] = sampledDistance(set.query, p[0], p[1], p[2], p[3]);
+        }
+        doNotOptimize(distances.data());
+    });
+    context.setItemsProcessed(16 * context.size());
+}
+
+NODE_EDITOR_BENCHMARK(CubicDistanceScalar) {
+    CubicSet set = randomConnections(context.size());
+    std::vector<float> distances(context.size());
+
+    context.measure(16, [&]() {
+        for (size_t i = 0; i < context.size(); ++i) {
+            const Vec2 *p = &set.points[i * 4];
+            distances[i] = CurveDistance::toCubic(set.query, p[0], p[1], p[2], p[3]);
+        }
+        doNotOptimize(distances.data());
+    });
+    context.setItemsProcessed(16 * context.size());
+}
+
+NODE_EDITOR_BENCHMARK(CubicDistanceBatch) {
+    CubicSet set = randomConnections(context.size());
+    std::vector<float> distances(context.size());
+
+    context.measure(16, [&]() {
+        set.batch.distances(set.query, FLT_MAX, distances.data());
+        doNotOptimize(distances.data());
+    });
+    context.setItemsProcessed(16 * context.size());
+}
+
+NODE_EDITOR_BENCHMARK(CubicDistanceBatchCulled) {
+    CubicSet set = randomConnections(context.size());
+    std::vector<float> distances(context.size());
+
+    context.measure(16, [&]() {
+        set.batch.distances(set.query, 12.0f, distances.data());
+        doNotOptimize(distances.data());
+    });
+    context.setItemsProcessed(16 * context.size());
+}
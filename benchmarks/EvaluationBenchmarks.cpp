@@ -0,0 +1,138 @@
+#include "Benchmark.h"
+#include "../AdvancedNodeEditor/NodeEditorAPI.h"
+
+using namespace NodeEditorCore;
+using namespace NodeEditorBenchmarks;
+
+static std::unique_ptr<NodeEditorAPI> buildChain(size_t length) {
+    auto api = std::make_unique<NodeEditorAPI>();
+
+    NodeEditorAPI::NodeDefinition constant;
+    constant.type = "Constant";
+    constant.name = "Constant";
+    constant.outputs = {{"Value", PinType::Blue}};
+    api->registerNodeType(constant);
+
+    NodeEditorAPI::NodeDefinition increment;
+    increment.type = "Increment";
+    increment.name = "Increment";
+    increment.inputs = {{"Value", PinType::Blue}};
+    increment.outputs = {{"Result", PinType::Blue}};
+    api->registerNodeType(increment);
+
+    api->registerEvaluator("Increment", [](const std::vector<std::any> &inputs) -> std::any {
+        return std::any_cast<float>(inputs[0]) + 1.0f;
+    });
+    api->registerTypedEvaluator("Increment", [](std::span<const EvaluationValue> inputs,
+                                                std::span<EvaluationValue> outputs) {
+        outputs[0] = inputs[0].asFloat() + 1.0f;
+    });
+
+    api->beginBatch(length, length);
+    UUID previous = api->createNode("Constant", "Source", Vec2(0, 0));
+    api->setConstantValue(previous, 0.0f);
+    std::string outputPin = "Value";
+    for (size_t i = 1; i < length; ++i) {
+        UUID next = api->createNode("Increment", "Increment", Vec2(static_cast<float>(i) * 10.0f, 0));
+        api->connectNodes(previous, outputPin, next, "Value");
+        previous = next;
+        outputPin = "Result";
+    }
+    api->endBatch();
+
+    return api;
+}
+
+NODE_EDITOR_BENCHMARK(EvaluateChainAny) {
+    auto api = buildChain(context.size());
+    api->evaluateGraph();
+
+    context.measure(5, [&]() {
+        api->invalidateEvaluation();
+        doNotOptimize(api->evaluateGraph());
+    });
+    context.setItemsProcessed(context.size() * 5);
+}
+
+NODE_EDITOR_BENCHMARK(EvaluateChainTyped) {
+    auto api = buildChain(context.size());
+    api->evaluateGraphTyped();
+
+    context.measure(5, [&]() {
+        doNotOptimize(api->evaluateGraphTyped());
+    });
+    context.setItemsProcessed(context.size() * 5);
+}
+
+struct MathGraph {
+    std::unique_ptr<NodeEditorAPI> api;
+    UUID a, b, c, result;
+};
+
+static MathGraph buildMathGraph() {
+    MathGraph graph;
+    graph.api = std::make_unique<NodeEditorAPI>();
+    NodeEditorAPI &api = *graph.api;
+
+    api.registerNodeType({"Math.Constant", "Constant", "Math", "", "C", {}, {{"Value", PinType::Blue}}});
+    for (const char *type: {"Math.Add", "Math.Multiply", "Math.Subtract"}) {
+        api.registerNodeType({type, type, "Math", "", "", {{"A", PinType::Blue}, {"B", PinType::Blue}},
+                              {{"Result", PinType::Blue}}});
+    }
+
+    api.registerEvaluator("Math.Add", [](const std::vector<std::any> &inputs) -> std::any {
+        return std::any_cast<float>(inputs[0]) + std::any_cast<float>(inputs[1]);
+    });
+    api.registerEvaluator("Math.Multiply", [](const std::vector<std::any> &inputs) -> std::any {
+        return std::any_cast<float>(inputs[0]) * std::any_cast<float>(inputs[1]);
+    });
+    api.registerEvaluator("Math.Subtract", [](const std::vector<std::any> &inputs) -> std::any {
+        return std::any_cast<float>(inputs[0]) - std::any_cast<float>(inputs[1]);
+    });
+    api.registerBuiltinBatchEvaluators();
+
+    graph.a = api.createNode("Math.Constant", "A", Vec2(0, 0));
+    graph.b = api.createNode("Math.Constant", "B", Vec2(0, 100));
+    graph.c = api.createNode("Math.Constant", "C", Vec2(0, 200));
+    UUID add = api.createNode("Math.Add", "Add", Vec2(200, 50));
+    UUID multiply = api.createNode("Math.Multiply", "Multiply", Vec2(400, 100));
+    graph.result = api.createNode("Math.Subtract", "Subtract", Vec2(600, 100));
+
+    api.setConstantValue(graph.a, 1.0f);
+    api.setConstantValue(graph.b, 2.0f);
+    api.setConstantValue(graph.c, 3.0f);
+    api.connectNodes(graph.a, "Value", add, "A");
+    api.connectNodes(graph.b, "Value", add, "B");
+    api.connectNodes(add, "Result", multiply, "A");
+    api.connectNodes(graph.c, "Value", multiply, "B");
+    api.connectNodes(multiply, "Result", graph.result, "A");
+    api.connectNodes(graph.a, "Value", graph.result, "B");
+
+    return graph;
+}
+
+NODE_EDITOR_BENCHMARK(SweepPerLaneEvaluateGraph) {
+    MathGraph graph = buildMathGraph();
+    std::vector<float> sweep(context.size());
+    for (size_t i = 0; i < sweep.size(); ++i) sweep[i] = static_cast<float>(i);
+
+    context.measure(1, [&]() {
+        for (float value: sweep) {
+            graph.api->setConstantValue(graph.a, value);
+            doNotOptimize(graph.api->evaluateGraph(graph.result));
+        }
+    });
+    context.setItemsProcessed(sweep.size());
+}
+
+NODE_EDITOR_BENCHMARK(SweepBatchEvaluateGraph) {
+    MathGraph graph = buildMathGraph();
+    std::vector<float> sweep(context.size());
+    for (size_t i = 0; i < sweep.size(); ++i) sweep[i] = static_cast<float>(i);
+    std::unordered_map<UUID, std::span<const float>> columns = {{graph.a, sweep}};
+
+    context.measure(1, [&]() {
+        doNotOptimize(graph.api->evaluateGraphBatch(columns, sweep.size(), graph.result));
+    });
+    context.setItemsProcessed(sweep.size());
+}
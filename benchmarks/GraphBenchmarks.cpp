@@ -0,0 +1,457 @@
+#include <algorithm>
+#include <random>
+#include "Benchmark.h"
+#include "../AdvancedNodeEditor/Core/NodeEditor.h"
+#include "../AdvancedNodeEditor/Editor/Controller/NodeEditorController.h"
+#include "../AdvancedNodeEditor/Editor/View/NodeEditorView.h"
+
+using namespace NodeEditorCore;
+using namespace NodeEditorBenchmarks;
+
+struct SyntheticGraph {
+    std::vector<int> nodes;
+    std::vector<int> inputPins;
+    std::vector<int> outputPins;
+};
+
+static Vec2 gridPosition(size_t index) {
+    const size_t columns = 100;
+    return Vec2(static_cast<float>(index % columns) * 250.0f, static_cast<float>(index / columns) * 150.0f);
+}
+
+static SyntheticGraph addNodes(NodeEditor &editor, size_t count) {
+    SyntheticGraph graph;
+    graph.nodes.reserve(count);
+    graph.inputPins.reserve(count);
+    graph.outputPins.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        int nodeId = editor.addNode("Node", "Default", gridPosition(i));
+        graph.nodes.push_back(nodeId);
+        graph.inputPins.push_back(editor.addPin(nodeId, "In", true));
+        graph.outputPins.push_back(editor.addPin(nodeId, "Out", false));
+    }
+
+    return graph;
+}
+
+static void connectChain(NodeEditor &editor, const SyntheticGraph &graph) {
+    for (size_t i = 1; i < graph.nodes.size(); ++i) {
+        editor.addConnection(graph.nodes[i - 1], graph.outputPins[i - 1], graph.nodes[i], graph.inputPins[i]);
+    }
+}
+
+static SyntheticGraph buildChain(NodeEditor &editor, size_t count) {
+    editor.beginBatch(count, count);
+    SyntheticGraph graph = addNodes(editor, count);
+    connectChain(editor, graph);
+    editor.endBatch();
+    return graph;
+}
+
+class CanvasFrame {
+public:
+    CanvasFrame() : m_context(ImGui::CreateContext()) {
+        ImGuiIO &io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+
+        unsigned char *pixels = nullptr;
+        int width = 0;
+        int height = 0;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    }
+
+    ~CanvasFrame() {
+        ImGui::DestroyContext(m_context);
+    }
+
+    int draw(NodeEditor &editor) {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+        ImGui::Begin("Canvas");
+
+        ImDrawList *drawList = ImGui::GetWindowDrawList();
+        const int before = drawList->VtxBuffer.Size;
+        editor.renderCanvas(drawList, ImVec2(0.0f, 0.0f), ImGui::GetIO().DisplaySize);
+        const int vertices = drawList->VtxBuffer.Size - before;
+
+        ImGui::End();
+        ImGui::EndFrame();
+        return vertices;
+    }
+
+private:
+    ImGuiContext *m_context;
+};
+
+NODE_EDITOR_BENCHMARK(AddNodes) {
+    for (int repetition = 0; repetition < 3; ++repetition) {
+        NodeEditor editor;
+        context.measure(1, [&]() {
+            doNotOptimize(addNodes(editor, context.size()));
+        });
+    }
+    context.setItemsProcessed(context.size() * 3);
+}
+
+NODE_EDITOR_BENCHMARK(AddConnections) {
+    for (int repetition = 0; repetition < 3; ++repetition) {
+        NodeEditor editor;
+        SyntheticGraph graph = addNodes(editor, context.size());
+        context.measure(1, [&]() {
+            connectChain(editor, graph);
+        });
+    }
+    context.setItemsProcessed((context.size() - 1) * 3);
+}
+
+NODE_EDITOR_BENCHMARK(RemoveNodes, 10000) {
+    std::mt19937 random(42);
+
+    for (int repetition = 0; repetition < 3; ++repetition) {
+        NodeEditor editor;
+        SyntheticGraph graph = buildChain(editor, context.size());
+        std::shuffle(graph.nodes.begin(), graph.nodes.end(), random);
+
+        context.measure(1, [&]() {
+            for (int nodeId: graph.nodes) {
+                editor.removeNode(nodeId);
+            }
+        });
+    }
+    context.setItemsProcessed(context.size() * 3);
+}
+
+NODE_EDITOR_BENCHMARK(ChurnNodes, 10000) {
+    NodeEditor editor;
+    SyntheticGraph graph = addNodes(editor, context.size());
+    std::mt19937 random(42);
+
+    context.measure(context.size(), [&, index = size_t(0)]() mutable {
+        size_t slot = random() % graph.nodes.size();
+        editor.removeNode(graph.nodes[slot]);
+        graph.nodes[slot] = editor.addNode("Node", "Default", gridPosition(index++));
+    });
+
+    int maxNodeId = 0;
+    for (const Node &node: editor.getNodes()) {
+        maxNodeId = std::max(maxNodeId, node.id);
+    }
+    context.setCounter("max_id_per_node", static_cast<double>(maxNodeId) / static_cast<double>(context.size()));
+    context.setItemsProcessed(context.size());
+}
+
+NODE_EDITOR_BENCHMARK(LookupNodeById) {
+    NodeEditor editor;
+    SyntheticGraph graph = addNodes(editor, context.size());
+    std::shuffle(graph.nodes.begin(), graph.nodes.end(), std::mt19937(42));
+
+    const size_t lookups = 100000;
+    context.measure(lookups, [&, index = size_t(0)]() mutable {
+        doNotOptimize(editor.getNode(graph.nodes[index]));
+        index = index + 1 == graph.nodes.size() ? 0 : index + 1;
+    });
+    context.setItemsProcessed(lookups);
+}
+
+NODE_EDITOR_BENCHMARK(LookupNodeByUUID) {
+    NodeEditor editor;
+    SyntheticGraph graph = addNodes(editor, context.size());
+
+    std::vector<UUID> uuids;
+    uuids.reserve(graph.nodes.size());
+    for (int nodeId: graph.nodes) {
+        uuids.push_back(editor.getNodeUUID(nodeId));
+    }
+    std::shuffle(uuids.begin(), uuids.end(), std::mt19937(42));
+
+    const size_t lookups = 100000;
+    context.measure(lookups, [&, index = size_t(0)]() mutable {
+        doNotOptimize(editor.getNodeByUUID(uuids[index]));
+        index = index + 1 == uuids.size() ? 0 : index + 1;
+    });
+    context.setItemsProcessed(lookups);
+}
+
+NODE_EDITOR_BENCHMARK(CompileEvaluationPlan) {
+    NodeEditor editor;
+    buildChain(editor, context.size());
+
+    context.measure(5, [&]() {
+        doNotOptimize(NodeEvaluator(editor).compile());
+    });
+    context.setItemsProcessed(context.size() * 5);
+}
+
+NODE_EDITOR_BENCHMARK(GetEvaluationOrderCached) {
+    NodeEditor editor;
+    buildChain(editor, context.size());
+    editor.getEvaluationPlan();
+
+    context.measure(5, [&]() {
+        doNotOptimize(editor.getEvaluationOrder());
+    });
+    context.setItemsProcessed(context.size() * 5);
+}
+
+NODE_EDITOR_BENCHMARK(LoadGraphState) {
+    NodeEditor source;
+    buildChain(source, context.size());
+
+    EditorState editorState;
+    editorState.nodes = source.getNodes();
+    editorState.connections = source.getConnections();
+    SerializedState state(editorState);
+
+    for (int repetition = 0; repetition < 3; ++repetition) {
+        NodeEditor editor;
+        context.measure(1, [&]() {
+            editor.loadGraphState(state);
+        });
+    }
+    context.setItemsProcessed(context.size() * 3);
+}
+
+NODE_EDITOR_BENCHMARK(HoverHitTest) {
+    NodeEditor editor;
+    buildChain(editor, context.size());
+
+    Vec2 extent = gridPosition(context.size() - 1) + Vec2(250.0f, 150.0f);
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> x(0.0f, std::min(extent.x, 1920.0f));
+    std::uniform_real_distribution<float> y(0.0f, std::min(extent.y, 1080.0f));
+
+    std::vector<Vec2> positions(16);
+    for (auto &position: positions) {
+        position = Vec2(x(random), y(random));
+    }
+
+    context.measure(positions.size(), [&, index = size_t(0)]() mutable {
+        editor.updateHoverState(positions[index++], Vec2(0.0f, 0.0f));
+        doNotOptimize(editor.getHoveredNodeId());
+    });
+    context.setItemsProcessed(positions.size());
+}
+
+NODE_EDITOR_BENCHMARK(ConnectionDistanceQuery) {
+    NodeEditor editor;
+    buildChain(editor, context.size());
+    editor.updateHoverState(Vec2(0.0f, 0.0f), Vec2(0.0f, 0.0f));
+
+    const std::vector<Connection> &connections = editor.getConnections();
+    std::vector<ImVec2> positions;
+    positions.reserve(connections.size());
+    for (const auto &connection: connections) {
+        const Node *from = editor.getNode(connection.startNodeId);
+        const Node *to = editor.getNode(connection.endNodeId);
+        positions.push_back(editor.canvasToScreen(Vec2((from->position.x + to->position.x) * 0.5f + 20.0f,
+                                                       (from->position.y + from->size.y + to->position.y) * 0.5f))
+            .toImVec2());
+    }
+
+    const size_t queries = connections.size() * 8;
+    context.measure(queries, [&, index = size_t(0)]() mutable {
+        int insertIndex = 0;
+        doNotOptimize(editor.getDistanceToConnection(connections[index], positions[index], ImVec2(0.0f, 0.0f),
+                                                     insertIndex));
+        index = index + 1 == connections.size() ? 0 : index + 1;
+    });
+    context.setItemsProcessed(queries);
+}
+
+NODE_EDITOR_BENCHMARK(HoverHitTestNodes) {
+    NodeEditor editor;
+    addNodes(editor, context.size());
+
+    Vec2 extent = gridPosition(context.size() - 1) + Vec2(250.0f, 150.0f);
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> x(0.0f, extent.x);
+    std::uniform_real_distribution<float> y(0.0f, extent.y);
+
+    std::vector<Vec2> positions(64);
+    for (auto &position: positions) {
+        position = Vec2(x(random), y(random));
+    }
+
+    context.measure(positions.size(), [&, index = size_t(0)]() mutable {
+        editor.updateHoverState(positions[index++], Vec2(0.0f, 0.0f));
+        doNotOptimize(editor.getHoveredNodeId());
+    });
+    context.setItemsProcessed(positions.size());
+}
+
+NODE_EDITOR_BENCHMARK(MinimapBounds) {
+    NodeEditor editor;
+    addNodes(editor, context.size());
+    editor.updateMinimapBounds();
+
+    context.measure(16, [&]() {
+        editor.updateMinimapBounds();
+    });
+    context.setItemsProcessed(16 * context.size());
+}
+
+NODE_EDITOR_BENCHMARK(GraphMemory) {
+    size_t before = allocatedBytes();
+    auto editor = std::make_unique<NodeEditor>();
+    size_t empty = allocatedBytes();
+
+    context.measure(1, [&]() {
+        buildChain(*editor, context.size());
+    });
+
+    size_t bytes = allocatedBytes() - empty;
+    context.setCounter("graph_bytes", static_cast<double>(bytes));
+    context.setCounter("bytes_per_node", static_cast<double>(bytes) / static_cast<double>(context.size()));
+    context.setCounter("editor_bytes", static_cast<double>(empty - before));
+    context.setItemsProcessed(context.size());
+}
+
+NODE_EDITOR_BENCHMARK(LookupConnectionByUUID) {
+    NodeEditor editor;
+    buildChain(editor, context.size() + 1);
+
+    std::vector<UUID> uuids;
+    uuids.reserve(context.size());
+    for (const auto &connection: editor.getConnections()) {
+        uuids.push_back(connection.uuid);
+    }
+    std::shuffle(uuids.begin(), uuids.end(), std::mt19937(42));
+
+    const size_t lookups = 100000;
+    context.measure(lookups, [&, index = size_t(0)]() mutable {
+        doNotOptimize(editor.getConnectionByUUID(uuids[index]));
+        index = index + 1 == uuids.size() ? 0 : index + 1;
+    });
+    context.setItemsProcessed(lookups);
+}
+
+NODE_EDITOR_BENCHMARK(CreateRegisteredNodes) {
+    NodeEditor editor;
+    editor.registerNodeType("Math.Add", "Math", "Adds two values", [](const Vec2 &position) {
+        Node *node = new Node(0, "Add", "Math.Add", position);
+        node->inputs.emplace_back(0, "A", true, PinType::Blue);
+        node->inputs.emplace_back(0, "B", true, PinType::Blue);
+        node->outputs.emplace_back(0, "Result", false, PinType::Blue);
+        return node;
+    });
+    editor.beginBatch(context.size(), 0);
+    editor.createNodeOfType("Math.Add", Vec2(0.0f, 0.0f));
+
+    size_t allocationsBefore = allocationCount();
+    context.measure(context.size() - 1, [&, index = size_t(1)]() mutable {
+        doNotOptimize(editor.createNodeOfType("Math.Add", gridPosition(index++)));
+    });
+    editor.endBatch();
+
+    context.setCounter("allocations_per_node", static_cast<double>(allocationCount() - allocationsBefore) /
+                                               static_cast<double>(context.size() - 1));
+    context.setItemsProcessed(context.size() - 1);
+}
+
+NODE_EDITOR_BENCHMARK(DestroyGraph) {
+    for (int repetition = 0; repetition < 3; ++repetition) {
+        auto editor = std::make_unique<NodeEditor>();
+        buildChain(*editor, context.size());
+
+        context.measure(1, [&]() {
+            editor.reset();
+        });
+    }
+    context.setItemsProcessed(context.size() * 3);
+}
+
+NODE_EDITOR_BENCHMARK(ControllerGraphMemory) {
+    size_t before = allocatedBytes();
+    auto controller = std::make_shared<NodeEditorController>();
+    auto view = std::make_shared<NodeEditorView>(controller);
+
+    context.measure(1, [&]() {
+        int previousNode = -1;
+        int previousPin = -1;
+        for (size_t i = 0; i < context.size(); ++i) {
+            int nodeId = controller->addNode("Node", "Default", gridPosition(i));
+            int inputPin = controller->addPin(nodeId, "In", true, PinType::Blue, PinShape::Circle);
+            int outputPin = controller->addPin(nodeId, "Out", false, PinType::Blue, PinShape::Circle);
+            if (previousNode >= 0) {
+                controller->addConnection(previousNode, previousPin, nodeId, inputPin);
+            }
+            previousNode = nodeId;
+            previousPin = outputPin;
+        }
+    });
+
+    size_t graphBytes = allocatedBytes() - before;
+    context.setCounter("graph_bytes", static_cast<double>(graphBytes));
+    context.setCounter("bytes_per_node", static_cast<double>(graphBytes) / static_cast<double>(context.size()));
+    context.setItemsProcessed(context.size());
+}
+
+NODE_EDITOR_BENCHMARK(ModelLookupNode) {
+    NodeEditorModel model;
+    std::vector<int> nodes;
+    nodes.reserve(context.size());
+    for (size_t i = 0; i < context.size(); ++i) {
+        nodes.push_back(model.addNode("Node", "Default", gridPosition(i)));
+    }
+    std::shuffle(nodes.begin(), nodes.end(), std::mt19937(42));
+
+    const size_t lookups = 100000;
+    context.measure(lookups, [&, index = size_t(0)]() mutable {
+        doNotOptimize(model.getNode(nodes[index]));
+        index = index + 1 == nodes.size() ? 0 : index + 1;
+    });
+    context.setItemsProcessed(lookups);
+}
+
+NODE_EDITOR_BENCHMARK(RenderCanvasZoomedIn) {
+    NodeEditor editor;
+    buildChain(editor, context.size());
+    editor.setViewPosition(Vec2(0.0f, 0.0f));
+    editor.setViewScale(1.0f);
+
+    CanvasFrame frame;
+    int vertices = frame.draw(editor);
+    context.measure(16, [&]() {
+        vertices = frame.draw(editor);
+    });
+    context.setCounter("vertices", vertices);
+}
+
+static void renderDetailLevel(BenchmarkContext &context, NodeEditor::DetailLevel level) {
+    NodeEditor editor;
+    SyntheticGraph graph = buildChain(editor, context.size());
+    for (size_t i = 0; i < graph.nodes.size(); i += 100) {
+        editor.addGroup("Group", gridPosition(i) - Vec2(20.0f, 20.0f), Vec2(25000.0f, 140.0f));
+    }
+    editor.setViewPosition(Vec2(0.0f, 0.0f));
+    editor.setViewScale(0.1f);
+
+    // Same zoomed-out view for every tier; only the thresholds move.
+    NodeEditorStyle style = editor.getStyle();
+    style.simplifiedDetailScale = level == NodeEditor::DetailLevel::Full ? 0.0f : 1.0f;
+    style.minimalDetailScale = level == NodeEditor::DetailLevel::Minimal ? 1.0f : 0.0f;
+    editor.setStyle(style);
+
+    CanvasFrame frame;
+    int vertices = frame.draw(editor);
+    context.measure(16, [&]() {
+        vertices = frame.draw(editor);
+    });
+    context.setCounter("vertices", vertices);
+    context.setCounter("vertices_per_node", static_cast<double>(vertices) / static_cast<double>(context.size()));
+}
+
+NODE_EDITOR_BENCHMARK(RenderDetailFull) {
+    renderDetailLevel(context, NodeEditor::DetailLevel::Full);
+}
+
+NODE_EDITOR_BENCHMARK(RenderDetailSimplified) {
+    renderDetailLevel(context, NodeEditor::DetailLevel::Simplified);
+}
+
+NODE_EDITOR_BENCHMARK(RenderDetailMinimal) {
+    renderDetailLevel(context, NodeEditor::DetailLevel::Minimal);
+}
@@ -0,0 +1,120 @@
+#include <thread>
+#include <unordered_map>
+#include "Benchmark.h"
+#include "../AdvancedNodeEditor/Utils/SortedUuidIndex.h"
+
+using namespace NodeEditorCore;
+using namespace NodeEditorBenchmarks;
+
+NODE_EDITOR_BENCHMARK(GenerateUuidV4) {
+    auto &generator = UuidGenerator::getInstance();
+
+    context.measure(context.size(), [&]() {
+        doNotOptimize(generator.generateV4());
+    });
+    context.setItemsProcessed(context.size());
+}
+
+NODE_EDITOR_BENCHMARK(GenerateUuidBatch) {
+    auto &generator = UuidGenerator::getInstance();
+    std::vector<Uuid> uuids(context.size());
+
+    context.measure(1, [&]() {
+        generator.generateBatch(uuids.data(), uuids.size());
+        doNotOptimize(uuids.data());
+    });
+    context.setItemsProcessed(context.size());
+}
+
+NODE_EDITOR_BENCHMARK(GenerateUuidV4Threaded) {
+    auto &generator = UuidGenerator::getInstance();
+    const size_t threadCount = std::max(2u, std::thread::hardware_concurrency());
+    const size_t perThread = context.size() / threadCount + 1;
+
+    context.measure(1, [&]() {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&]() {
+                for (size_t i = 0; i < perThread; ++i) {
+                    doNotOptimize(generator.generateV4());
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+    });
+    context.setItemsProcessed(perThread * threadCount);
+    context.setCounter("threads", static_cast<double>(threadCount));
+}
+
+NODE_EDITOR_BENCHMARK(FormatUuid) {
+    std::vector<Uuid> uuids = UuidGenerator::getInstance().generateBatch(context.size());
+
+    context.measure(1, [&]() {
+        for (const auto &uuid: uuids) {
+            doNotOptimize(uuid.toString());
+        }
+    });
+    context.setItemsProcessed(context.size());
+}
+
+static std::vector<Uuid> generateKeys(size_t count, UuidVersion version) {
+    auto &generator = UuidGenerator::getInstance();
+    UuidVersion previous = generator.getDefaultVersion();
+    generator.setDefaultVersion(version);
+    std::vector<Uuid> keys = generator.generateBatch(count);
+    generator.setDefaultVersion(previous);
+    return keys;
+}
+
+template<typename Index>
+static void insertKeys(BenchmarkContext &context, UuidVersion version) {
+    std::vector<Uuid> keys = generateKeys(context.size(), version);
+
+    for (int repetition = 0; repetition < 3; ++repetition) {
+        Index index;
+        context.measure(1, [&]() {
+            for (size_t i = 0; i < keys.size(); ++i) {
+                index.insert({keys[i], i});
+            }
+        });
+    }
+    context.setItemsProcessed(context.size() * 3);
+}
+
+struct SortedIndexAdapter {
+    SortedUuidIndex<size_t> index;
+    void insert(const std::pair<Uuid, size_t> &entry) { index.insert(entry.first, entry.second); }
+};
+
+NODE_EDITOR_BENCHMARK(SortedIndexInsertV4, 100000) {
+    insertKeys<SortedIndexAdapter>(context, UuidVersion::V4);
+}
+
+NODE_EDITOR_BENCHMARK(SortedIndexInsertV7) {
+    insertKeys<SortedIndexAdapter>(context, UuidVersion::V7);
+}
+
+NODE_EDITOR_BENCHMARK(HashIndexInsertV4) {
+    insertKeys<std::unordered_map<Uuid, size_t>>(context, UuidVersion::V4);
+}
+
+NODE_EDITOR_BENCHMARK(HashIndexInsertV7) {
+    insertKeys<std::unordered_map<Uuid, size_t>>(context, UuidVersion::V7);
+}
+
+NODE_EDITOR_BENCHMARK(SortedIndexLookupV7) {
+    std::vector<Uuid> keys = generateKeys(context.size(), UuidVersion::V7);
+    SortedUuidIndex<size_t> index;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        index.insert(keys[i], i);
+    }
+
+    context.measure(1, [&]() {
+        for (const auto &key: keys) {
+            doNotOptimize(index.find(key));
+        }
+    });
+    context.setItemsProcessed(context.size());
+}
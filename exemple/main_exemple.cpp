@@ -52,7 +52,7 @@ public:
         : m_editor(editor), m_constantValues(constantValues) {
     }
 
-    std::vector<NodeEvaluationInfo> evaluateGraph(const UUID &outputNodeId = "") {
+    std::vector<NodeEvaluationInfo> evaluateGraph(const UUID &outputNodeId = UUID()) {
         m_evaluationOrder.clear();
         m_nodeValues.clear();
         m_evaluationInfo.clear();
@@ -763,7 +763,7 @@ int main(int argc, char *argv[]) {
                     if (selectedNode) {
                         ImGui::Text("Node: %s", selectedNode->name.c_str());
                         ImGui::Text("Type: %s", selectedNode->type.c_str());
-                        ImGui::Text("UUID: %s", selectedNode->uuid.c_str());
+                        ImGui::Text("UUID: %s", selectedNode->uuid.toString().c_str());
                         ImGui::Separator();
 
                         if (selectedNode->type == "Math.Constant") {
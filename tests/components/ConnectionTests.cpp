@@ -76,6 +76,30 @@ TEST_F(ConnectionTests, ConnectionExistenceTests) {
     EXPECT_EQ(reverseId, -1);
 }
 
+TEST_F(ConnectionTests, AdjacencyFollowsRemovals) {
+    int thirdNode = editor.addNode("Node3", "Default", Vec2(500, 100));
+    int thirdInput = editor.addPin(thirdNode, "Input", true, PinType::Blue);
+
+    int first = editor.addConnection(1, outputPinId, 2, inputPinId);
+    int second = editor.addConnection(1, outputPinId, thirdNode, thirdInput);
+    ASSERT_NE(first, -1);
+    ASSERT_NE(second, -1);
+
+    EXPECT_EQ(editor.getOutputConnections(1).size(), 2);
+    EXPECT_EQ(editor.getInputConnections(thirdNode).size(), 1);
+
+    editor.removePin(2, inputPinId);
+    EXPECT_EQ(editor.getConnection(first), nullptr);
+    EXPECT_EQ(editor.getOutputConnections(1).size(), 1);
+    EXPECT_TRUE(editor.isConnected(1, outputPinId));
+
+    editor.removeNode(thirdNode);
+    EXPECT_EQ(editor.getConnection(second), nullptr);
+    EXPECT_TRUE(editor.getOutputConnections(1).empty());
+    EXPECT_FALSE(editor.isConnected(1, outputPinId));
+    EXPECT_FALSE(editor.getNode(1)->findPin(outputPinId)->connected);
+}
+
 TEST_F(ConnectionTests, ConnectionByUUID) {
     UUID node1Uuid = editor.getNodeUUID(1);
     UUID node2Uuid = editor.getNodeUUID(2);
@@ -162,7 +186,7 @@ protected:
         connectionId = editor.addConnection(1, outputPinId, 2, inputPinId);
         ASSERT_NE(connectionId, -1);
 
-        subgraphId = editor.createSubgraph("TestSubgraph", "", true);
+        subgraphId = editor.createSubgraph("TestSubgraph", UUID(), true);
         ASSERT_NE(subgraphId, -1);
     }
 };
@@ -236,7 +260,7 @@ TEST(ConnectionSubgraphFix, TestSpecificIssue) {
     std::cout << "Connection créée avec ID: " << connectionId << std::endl;
     ASSERT_NE(connectionId, -1);
 
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", true);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), true);
 
     editor.addNodeToSubgraph(1, subgraphId);
     editor.addNodeToSubgraph(2, subgraphId);
@@ -304,7 +328,7 @@ TEST(ConnectionDebugging, DiagnoseSubgraphConnections) {
     Connection *conn = editor.getConnection(connId);
     ASSERT_NE(conn, nullptr) << "La connexion n'a pas été créée correctement";
 
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", true);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), true);
     std::cout << "Subgraph créé avec ID: " << subgraphId << std::endl;
 
     Subgraph *subgraph = editor.getSubgraph(subgraphId);
@@ -404,7 +428,7 @@ TEST(ConnectionDiagnostic, VerifyPinsAndConnections) {
 
     ASSERT_GT(connectionId, 0) << "La connexion devrait avoir un ID positif";
 
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", true);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), true);
     std::cout << "Subgraph créé: " << subgraphId << std::endl;
 
     editor.addNodeToSubgraph(node1Id, subgraphId);
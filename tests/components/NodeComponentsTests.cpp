@@ -22,7 +22,7 @@ TEST(NodeComponentsTests, NodeCreation) {
 }
 
 TEST(NodeComponentsTests, NodeWithExistingUuid) {
-    UUID existingUuid = "12345678-1234-1234-1234-123456789abc";
+    UUID existingUuid("12345678-1234-1234-1234-123456789abc");
     Node node(existingUuid, 1, "TestNode", "TestType", Vec2(100.0f, 100.0f));
     
     EXPECT_EQ(node.id, 1);
@@ -43,7 +43,7 @@ TEST(NodeComponentsTests, PinCreation) {
 }
 
 TEST(NodeComponentsTests, PinWithShapeAndUuid) {
-    UUID existingUuid = "12345678-1234-1234-1234-123456789abc";
+    UUID existingUuid("12345678-1234-1234-1234-123456789abc");
     Pin pin(existingUuid, 1, "TestPin", false, PinType::Red, PinShape::Square);
     
     EXPECT_EQ(pin.id, 1);
@@ -80,8 +80,8 @@ TEST(NodeComponentsTests, NodeFindPin) {
 TEST(NodeComponentsTests, NodeFindPinByUUID) {
     Node node(1, "TestNode", "TestType", Vec2(100.0f, 100.0f));
     
-    UUID inputUuid = "12345678-1234-1234-1234-123456789abc";
-    UUID outputUuid = "98765432-9876-9876-9876-987654321fed";
+    UUID inputUuid("12345678-1234-1234-1234-123456789abc");
+    UUID outputUuid("98765432-9876-9876-9876-987654321fed");
     
     Pin inputPin(inputUuid, 1, "Input", true, PinType::Blue, PinShape::Circle);
     Pin outputPin(outputUuid, 2, "Output", false, PinType::Red, PinShape::Square);
@@ -99,7 +99,7 @@ TEST(NodeComponentsTests, NodeFindPinByUUID) {
     EXPECT_EQ(foundOutputPin->id, 2);
     EXPECT_EQ(foundOutputPin->name, "Output");
     
-    Pin* notFoundPin = node.findPinByUUID("non-existent-uuid");
+    Pin* notFoundPin = node.findPinByUUID(UUID("non-existent-uuid"));
     EXPECT_EQ(notFoundPin, nullptr);
 }
 
@@ -139,8 +139,46 @@ TEST(NodeComponentsTests, SubgraphOperations) {
     node.setSubgraphId(5);
     EXPECT_EQ(node.getSubgraphId(), 5);
     
-    node.setAsSubgraph(true, 10, "subgraph-uuid");
+    node.setAsSubgraph(true, 10, UUID("subgraph-uuid"));
     EXPECT_TRUE(node.isSubgraph);
     EXPECT_EQ(node.subgraphId, 10);
-    EXPECT_EQ(node.subgraphUuid, "subgraph-uuid");
-}
\ No newline at end of file
+    EXPECT_EQ(node.subgraphUuid, UUID("subgraph-uuid"));
+}
+
+TEST(NodeComponentsTests, RegisteredMetadataKeys) {
+    static const auto weightKey = Metadata::registerKey<float>("weight");
+    static const auto ownerKey = Metadata::registerKey<UUID>("owner");
+    static const auto tagsKey = Metadata::registerKey<std::vector<int>>("tags");
+
+    Metadata metadata;
+    EXPECT_TRUE(metadata.empty());
+    EXPECT_EQ(metadata.findAttribute(weightKey), nullptr);
+    EXPECT_EQ(metadata.getAttribute(weightKey, 2.0f), 2.0f);
+
+    UUID owner = generateUUID();
+    metadata.setAttribute(weightKey, 0.5f);
+    metadata.setAttribute(ownerKey, owner);
+    metadata.setAttribute(tagsKey, std::vector<int>{1, 2, 3});
+    metadata.setAttribute(weightKey, 0.75f);
+
+    EXPECT_EQ(metadata.size(), 3);
+    EXPECT_EQ(metadata.getAttribute(weightKey), 0.75f);
+    EXPECT_EQ(metadata.getAttribute(ownerKey), owner);
+    ASSERT_NE(metadata.findAttribute(tagsKey), nullptr);
+    EXPECT_EQ(metadata.findAttribute(tagsKey)->size(), 3);
+
+    EXPECT_EQ(metadata.getAttribute<float>("weight"), 0.75f);
+    EXPECT_EQ(metadata.getAttribute<int>("weight", -1), -1);
+    EXPECT_TRUE(metadata.hasAttribute("owner"));
+
+    metadata.setAttribute("label", "text");
+    EXPECT_EQ(metadata.getAttribute<std::string>("label"), "text");
+
+    size_t symbols = SymbolTable::getInstance().size();
+    EXPECT_FALSE(metadata.hasAttribute("neverRegisteredKey"));
+    EXPECT_EQ(SymbolTable::getInstance().size(), symbols);
+
+    metadata.removeAttribute("owner");
+    EXPECT_FALSE(metadata.hasAttribute("owner"));
+    EXPECT_EQ(metadata.size(), 3);
+}
@@ -68,7 +68,7 @@ protected:
 };
 
 TEST_F(SubgraphTests, CreateSubgraph) {
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", false);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), false);
     EXPECT_GT(subgraphId, 0);
     
     Subgraph* subgraph = editor.getSubgraph(subgraphId);
@@ -85,7 +85,7 @@ TEST_F(SubgraphTests, CreateSubgraphWithUUID) {
 }
 
 TEST_F(SubgraphTests, AddNodeToSubgraph) {
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", false);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), false);
 
     editor.addNodeToSubgraph(1, subgraphId);
     editor.addNodeToSubgraph(2, subgraphId);
@@ -104,7 +104,7 @@ TEST_F(SubgraphTests, AddNodeToSubgraph) {
 }
 
 TEST_F(SubgraphTests, AddConnectionToSubgraph) {
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", false);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), false);
 
     editor.addNodeToSubgraph(1, subgraphId);
     editor.addNodeToSubgraph(2, subgraphId);
@@ -124,7 +124,7 @@ TEST_F(SubgraphTests, AddConnectionToSubgraph) {
 }
 
 TEST_F(SubgraphTests, RemoveNodeFromSubgraph) {
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", false);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), false);
 
     editor.addNodeToSubgraph(1, subgraphId);
     editor.addNodeToSubgraph(2, subgraphId);
@@ -141,7 +141,7 @@ TEST_F(SubgraphTests, RemoveNodeFromSubgraph) {
 }
 
 TEST_F(SubgraphTests, RemoveConnectionFromSubgraph) {
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", false);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), false);
 
     editor.addConnectionToSubgraph(1, subgraphId);
     editor.removeConnectionFromSubgraph(1, subgraphId);
@@ -155,7 +155,7 @@ TEST_F(SubgraphTests, RemoveConnectionFromSubgraph) {
 }
 
 TEST_F(SubgraphTests, CurrentSubgraph) {
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", false);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), false);
 
     editor.setCurrentSubgraphId(subgraphId);
     EXPECT_EQ(editor.getCurrentSubgraphId(), subgraphId);
@@ -166,7 +166,7 @@ TEST_F(SubgraphTests, CurrentSubgraph) {
 }
 
 TEST_F(SubgraphTests, SubgraphProperties) {
-    int subgraphId = editor.createSubgraph("TestSubgraph", "", false);
+    int subgraphId = editor.createSubgraph("TestSubgraph", UUID(), false);
     Subgraph* subgraph = editor.getSubgraph(subgraphId);
     ASSERT_NE(subgraph, nullptr);
 
@@ -200,7 +200,7 @@ TEST_F(SubgraphTests, EnterSubgraphByUUID) {
     ASSERT_TRUE(result);
     EXPECT_EQ(editor.getCurrentSubgraphId(), subgraphId);
 
-    result = editor.enterSubgraphByUUID("non-existent-uuid");
+    result = editor.enterSubgraphByUUID(UUID("non-existent-uuid"));
     ASSERT_FALSE(result);
 }
 
@@ -232,7 +232,7 @@ TEST_F(SubgraphTests, GetSubgraphId) {
     int subgraphId = editor.getSubgraphId(uuid);
     ASSERT_NE(subgraphId, -1);
 
-    int nonExistentId = editor.getSubgraphId("non-existent-uuid");
+    int nonExistentId = editor.getSubgraphId(UUID("non-existent-uuid"));
     ASSERT_EQ(nonExistentId, -1);
 }
 
@@ -296,4 +296,18 @@ TEST_F(SubgraphTests, SubgraphNavigation) {
 
     editor.enterSubgraphByUUID(level1);
     EXPECT_EQ(editor.getCurrentSubgraphId(), editor.getSubgraphId(level1));
-}
\ No newline at end of file
+}
+
+TEST_F(SubgraphTests, InterfaceKeysDoNotCollideAboveSixteenBits) {
+    Subgraph subgraph(1, "Wide");
+    subgraph.exposeInput(2, 0);
+    subgraph.exposeOutput(70000, 3);
+
+    EXPECT_TRUE(subgraph.isInputExposed(2, 0));
+    EXPECT_FALSE(subgraph.isInputExposed(1, 65536));
+    EXPECT_TRUE(subgraph.isOutputExposed(70000, 3));
+    EXPECT_FALSE(subgraph.isOutputExposed(4464, 3));
+
+    subgraph.unexposeInput(1, 65536);
+    EXPECT_TRUE(subgraph.isInputExposed(2, 0));
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "../../AdvancedNodeEditor/Core/NodeEditor.h"
+#include "../../AdvancedNodeEditor/NodeEditorAPI.h"
 
 using namespace NodeEditorCore;
 
@@ -165,6 +166,97 @@ TEST_F(NodeEditorTests, UUIDOperations) {
     EXPECT_EQ(node, nullptr);
 }
 
+TEST_F(NodeEditorTests, LookupAfterRemovalAndGrowth) {
+    std::vector<int> nodeIds;
+    std::vector<UUID> nodeUuids;
+    for (int i = 0; i < 64; ++i) {
+        UUID uuid = editor.addNodeWithUUID("Node" + std::to_string(i), "Default", Vec2(i * 10.0f, 0));
+        nodeUuids.push_back(uuid);
+        nodeIds.push_back(editor.getNodeId(uuid));
+    }
+
+    Node* firstNode = editor.getNodeByUUID(nodeUuids[0]);
+    ASSERT_NE(firstNode, nullptr);
+    EXPECT_EQ(firstNode->id, nodeIds[0]);
+
+    editor.removeNode(nodeIds[10]);
+    editor.removeNodeByUUID(nodeUuids[20]);
+
+    EXPECT_EQ(editor.getNode(nodeIds[10]), nullptr);
+    EXPECT_EQ(editor.getNodeId(nodeUuids[20]), -1);
+
+    for (int i = 0; i < 64; ++i) {
+        if (i == 10 || i == 20) continue;
+
+        const Node* node = editor.getNode(nodeIds[i]);
+        ASSERT_NE(node, nullptr);
+        EXPECT_EQ(node->uuid, nodeUuids[i]);
+        EXPECT_EQ(editor.getNodeId(nodeUuids[i]), nodeIds[i]);
+        EXPECT_EQ(editor.getNodeByUUID(nodeUuids[i]), node);
+    }
+
+    int groupA = editor.addGroup("A", Vec2(0, 0), Vec2(100, 100));
+    int groupB = editor.addGroup("B", Vec2(0, 0), Vec2(100, 100));
+    UUID groupBUuid = editor.getGroupUUID(groupB);
+    editor.removeGroup(groupA);
+
+    EXPECT_EQ(editor.getGroup(groupA), nullptr);
+    EXPECT_EQ(editor.getGroupId(groupBUuid), groupB);
+    ASSERT_NE(editor.getGroupByUUID(groupBUuid), nullptr);
+    EXPECT_EQ(editor.getGroupByUUID(groupBUuid)->id, groupB);
+}
+
+TEST_F(NodeEditorTests, BatchDefersCreatedCallbacks) {
+    std::vector<int> createdNodes;
+    std::vector<int> createdConnections;
+    editor.setNodeCreatedCallback([&](int nodeId, const UUID&) { createdNodes.push_back(nodeId); });
+    editor.setConnectionCreatedCallback([&](int connectionId, const UUID&) { createdConnections.push_back(connectionId); });
+
+    editor.beginBatch(3, 2);
+    EXPECT_TRUE(editor.isBatching());
+
+    int first = editor.addNode("First", "Default", Vec2(0, 0));
+    int second = editor.addNode("Second", "Default", Vec2(100, 0));
+    int output = editor.addPin(first, "Out", false, PinType::Blue);
+    int input = editor.addPin(second, "In", true, PinType::Blue);
+    int connectionId = editor.addConnection(first, output, second, input);
+
+    EXPECT_TRUE(createdNodes.empty());
+    EXPECT_TRUE(createdConnections.empty());
+    EXPECT_NE(editor.getConnection(connectionId), nullptr);
+
+    editor.endBatch();
+    EXPECT_FALSE(editor.isBatching());
+
+    EXPECT_EQ(createdNodes, (std::vector<int>{first, second}));
+    EXPECT_EQ(createdConnections, (std::vector<int>{connectionId}));
+    EXPECT_TRUE(editor.getNode(first)->findPin(output)->connected);
+    EXPECT_TRUE(editor.getNode(second)->findPin(input)->connected);
+}
+
+TEST_F(NodeEditorTests, BatchSkipsCallbacksForEntitiesRemovedInsideIt) {
+    std::vector<int> createdNodes;
+    std::vector<int> createdConnections;
+    editor.setNodeCreatedCallback([&](int nodeId, const UUID&) { createdNodes.push_back(nodeId); });
+    editor.setConnectionCreatedCallback([&](int connectionId, const UUID&) { createdConnections.push_back(connectionId); });
+
+    editor.beginBatch();
+    int first = editor.addNode("First", "Default", Vec2(0, 0));
+    int second = editor.addNode("Second", "Default", Vec2(100, 0));
+    int output = editor.addPin(first, "Out", false, PinType::Blue);
+    int input = editor.addPin(second, "In", true, PinType::Blue);
+    int connectionId = editor.addConnection(first, output, second, input);
+
+    editor.removeNode(first);
+    int recreated = editor.addNode("Recreated", "Default", Vec2(0, 0));
+    ASSERT_EQ(recreated, first);
+    editor.endBatch();
+
+    EXPECT_EQ(createdNodes, (std::vector<int>{second, recreated}));
+    EXPECT_TRUE(createdConnections.empty());
+    EXPECT_EQ(editor.getConnection(connectionId), nullptr);
+}
+
 TEST_F(NodeEditorTests, RegisterNodeType) {
     editor.registerNodeType("CustomNode", "Test", "Test custom node",
                           [](const Vec2& pos) -> Node* {
@@ -177,4 +269,547 @@ TEST_F(NodeEditorTests, RegisterNodeType) {
     ASSERT_NE(customNode, nullptr);
     EXPECT_EQ(customNode->type, "CustomNode");
     EXPECT_EQ(customNode->iconSymbol, "C");
-}
\ No newline at end of file
+}
+
+TEST_F(NodeEditorTests, RegisteredTypeReusesPrototype) {
+    int builds = 0;
+    editor.registerNodeType("PooledNode", "Test", "Pooled node",
+                          [&builds](const Vec2& pos) -> Node* {
+                              ++builds;
+                              Node* node = new Node(0, "Pooled", "PooledNode", pos);
+                              node->inputs.emplace_back(0, "A", true, PinType::Blue);
+                              node->inputs.emplace_back(0, "B", true, PinType::Blue);
+                              node->outputs.emplace_back(0, "Out", false, PinType::Red);
+                              return node;
+                          }, true);
+
+    Node* first = editor.createNodeOfType("PooledNode", Vec2(0, 0));
+    ASSERT_NE(first, nullptr);
+    int firstId = first->id;
+    int secondId = editor.createNodeOfType("PooledNode", Vec2(200, 0))->id;
+    int thirdId = editor.createNodeOfType("PooledNode", Vec2(400, 0))->id;
+    EXPECT_EQ(builds, 1);
+
+    editor.removeNode(firstId);
+    const Node* second = editor.getNode(secondId);
+    const Node* third = editor.getNode(thirdId);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(third, nullptr);
+    ASSERT_EQ(second->inputs.size(), 2u);
+    ASSERT_EQ(third->outputs.size(), 1u);
+    EXPECT_EQ(second->inputs[1].name, "B");
+    EXPECT_EQ(third->outputs[0].type, PinType::Red);
+    EXPECT_NE(second->inputs[0].id, third->inputs[0].id);
+    EXPECT_EQ(second->inputs.get_allocator().resource(), third->inputs.get_allocator().resource());
+}
+
+TEST_F(NodeEditorTests, RegisteredTypeBuildsEachNodeUnlessCachingIsRequested) {
+    int builds = 0;
+    auto builder = [&builds](const Vec2& pos) -> Node* {
+        ++builds;
+        Node* node = new Node(0, "Counted " + std::to_string(builds), "CountedNode", pos);
+        node->outputs.emplace_back(0, "Out", false, PinType::Red);
+        return node;
+    };
+
+    editor.registerNodeType("CountedNode", "Test", "Counted node", builder);
+    EXPECT_EQ(editor.createNodeOfType("CountedNode", Vec2(0, 0))->name, "Counted 1");
+    EXPECT_EQ(editor.createNodeOfType("CountedNode", Vec2(100, 0))->name, "Counted 2");
+    EXPECT_EQ(builds, 2);
+
+    editor.registerNodeType("CountedNode", "Test", "Counted node", builder, true);
+    EXPECT_EQ(editor.createNodeOfType("CountedNode", Vec2(200, 0))->name, "Counted 3");
+    EXPECT_EQ(editor.createNodeOfType("CountedNode", Vec2(300, 0))->name, "Counted 3");
+
+    editor.registerNodeType("CountedNode", "Test", "Counted node", builder, true);
+    EXPECT_EQ(editor.createNodeOfType("CountedNode", Vec2(400, 0))->name, "Counted 4");
+    EXPECT_EQ(builds, 4);
+}
+
+TEST_F(NodeEditorTests, RemovedIdsAreRecycledWithNewGeneration) {
+    int first = editor.addNode("First", "Default", Vec2(0, 0));
+    int second = editor.addNode("Second", "Default", Vec2(100, 0));
+    int firstPin = editor.addPin(first, "Out", false, PinType::Blue);
+    int secondPin = editor.addPin(second, "In", true, PinType::Blue);
+    int connection = editor.addConnection(first, firstPin, second, secondPin);
+
+    Handle nodeHandle = editor.getNodeHandle(first);
+    Handle connectionHandle = editor.getConnectionHandle(connection);
+    EXPECT_TRUE(editor.isNodeHandleValid(nodeHandle));
+    EXPECT_EQ(editor.getNode(nodeHandle), editor.getNode(first));
+
+    editor.removeNode(first);
+    EXPECT_FALSE(editor.isNodeHandleValid(nodeHandle));
+    EXPECT_FALSE(editor.isConnectionHandleValid(connectionHandle));
+    EXPECT_EQ(editor.getNode(nodeHandle), nullptr);
+
+    int third = editor.addNode("Third", "Default", Vec2(200, 0));
+    EXPECT_EQ(third, first);
+    EXPECT_FALSE(editor.isNodeHandleValid(nodeHandle));
+    EXPECT_NE(editor.getNodeHandle(third), nodeHandle);
+    EXPECT_EQ(editor.getNode(third)->name, "Third");
+    EXPECT_EQ(editor.getNode(second)->name, "Second");
+
+    int thirdPin = editor.addPin(third, "Out", false, PinType::Blue);
+    EXPECT_EQ(editor.addConnection(third, thirdPin, second, secondPin), connection);
+    EXPECT_TRUE(editor.getPin(second, secondPin)->connected);
+}
+
+TEST_F(NodeEditorTests, RecycledIdsDoNotInheritSideTables) {
+    int subgraph = editor.createSubgraph("Inner", UUID(), false);
+    int group = editor.addGroup("Group", Vec2(0, 0), Vec2(500, 500));
+    int first = editor.addNode("First", "Default", Vec2(0, 0));
+    int second = editor.addNode("Second", "Default", Vec2(100, 0));
+    int firstPin = editor.addPin(first, "Out", false, PinType::Blue);
+    int secondPin = editor.addPin(second, "In", true, PinType::Blue);
+    int connection = editor.addConnection(first, firstPin, second, secondPin);
+    editor.addNodeToSubgraph(first, subgraph);
+    editor.addConnectionToSubgraph(connection, subgraph);
+    editor.addNodeToGroup(first, group);
+    editor.addReroute(connection, Vec2(50, 50));
+    ASSERT_EQ(editor.getReroutesForConnection(connection).size(), 1u);
+
+    editor.removeNode(first);
+
+    int third = editor.addNode("Third", "Default", Vec2(200, 0));
+    int thirdPin = editor.addPin(third, "Out", false, PinType::Blue);
+    ASSERT_EQ(third, first);
+    ASSERT_EQ(editor.addConnection(third, thirdPin, second, secondPin), connection);
+
+    EXPECT_TRUE(editor.getReroutesForConnection(connection).empty());
+    EXPECT_FALSE(editor.getSubgraph(subgraph)->containsNode(third));
+    EXPECT_FALSE(editor.getSubgraph(subgraph)->containsConnection(connection));
+    EXPECT_EQ(editor.getGroup(group)->nodes.count(third), 0u);
+}
+
+TEST_F(NodeEditorTests, LoadGraphStateRemapsInvalidIds) {
+    int first = editor.addNode("First", "Default", Vec2(0, 0));
+    int second = editor.addNode("Second", "Default", Vec2(100, 0));
+    int firstPin = editor.addPin(first, "Out", false, PinType::Blue);
+    int secondPin = editor.addPin(second, "In", true, PinType::Blue);
+    int connection = editor.addConnection(first, firstPin, second, secondPin);
+    int group = editor.addGroup("Group", Vec2(0, 0), Vec2(400, 200));
+
+    SerializedState state;
+    state.nodes.emplace_back(*editor.getNode(first));
+    state.nodes.emplace_back(*editor.getNode(second));
+    state.connections.emplace_back(*editor.getConnection(connection));
+
+    SerializedNode duplicate(*editor.getNode(second));
+    duplicate.uuid = UUID("duplicate");
+    duplicate.name = "Duplicate";
+    SerializedNode negative(*editor.getNode(second));
+    negative.uuid = UUID("negative");
+    negative.name = "Negative";
+    negative.id = -1;
+    SerializedNode huge(*editor.getNode(second));
+    huge.uuid = UUID("huge");
+    huge.name = "Huge";
+    huge.id = std::numeric_limits<int>::max();
+    state.nodes.push_back(duplicate);
+    state.nodes.push_back(negative);
+    state.nodes.push_back(huge);
+
+    SerializedConnection toDuplicate(*editor.getConnection(connection));
+    toDuplicate.id = connection + 1;
+    toDuplicate.uuid = UUID("to-duplicate");
+    toDuplicate.endNodeUuid = duplicate.uuid;
+    SerializedConnection fromHuge(*editor.getConnection(connection));
+    fromHuge.uuid = UUID("from-huge");
+    fromHuge.startNodeId = huge.id;
+    fromHuge.startNodeUuid.clear();
+    SerializedConnection dangling(*editor.getConnection(connection));
+    dangling.id = connection + 2;
+    dangling.uuid = UUID("dangling");
+    dangling.endNodeId = 999;
+    dangling.endNodeUuid.clear();
+    state.connections.push_back(toDuplicate);
+    state.connections.push_back(fromHuge);
+    state.connections.push_back(dangling);
+
+    SerializedGroup serializedGroup(*editor.getGroup(group));
+    serializedGroup.nodeIds = {huge.id};
+    serializedGroup.nodeUuids.clear();
+    state.groups.push_back(serializedGroup);
+
+    NodeEditor loaded;
+    EXPECT_EQ(loaded.loadGraphState(state), 1u);
+
+    EXPECT_EQ(loaded.getNodes().size(), 5u);
+    ASSERT_NE(loaded.getNode(second), nullptr);
+    EXPECT_EQ(loaded.getNode(second)->name, "Second");
+
+    const int duplicateId = loaded.getNodeId(duplicate.uuid);
+    const int negativeId = loaded.getNodeId(negative.uuid);
+    const int hugeId = loaded.getNodeId(huge.uuid);
+    for (int id: {duplicateId, negativeId, hugeId}) {
+        EXPECT_GT(id, 0);
+        EXPECT_LE(static_cast<uint32_t>(id), HandleAllocator::kMaxIndex);
+    }
+    EXPECT_NE(duplicateId, second);
+    EXPECT_EQ(loaded.getNode(duplicateId)->name, "Duplicate");
+    EXPECT_EQ(loaded.getNode(hugeId)->name, "Huge");
+
+    EXPECT_EQ(loaded.getConnections().size(), 3u);
+    const Connection *original = loaded.getConnectionByUUID(editor.getConnection(connection)->uuid);
+    ASSERT_NE(original, nullptr);
+    EXPECT_EQ(original->id, connection);
+    const Connection *loadedToDuplicate = loaded.getConnectionByUUID(toDuplicate.uuid);
+    ASSERT_NE(loadedToDuplicate, nullptr);
+    EXPECT_EQ(loadedToDuplicate->endNodeId, duplicateId);
+    const Connection *loadedFromHuge = loaded.getConnectionByUUID(fromHuge.uuid);
+    ASSERT_NE(loadedFromHuge, nullptr);
+    EXPECT_EQ(loadedFromHuge->startNodeId, hugeId);
+    EXPECT_NE(loadedFromHuge->id, connection);
+    EXPECT_EQ(loaded.getConnectionByUUID(dangling.uuid), nullptr);
+
+    ASSERT_EQ(loaded.getGroups().size(), 1u);
+    EXPECT_EQ(loaded.getGroups()[0].nodes, std::unordered_set<int>{hugeId});
+
+    int third = loaded.addNode("Third", "Default", Vec2(200, 0));
+    EXPECT_EQ(loaded.getNode(third)->name, "Third");
+    EXPECT_EQ(loaded.getNodes().size(), 6u);
+}
+
+TEST_F(NodeEditorTests, BuiltInCommandsAcceptUuidText) {
+    int kept = editor.addNode("Kept", "Default", Vec2(0, 0));
+    int removed = editor.addNode("Removed", "Default", Vec2(100, 0));
+    const std::string removedText = editor.getNodeUUID(removed).toString();
+
+    editor.dispatchToBackend(NodeEditorCommands::Node::Select, editor.getNodeUUID(kept).toString());
+    EXPECT_TRUE(editor.getNode(kept)->selected);
+
+    editor.dispatchToBackend(NodeEditorCommands::Node::Remove, std::string("not a uuid"));
+    EXPECT_EQ(editor.getNodes().size(), 2u);
+
+    editor.dispatchToBackend(NodeEditorCommands::Node::Remove, removedText);
+    EXPECT_EQ(editor.getNode(removed), nullptr);
+    EXPECT_NE(editor.getNode(kept), nullptr);
+}
+
+TEST_F(NodeEditorTests, ApiCommandsPassStringPayloadsThrough) {
+    NodeEditorAPI api;
+    std::string received;
+    api.getUnderlyingEditor()->bindToBackend("user.rename", [&received](const std::any& data) {
+        received = std::any_cast<std::string>(data);
+    });
+
+    const std::string uuidText = generateUUID().toString();
+    api.executeCommand("user.rename", uuidText);
+    EXPECT_EQ(received, uuidText);
+}
+
+TEST_F(NodeEditorTests, HandBuiltSerializedStateDefaultsToRootGraph) {
+    EXPECT_EQ(SerializedNode().subgraphId, -1);
+    EXPECT_EQ(SerializedConnection().subgraphId, -1);
+    EXPECT_EQ(SerializedGroup().subgraphId, -1);
+    EXPECT_EQ(SerializedSubgraph().inputNodeId, -1);
+    EXPECT_EQ(SerializedSubgraph().outputNodeId, -1);
+    EXPECT_EQ(SerializedSubgraph().parentSubgraphId, -1);
+
+    SerializedNode node;
+    node.id = 1;
+    node.uuid = UUID("hand-built");
+    node.name = "Hand built";
+    node.type = "Default";
+    node.size = Vec2(100, 50);
+    node.isSubgraph = false;
+
+    SerializedState state;
+    state.nodes.push_back(node);
+
+    NodeEditor loaded;
+    loaded.loadGraphState(state);
+
+    ASSERT_NE(loaded.getNode(1), nullptr);
+    EXPECT_EQ(loaded.getNode(1)->parentSubgraphId, -1);
+    EXPECT_EQ(loaded.getNode(1)->subgraphId, -1);
+}
+
+TEST_F(NodeEditorTests, NodeTypesAreInternedButPinNamesAreNot) {
+    int first = editor.addNode("First", "Math.Add", Vec2(0, 0));
+    int second = editor.addNode("Second", std::string("Math.") + "Add", Vec2(100, 0));
+    int pin = editor.addPin(first, "Free text pin name 7f3a", true, PinType::Blue);
+
+    const Node* a = editor.getNode(first);
+    const Node* b = editor.getNode(second);
+    EXPECT_EQ(a->type.id(), b->type.id());
+    EXPECT_EQ(a->findPin(pin)->name, "Free text pin name 7f3a");
+    EXPECT_TRUE(Symbol::find("Free text pin name 7f3a").empty());
+    EXPECT_EQ(a->type.str(), "Math.Add");
+    EXPECT_NE(a->type, Symbol("Math.Multiply"));
+    EXPECT_TRUE(Symbol().empty());
+    EXPECT_EQ(Symbol(""), Symbol());
+}
+
+TEST_F(NodeEditorTests, HoverHitTestUsesCurrentGeometry) {
+    editor.setViewPosition(Vec2(10, 20));
+    editor.setViewScale(2.0f);
+
+    int first = editor.addNode("First", "Default", Vec2(100, 100));
+    int second = editor.addNode("Second", "Default", Vec2(400, 100));
+    int hidden = editor.addNode("Hidden", "Default", Vec2(100, 100));
+    editor.getNode(hidden)->setSubgraphId(7);
+
+    int inputPin = 0;
+    for (int i = 0; i < 8; ++i) {
+        inputPin = editor.addPin(second, "In" + std::to_string(i), true, PinType::Blue);
+    }
+
+    editor.updateHoverState(editor.canvasToScreen(Vec2(150, 110)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredNodeId(), first);
+
+    editor.updateHoverState(editor.canvasToScreen(Vec2(400 + 20 + 7 * 25, 100)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredNodeId(), second);
+    EXPECT_EQ(editor.getHoveredPinId(), inputPin);
+
+    editor.getNode(first)->position = Vec2(1000, 1000);
+    editor.updateHoverState(editor.canvasToScreen(Vec2(150, 110)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredNodeId(), -1);
+
+    editor.updateHoverState(editor.canvasToScreen(Vec2(1010, 1010)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredNodeId(), first);
+}
+
+TEST_F(NodeEditorTests, MemoryStatsTrackGraphContents) {
+    MemoryStats empty = editor.getMemoryStats();
+    EXPECT_EQ(empty.nodes.count, 0u);
+    EXPECT_EQ(empty.connections.count, 0u);
+
+    int source = editor.addNode("Source", "Default", Vec2(0, 0));
+    int target = editor.addNode("Target", "Default", Vec2(200, 0));
+    int outPin = editor.addPin(source, "Out", false, PinType::Blue);
+    int inPin = editor.addPin(target, "In", true, PinType::Blue);
+    int connection = editor.addConnection(source, outPin, target, inPin);
+    editor.addGroup("Group", Vec2(0, 0), Vec2(400, 200));
+    editor.getNode(source)->setMetadata("label", std::string("a reasonably long label for the heap"));
+
+    MemoryStats stats = editor.getMemoryStats();
+    EXPECT_EQ(stats.nodes.count, 2u);
+    EXPECT_EQ(stats.pins.count, 2u);
+    EXPECT_EQ(stats.connections.count, 1u);
+    EXPECT_EQ(stats.groups.count, 1u);
+    EXPECT_EQ(stats.metadata.count, 1u);
+    EXPECT_EQ(stats.uuidMaps.count, 4u);
+    EXPECT_GE(stats.nodes.bytes, 2 * sizeof(Node));
+    EXPECT_GE(stats.pins.bytes, 2 * sizeof(Pin));
+    EXPECT_GT(stats.graphIndices.bytes, 0u);
+    EXPECT_GT(stats.graphPool.bytes, 0u);
+    EXPECT_GT(stats.graphPool.count, 0u);
+    EXPECT_GE(stats.symbols.count, 1u);
+    EXPECT_GT(stats.totalBytes(), empty.totalBytes());
+
+    int copy = editor.addNode("Copy", "Default", Vec2(0, 400));
+    editor.addPin(copy, "Out", false, PinType::Blue);
+    MemoryStats withCopy = editor.getMemoryStats();
+    EXPECT_EQ(withCopy.symbols.count, stats.symbols.count);
+    EXPECT_EQ(withCopy.symbols.bytes, stats.symbols.bytes);
+    editor.removeNode(copy);
+
+    editor.getCommandManager().getBackendRouter().setLoggingEnabled(true);
+    editor.getCommandManager().dispatchToBackend("memory.test", 1);
+    EXPECT_EQ(editor.getMemoryStats().commandLog.count, 1u);
+    editor.getCommandManager().getBackendRouter().clearLoggedCalls();
+    EXPECT_EQ(editor.getMemoryStats().commandLog.count, 0u);
+
+    size_t displayIds = editor.getMemoryStats().displayIdCache.count;
+    UUID uuid = editor.getNode(source)->uuid;
+    uuidToDisplayId(uuid);
+    EXPECT_EQ(editor.getMemoryStats().displayIdCache.count, displayIds + 1);
+    releaseDisplayId(uuid);
+    EXPECT_EQ(editor.getMemoryStats().displayIdCache.count, displayIds);
+
+    editor.removeConnection(connection);
+    editor.removeNode(target);
+    stats = editor.getMemoryStats();
+    EXPECT_EQ(stats.nodes.count, 1u);
+    EXPECT_EQ(stats.pins.count, 1u);
+    EXPECT_EQ(stats.connections.count, 0u);
+    EXPECT_EQ(stats.uuidMaps.count, 2u);
+}
+
+TEST_F(NodeEditorTests, ViewportQueriesCullOffscreenElements) {
+    editor.setViewPosition(Vec2(0, 0));
+    editor.setViewScale(1.0f);
+
+    int source = editor.addNode("Source", "Default", Vec2(0, 0));
+    int target = editor.addNode("Target", "Default", Vec2(1000, 100));
+    int hidden = editor.addNode("Hidden", "Default", Vec2(860, -60));
+    editor.getNode(hidden)->setSubgraphId(7);
+    int outPin = editor.addPin(source, "Out", false, PinType::Blue);
+    int inPin = editor.addPin(target, "In", true, PinType::Blue);
+    int connection = editor.addConnection(source, outPin, target, inPin);
+
+    EXPECT_EQ(editor.getNodesInViewport(Vec2(-10, -10), Vec2(50, 50)), std::vector<int>{source});
+    EXPECT_TRUE(editor.getConnectionsInViewport(Vec2(300, 700), Vec2(350, 750)).empty());
+
+    // The curve bows above both endpoints here, so only its conservative bounds reach this rect.
+    EXPECT_TRUE(editor.getNodesInViewport(Vec2(840, -70), Vec2(890, -35)).empty());
+    EXPECT_EQ(editor.getConnectionsInViewport(Vec2(840, -70), Vec2(890, -35)), std::vector<int>{connection});
+
+    editor.getNode(source)->position = Vec2(300, 700);
+    EXPECT_EQ(editor.getNodesInViewport(Vec2(300, 700), Vec2(350, 750)), std::vector<int>{source});
+    EXPECT_EQ(editor.getConnectionsInViewport(Vec2(300, 700), Vec2(350, 750)), std::vector<int>{connection});
+    EXPECT_TRUE(editor.getNodesInViewport(Vec2(-10, -10), Vec2(50, 50)).empty());
+
+    editor.getNode(source)->position = Vec2(0, 0);
+    editor.addReroute(connection, Vec2(-500, 2000));
+    EXPECT_EQ(editor.getConnectionsInViewport(Vec2(-520, 1980), Vec2(-480, 2020)), std::vector<int>{connection});
+}
+
+TEST_F(NodeEditorTests, NodeEditsKeepViewportQueriesCurrent) {
+    editor.setViewPosition(Vec2(0, 0));
+    editor.setViewScale(1.0f);
+
+    int first = editor.addNode("First", "Default", Vec2(0, 0));
+    int second = editor.addNode("Second", "Default", Vec2(400, 0));
+    int third = editor.addNode("Third", "Default", Vec2(800, 0));
+    EXPECT_EQ(editor.getNodesInViewport(Vec2(790, -10), Vec2(850, 50)), std::vector<int>{third});
+
+    editor.removeNode(second);
+    EXPECT_TRUE(editor.getNodesInViewport(Vec2(390, -10), Vec2(450, 50)).empty());
+    EXPECT_EQ(editor.getNodesInViewport(Vec2(790, -10), Vec2(850, 50)), std::vector<int>{third});
+
+    int fourth = editor.addNode("Fourth", "Default", Vec2(0, 400));
+    EXPECT_EQ(editor.getNodesInViewport(Vec2(-10, 390), Vec2(50, 450)), std::vector<int>{fourth});
+
+    editor.setNodePosition(third, Vec2(400, 0));
+    EXPECT_EQ(editor.getNodesInViewport(Vec2(390, -10), Vec2(450, 50)), std::vector<int>{third});
+    EXPECT_TRUE(editor.getNodesInViewport(Vec2(790, -10), Vec2(850, 50)).empty());
+
+    editor.setNodeSize(first, Vec2(700, 40));
+    EXPECT_EQ(editor.getNodesInViewport(Vec2(600, 10), Vec2(650, 30)), std::vector<int>{first});
+    EXPECT_EQ(editor.getNode(first)->size.x, 700.0f);
+}
+
+TEST_F(NodeEditorTests, ConnectionBoundsFollowRerouteEdits) {
+    int source = editor.addNode("Source", "Default", Vec2(0, 0));
+    int target = editor.addNode("Target", "Default", Vec2(0, 300));
+    int outPin = editor.addPin(source, "Out", false, PinType::Blue);
+    int inPin = editor.addPin(target, "In", true, PinType::Blue);
+    int connection = editor.addConnection(source, outPin, target, inPin);
+
+    int far = editor.addReroute(connection, Vec2(-500, 2000));
+    int near = editor.addReroute(connection, Vec2(100, 100), 0);
+    std::vector<Reroute> reroutes = editor.getReroutesForConnection(connection);
+    ASSERT_EQ(reroutes.size(), 2u);
+    EXPECT_EQ(reroutes[0].id, near);
+    EXPECT_EQ(reroutes[1].id, far);
+    EXPECT_EQ(editor.getConnectionsInViewport(Vec2(-520, 1980), Vec2(-480, 2020)), std::vector<int>{connection});
+
+    editor.getReroute(far)->position = Vec2(2000, -500);
+    EXPECT_TRUE(editor.getConnectionsInViewport(Vec2(-520, 1980), Vec2(-480, 2020)).empty());
+    EXPECT_EQ(editor.getConnectionsInViewport(Vec2(1980, -520), Vec2(2020, -480)), std::vector<int>{connection});
+
+    editor.removeReroute(far);
+    EXPECT_TRUE(editor.getConnectionsInViewport(Vec2(1980, -520), Vec2(2020, -480)).empty());
+    ASSERT_EQ(editor.getReroutesForConnection(connection).size(), 1u);
+    EXPECT_EQ(editor.getReroutesForConnection(connection)[0].id, near);
+}
+
+TEST_F(NodeEditorTests, HitTestsOnlyQueryNearbyCandidates) {
+    int source = editor.addNode("Source", "Default", Vec2(0, 0));
+    int target = editor.addNode("Target", "Default", Vec2(0, 300));
+    int outPin = editor.addPin(source, "Out", false, PinType::Blue);
+    int inPin = editor.addPin(target, "In", true, PinType::Blue);
+    int connection = editor.addConnection(source, outPin, target, inPin);
+
+    editor.updateHoverState(editor.canvasToScreen(Vec2(20, 164)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), connection);
+    EXPECT_EQ(editor.getHoveredNodeId(), -1);
+
+    editor.updateHoverState(editor.canvasToScreen(Vec2(400, 164)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), -1);
+
+    int reroute = editor.addReroute(connection, Vec2(-200, 150));
+    RerouteHitZone hitZone;
+    EXPECT_EQ(editor.findRerouteAtPosition(editor.canvasToScreen(Vec2(-200, 150)).toImVec2(), ImVec2(0, 0), hitZone),
+              reroute);
+    EXPECT_EQ(hitZone, RerouteHitZone::Inner);
+
+    editor.updateHoverState(editor.canvasToScreen(Vec2(20, 164)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), -1);
+
+    editor.getReroute(reroute)->position = Vec2(600, 600);
+    editor.updateHoverState(editor.canvasToScreen(Vec2(0, 0)), Vec2(0, 0));
+    EXPECT_EQ(editor.findRerouteAtPosition(editor.canvasToScreen(Vec2(600, 600)).toImVec2(), ImVec2(0, 0), hitZone),
+              reroute);
+    EXPECT_EQ(editor.findRerouteAtPosition(editor.canvasToScreen(Vec2(-200, 150)).toImVec2(), ImVec2(0, 0), hitZone),
+              -1);
+}
+
+TEST_F(NodeEditorTests, ConnectionGeometryFollowsNodeMoves) {
+    int source = editor.addNode("Source", "Default", Vec2(0, 0));
+    int target = editor.addNode("Target", "Default", Vec2(0, 300));
+    int outPin = editor.addPin(source, "Out", false, PinType::Blue);
+    int inPin = editor.addPin(target, "In", true, PinType::Blue);
+    int connection = editor.addConnection(source, outPin, target, inPin);
+
+    editor.updateHoverState(editor.canvasToScreen(Vec2(20, 164)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), connection);
+    editor.updateHoverState(editor.canvasToScreen(Vec2(1020, 164)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), -1);
+
+    editor.getNode(target)->position = Vec2(2000, 300);
+    editor.updateHoverState(editor.canvasToScreen(Vec2(1020, 164)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), connection);
+
+    int insertIndex = -1;
+    const Connection *conn = editor.getConnection(connection);
+    ASSERT_NE(conn, nullptr);
+    EXPECT_LT(editor.getDistanceToConnection(*conn, editor.canvasToScreen(Vec2(1020, 164)).toImVec2(), ImVec2(0, 0),
+                                             insertIndex), 1.0f);
+    EXPECT_EQ(insertIndex, 0);
+
+    editor.addReroute(connection, Vec2(1020, 900));
+    editor.updateHoverState(editor.canvasToScreen(Vec2(1020, 164)), Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), -1);
+    EXPECT_LT(editor.getDistanceToConnection(*conn, editor.canvasToScreen(Vec2(1020, 900)).toImVec2(), ImVec2(0, 0),
+                                             insertIndex), 1.0f);
+}
+
+TEST_F(NodeEditorTests, ConnectionGeometryFollowsStyleChanges) {
+    int source = editor.addNode("Source", "Default", Vec2(0, 0));
+    int target = editor.addNode("Target", "Default", Vec2(300, 300));
+    int outPin = editor.addPin(source, "Out", false, PinType::Blue);
+    int inPin = editor.addPin(target, "In", true, PinType::Blue);
+    int connection = editor.addConnection(source, outPin, target, inPin);
+    const Connection *conn = editor.getConnection(connection);
+    ASSERT_NE(conn, nullptr);
+
+    // Output pin sits at (20, 28) and input pin at (320, 300); this point is a quarter along the chord.
+    const Vec2 chordPoint = editor.canvasToScreen(Vec2(95, 96));
+    const ImVec2 onChord = chordPoint.toImVec2();
+    editor.updateHoverState(chordPoint, Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), -1);
+    int insertIndex = -1;
+    EXPECT_GT(editor.getDistanceToConnection(*conn, onChord, ImVec2(0, 0), insertIndex), 10.0f);
+
+    editor.setConnectionStyle(ConnectionStyleManager::ConnectionStyle::StraightLine);
+    editor.updateHoverState(chordPoint, Vec2(0, 0));
+    EXPECT_EQ(editor.getHoveredConnectionId(), connection);
+    EXPECT_LT(editor.getDistanceToConnection(*conn, onChord, ImVec2(0, 0), insertIndex), 1.0f);
+
+    editor.setConnectionStyle(ConnectionStyleManager::ConnectionStyle::Bezier);
+    EXPECT_GT(editor.getDistanceToConnection(*conn, onChord, ImVec2(0, 0), insertIndex), 10.0f);
+}
+
+TEST_F(NodeEditorTests, DetailLevelFollowsStyleThresholds) {
+    NodeEditorStyle style = editor.getStyle();
+    style.simplifiedDetailScale = 0.6f;
+    style.minimalDetailScale = 0.3f;
+    editor.setStyle(style);
+
+    editor.setViewScale(1.0f);
+    EXPECT_EQ(editor.getDetailLevel(), NodeEditor::DetailLevel::Full);
+    editor.setViewScale(0.6f);
+    EXPECT_EQ(editor.getDetailLevel(), NodeEditor::DetailLevel::Full);
+    editor.setViewScale(0.5f);
+    EXPECT_EQ(editor.getDetailLevel(), NodeEditor::DetailLevel::Simplified);
+    editor.setViewScale(0.2f);
+    EXPECT_EQ(editor.getDetailLevel(), NodeEditor::DetailLevel::Minimal);
+
+    style.minimalDetailScale = 0.0f;
+    editor.setStyle(style);
+    EXPECT_EQ(editor.getDetailLevel(), NodeEditor::DetailLevel::Simplified);
+}
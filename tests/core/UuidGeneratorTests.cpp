@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <type_traits>
 #include "../../AdvancedNodeEditor/Utils/UuidGenerator.h"
+#include "../../AdvancedNodeEditor/Utils/SortedUuidIndex.h"
 
 using namespace NodeEditorCore;
 
@@ -67,4 +71,113 @@ TEST(UuidGeneratorTests, NilUuid) {
     Uuid uuid = generator.generateV4();
     EXPECT_FALSE(uuid.isNil());
     EXPECT_TRUE(static_cast<bool>(uuid));
-}
\ No newline at end of file
+}
+
+TEST(UuidGeneratorTests, TextConversionAtEdges) {
+    Uuid parsed("12345678-1234-1234-1234-123456789ABC");
+    EXPECT_EQ(parsed.toString(), "12345678-1234-1234-1234-123456789abc");
+    EXPECT_EQ(parsed, Uuid("12345678-1234-1234-1234-123456789abc"));
+
+    Uuid empty("");
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty, Uuid());
+
+    Uuid named("subgraph-uuid");
+    EXPECT_FALSE(named.empty());
+    EXPECT_EQ(named, Uuid(std::string("subgraph-uuid")));
+    EXPECT_NE(named, Uuid("other-uuid"));
+    EXPECT_EQ(Uuid(named.toString()), named);
+
+    std::unordered_map<Uuid, int> map;
+    map[parsed] = 1;
+    map[named] = 2;
+    EXPECT_EQ(map.at(Uuid("12345678-1234-1234-1234-123456789abc")), 1);
+    EXPECT_EQ(map.at(Uuid("subgraph-uuid")), 2);
+    EXPECT_EQ(sizeof(Uuid), 16);
+
+    static_assert(!std::is_convertible_v<const char *, Uuid>);
+    static_assert(!std::is_convertible_v<std::string, Uuid>);
+
+    Uuid strict;
+    const std::string malformed = "subgraph-uuid";
+    EXPECT_FALSE(Uuid::tryParse(malformed.data(), malformed.size(), strict));
+    EXPECT_TRUE(strict.empty());
+    const std::string canonical = parsed.toString();
+    EXPECT_TRUE(Uuid::tryParse(canonical.data(), canonical.size(), strict));
+    EXPECT_EQ(strict, parsed);
+}
+
+TEST(UuidGeneratorTests, GenerateBatch) {
+    auto& generator = UuidGenerator::getInstance();
+    uint64_t countBefore = generator.getGenerationCount();
+
+    std::vector<Uuid> uuids = generator.generateBatch(1000);
+    ASSERT_EQ(uuids.size(), 1000);
+    EXPECT_EQ(generator.getGenerationCount(), countBefore + 1000);
+
+    std::unordered_set<Uuid> unique(uuids.begin(), uuids.end());
+    EXPECT_EQ(unique.size(), uuids.size());
+    for (const auto& uuid : uuids) {
+        EXPECT_EQ(uuid.getVersion(), 4);
+        EXPECT_EQ(uuid.getData()[8] & 0xC0, 0x80);
+    }
+}
+
+TEST(UuidGeneratorTests, ReseedIsDeterministicPerThread) {
+    auto& generator = UuidGenerator::getInstance();
+
+    generator.reseed(1234);
+    Uuid first = generator.generateV4();
+    generator.reseed(1234);
+    Uuid second = generator.generateV4();
+    EXPECT_EQ(first, second);
+
+    generator.reseed();
+    EXPECT_NE(generator.generateV4(), first);
+}
+
+TEST(UuidGeneratorTests, GenerateV7IsTimeOrdered) {
+    auto& generator = UuidGenerator::getInstance();
+
+    Uuid previous = generator.generateV7();
+    EXPECT_EQ(previous.getVersion(), 7);
+    EXPECT_EQ(previous.getData()[8] & 0xC0, 0x80);
+
+    for (int i = 0; i < 10000; ++i) {
+        Uuid next = generator.generateV7();
+        ASSERT_TRUE(previous < next);
+        previous = next;
+    }
+
+    generator.setDefaultVersion(UuidVersion::V7);
+    EXPECT_EQ(generator.generate().getVersion(), 7);
+    generator.setDefaultVersion(UuidVersion::V4);
+    EXPECT_EQ(generator.generate().getVersion(), 4);
+}
+
+TEST(UuidGeneratorTests, SortedUuidIndex) {
+    auto& generator = UuidGenerator::getInstance();
+    SortedUuidIndex<int> index;
+
+    std::vector<Uuid> ordered;
+    for (int i = 0; i < 100; ++i) {
+        ordered.push_back(generator.generateV7());
+        EXPECT_TRUE(index.insert(ordered.back(), i));
+    }
+
+    Uuid random = generator.generateV4();
+    EXPECT_TRUE(index.insert(random, -1));
+    EXPECT_FALSE(index.insert(random, -2));
+    EXPECT_EQ(index.size(), 101);
+    EXPECT_TRUE(std::is_sorted(index.begin(), index.end(),
+                               [](const auto& a, const auto& b) { return a.first < b.first; }));
+
+    ASSERT_NE(index.find(ordered[42]), nullptr);
+    EXPECT_EQ(*index.find(ordered[42]), 42);
+    EXPECT_EQ(*index.find(random), -2);
+
+    EXPECT_TRUE(index.erase(ordered[42]));
+    EXPECT_FALSE(index.contains(ordered[42]));
+    EXPECT_FALSE(index.erase(ordered[42]));
+    EXPECT_EQ(index.size(), 100);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "../../AdvancedNodeEditor/Editor/Model/NodeEditorModel.h"
+#include "../../AdvancedNodeEditor/Core/NodeEditor.h"
 
 using namespace NodeEditorCore;
 
@@ -220,4 +221,66 @@ TEST_F(ModelTests, EventListeners) {
     
     model->addNode("TestNode", "Default", Vec2(100, 100));
     EXPECT_TRUE(eventFired);
-}
\ No newline at end of file
+}
+
+TEST_F(ModelTests, GraphStorageIsShared) {
+    int node1 = model->addNode("Node1", "Default", Vec2(100, 100));
+    int node2 = model->addNode("Node2", "Default", Vec2(200, 100));
+    int pin1 = model->addPin(node1, "Output", false, PinType::Blue);
+    int pin2 = model->addPin(node2, "Input", true, PinType::Blue);
+    int connectionId = model->addConnection(node1, pin1, node2, pin2);
+
+    auto graph = model->getGraph();
+    EXPECT_EQ(graph->getNode(node1), model->getNode(node1));
+    EXPECT_EQ(graph->getConnection(connectionId), model->getConnection(connectionId));
+    EXPECT_EQ(&graph->getNodes(), &model->getNodes());
+
+    model->getNode(node2)->position = Vec2(300, 150);
+    EXPECT_EQ(graph->getNode(node2)->position.x, 300);
+
+    model->removeNode(node1);
+    EXPECT_EQ(graph->getNodes().size(), 1u);
+    EXPECT_TRUE(graph->getConnections().empty());
+    EXPECT_FALSE(model->isConnected(node2, pin2));
+}
+
+TEST_F(ModelTests, RemoveNodeOnlyReportsNodesThatWereRemoved) {
+    int removedEvents = 0;
+    model->addEventListener(EventType::NodeRemoved, [&removedEvents](const Event&) {
+        ++removedEvents;
+    });
+
+    int kept = model->addNode("Kept", "Default", Vec2(0, 0));
+    model->getNode(kept)->isProtected = true;
+    model->removeNode(kept);
+    EXPECT_NE(model->getNode(kept), nullptr);
+    EXPECT_EQ(removedEvents, 0);
+
+    int removed = model->addNode("Removed", "Default", Vec2(100, 0));
+    model->removeNode(removed);
+    EXPECT_EQ(model->getNode(removed), nullptr);
+    EXPECT_EQ(removedEvents, 1);
+}
+
+TEST_F(ModelTests, SubgraphNavigationDrivesTheGraph) {
+    int outer = model->createSubgraph("Outer");
+    int inner = model->createSubgraph("Inner");
+
+    model->enterSubgraph(outer);
+    EXPECT_EQ(model->getCurrentSubgraphId(), outer);
+    EXPECT_EQ(model->getGraph()->getCurrentSubgraphId(), outer);
+
+    model->enterSubgraph(inner);
+    EXPECT_EQ(model->getGraph()->getCurrentSubgraphId(), inner);
+
+    model->enterSubgraph(inner + 100);
+    EXPECT_EQ(model->getCurrentSubgraphId(), inner);
+
+    model->exitSubgraph();
+    EXPECT_EQ(model->getCurrentSubgraphId(), outer);
+    EXPECT_EQ(model->getGraph()->getCurrentSubgraphId(), outer);
+
+    model->exitSubgraph();
+    EXPECT_EQ(model->getCurrentSubgraphId(), -1);
+    EXPECT_EQ(model->getGraph()->getCurrentSubgraphId(), -1);
+}
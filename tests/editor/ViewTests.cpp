@@ -1,6 +1,13 @@
 #include <gtest/gtest.h>
 #include "../../AdvancedNodeEditor/Editor/View/NodeEditorView.h"
 #include "../../AdvancedNodeEditor/Editor/Controller/NodeEditorController.h"
+#include "../../AdvancedNodeEditor/Editor/View/NodeGeometryStore.h"
+#include "../../AdvancedNodeEditor/Editor/View/SpatialGrid.h"
+#include "../../AdvancedNodeEditor/Editor/View/ConnectionGeometryCache.h"
+#include "../../AdvancedNodeEditor/Editor/View/CurveDistance.h"
+#include <cfloat>
+#include <cmath>
+#include <random>
 
 using namespace NodeEditorCore;
 
@@ -81,4 +88,205 @@ TEST_F(ViewTests, CenterOnNode) {
 
     EXPECT_NE(newPosition.x, oldPosition.x);
     EXPECT_NE(newPosition.y, oldPosition.y);
-}
\ No newline at end of file
+}
+
+TEST(NodeGeometryStoreTests, SyncBoundsAndRectQueries) {
+    std::vector<Node> nodes;
+    nodes.emplace_back(1, "A", "Default", Vec2(0, 0));
+    nodes.emplace_back(2, "B", "Default", Vec2(300, 50));
+    nodes.emplace_back(3, "C", "Default", Vec2(-500, -500));
+    nodes[1].selected = true;
+    nodes[2].setSubgraphId(4);
+
+    NodeGeometryStore geometry;
+    geometry.sync(nodes);
+    ASSERT_EQ(geometry.size(), 3);
+    EXPECT_TRUE(geometry.isSelected(1));
+    EXPECT_FALSE(geometry.isSelected(0));
+
+    std::vector<uint32_t> indices;
+    geometry.collectInSubgraph(-1, indices);
+    EXPECT_EQ(indices, (std::vector<uint32_t>{0, 1}));
+    geometry.collectInSubgraph(4, indices);
+    EXPECT_EQ(indices, (std::vector<uint32_t>{2}));
+
+    Vec2 min, max;
+    ASSERT_TRUE(geometry.computeBounds(-1, min, max));
+    EXPECT_FLOAT_EQ(min.x, 0.0f);
+    EXPECT_FLOAT_EQ(min.y, 0.0f);
+    EXPECT_FLOAT_EQ(max.x, 440.0f);
+    EXPECT_FLOAT_EQ(max.y, 78.0f);
+    EXPECT_FALSE(geometry.computeBounds(9, min, max));
+
+    std::vector<uint8_t> mask;
+    geometry.intersectScreenRect(Vec2(0, 0), 1.0f, Vec2(100, -10), Vec2(350, 10), mask);
+    EXPECT_EQ(mask, (std::vector<uint8_t>{1, 0, 0}));
+
+    geometry.setSelected(1, false);
+    EXPECT_FALSE(geometry.isSelected(1));
+}
+
+TEST(NodeGeometryStoreTests, SyncTracksChangedGeometry) {
+    std::vector<Node> nodes;
+    nodes.emplace_back(1, "A", "Default", Vec2(0, 0));
+    nodes.emplace_back(2, "B", "Default", Vec2(300, 50));
+
+    NodeGeometryStore geometry;
+    geometry.sync(nodes);
+    EXPECT_TRUE(geometry.changed().empty());
+
+    nodes[1].position = Vec2(310, 50);
+    nodes[0].selected = true;
+    geometry.sync(nodes);
+    geometry.sync(nodes);
+    EXPECT_EQ(geometry.changed(), (std::vector<uint32_t>{1}));
+
+    geometry.clearChanged();
+    geometry.setPosition(0, Vec2(5, 5));
+    EXPECT_EQ(geometry.changed(), (std::vector<uint32_t>{0}));
+}
+
+TEST(SpatialGridTests, UpdateMoveAndQuery) {
+    SpatialGrid grid(100.0f);
+    EXPECT_TRUE(grid.update(0, Vec2(0, 0), Vec2(50, 50)));
+    EXPECT_TRUE(grid.update(1, Vec2(250, 250), Vec2(260, 260)));
+    EXPECT_TRUE(grid.update(2, Vec2(-5000, -10), Vec2(5000, 10)));
+    EXPECT_FALSE(grid.update(0, Vec2(0, 0), Vec2(50, 50)));
+    EXPECT_EQ(grid.size(), 3u);
+
+    std::vector<uint32_t> items;
+    grid.query(Vec2(10, 5), Vec2(20, 15), items);
+    EXPECT_EQ(items, (std::vector<uint32_t>{0, 2}));
+    grid.query(Vec2(240, 240), Vec2(300, 300), items);
+    EXPECT_EQ(items, (std::vector<uint32_t>{1}));
+
+    EXPECT_TRUE(grid.update(1, Vec2(10, 10), Vec2(20, 20)));
+    grid.query(Vec2(240, 240), Vec2(300, 300), items);
+    EXPECT_TRUE(items.empty());
+    grid.query(Vec2(15, 10), Vec2(15, 10), items);
+    EXPECT_EQ(items, (std::vector<uint32_t>{0, 1, 2}));
+
+    grid.remove(2);
+    EXPECT_FALSE(grid.contains(2));
+    grid.query(Vec2(-6000, -6000), Vec2(6000, 6000), items);
+    EXPECT_EQ(items, (std::vector<uint32_t>{0, 1}));
+}
+
+TEST(ConnectionGeometryCacheTests, BuildFlattenAndMeasure) {
+    ConnectionGeometryCache::Geometry path;
+    path.key.shape = ConnectionGeometryCache::Shape::Straight;
+    path.points = {Vec2(0, 0), Vec2(100, 0), Vec2(100, 100)};
+    ConnectionGeometryCache::build(path);
+    ConnectionGeometryCache::flatten(path);
+
+    EXPECT_FLOAT_EQ(path.min.x, 0.0f);
+    EXPECT_FLOAT_EQ(path.max.y, 100.0f);
+    EXPECT_FLOAT_EQ(path.length(), 200.0f);
+    EXPECT_FLOAT_EQ(path.pointAtDistance(150.0f).y, 50.0f);
+
+    int segment = -1;
+    EXPECT_FLOAT_EQ(path.distanceTo(Vec2(50, 10), segment), 10.0f);
+    EXPECT_EQ(segment, 0);
+    EXPECT_FLOAT_EQ(path.distanceTo(Vec2(110, 60), segment), 10.0f);
+    EXPECT_EQ(segment, 1);
+
+    ConnectionGeometryCache::Geometry curve;
+    curve.key.tension = 0.5f;
+    curve.points = {Vec2(0, 0), Vec2(300, 120)};
+    ConnectionGeometryCache::build(curve);
+    ConnectionGeometryCache::flatten(curve);
+    ASSERT_EQ(curve.controls.size(), 2u);
+
+    const Vec2 &p0 = curve.points[0], &p1 = curve.controls[0], &p2 = curve.controls[1], &p3 = curve.points[1];
+    Vec2 sampledMin(p0), sampledMax(p0);
+    for (int i = 0; i <= 1000; ++i) {
+        const float t = i / 1000.0f, u = 1.0f - t;
+        const Vec2 point(u * u * u * p0.x + 3 * u * u * t * p1.x + 3 * u * t * t * p2.x + t * t * t * p3.x,
+                         u * u * u * p0.y + 3 * u * u * t * p1.y + 3 * u * t * t * p2.y + t * t * t * p3.y);
+        sampledMin = Vec2(std::min(sampledMin.x, point.x), std::min(sampledMin.y, point.y));
+        sampledMax = Vec2(std::max(sampledMax.x, point.x), std::max(sampledMax.y, point.y));
+        EXPECT_LE(curve.distanceTo(point, segment), ConnectionGeometryCache::kFlatnessTolerance + 1e-3f);
+    }
+    EXPECT_NEAR(curve.min.y, sampledMin.y, 0.01f);
+    EXPECT_NEAR(curve.max.y, sampledMax.y, 0.01f);
+    EXPECT_NEAR(curve.max.x, sampledMax.x, 0.01f);
+
+    ConnectionGeometryCache cache;
+    cache.slot(3).valid = true;
+    EXPECT_EQ(cache.validCount(), 1u);
+    cache.invalidate(3);
+    cache.invalidate(42);
+    EXPECT_EQ(cache.validCount(), 0u);
+}
+
+static float sampledCubicDistance(const Vec2 &point, const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3) {
+    float best = FLT_MAX;
+    Vec2 prev = p0;
+    for (int i = 1; i <= 50; ++i) {
+        const float t = i / 50.0f, u = 1.0f - t;
+        const Vec2 current(u * u * u * p0.x + 3 * u * u * t * p1.x + 3 * u * t * t * p2.x + t * t * t * p3.x,
+                           u * u * u * p0.y + 3 * u * u * t * p1.y + 3 * u * t * t * p2.y + t * t * t * p3.y);
+        const float dx = current.x - prev.x, dy = current.y - prev.y;
+        const float s = std::clamp(((point.x - prev.x) * dx + (point.y - prev.y) * dy) / (dx * dx + dy * dy + 1e-12f),
+                                   0.0f, 1.0f);
+        best = std::min(best, std::hypot(point.x - prev.x - s * dx, point.y - prev.y - s * dy));
+        prev = current;
+    }
+    return best;
+}
+
+TEST(CurveDistanceTests, BatchMatchesSampledReference) {
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> coordinate(0.0f, 2000.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> offset(-20.0f, 20.0f);
+
+    for (int round = 0; round < 50; ++round) {
+        CubicBatch batch;
+        std::vector<Vec2> controls;
+        for (int i = 0; i < 7; ++i) {
+            const Vec2 start(coordinate(random), coordinate(random));
+            const Vec2 end(coordinate(random), coordinate(random));
+            const float cpDistance = std::hypot(end.x - start.x, end.y - start.y) * 0.5f;
+            const Vec2 cp1(start.x, start.y + (i % 2 ? cpDistance : -cpDistance));
+            const Vec2 cp2(end.x, end.y - cpDistance);
+            controls.insert(controls.end(), {start, cp1, cp2, end});
+            batch.add(start, cp1, cp2, end);
+        }
+        ASSERT_EQ(batch.size(), 7u);
+
+        // Query near a point on one of the curves, and somewhere arbitrary.
+        const Vec2 *near = &controls[(round % 7) * 4];
+        const float t = unit(random), u = 1.0f - t;
+        const Vec2 onCurve(u * u * u * near[0].x + 3 * u * u * t * near[1].x + 3 * u * t * t * near[2].x +
+                           t * t * t * near[3].x,
+                           u * u * u * near[0].y + 3 * u * u * t * near[1].y + 3 * u * t * t * near[2].y +
+                           t * t * t * near[3].y);
+
+        for (const Vec2 &query: {Vec2(onCurve.x + offset(random), onCurve.y + offset(random)),
+                                 Vec2(coordinate(random), coordinate(random))}) {
+            std::vector<float> distances(batch.size());
+            batch.distances(query, FLT_MAX, distances.data());
+            std::vector<float> culled(batch.size());
+            batch.distances(query, 12.0f, culled.data());
+
+            for (size_t i = 0; i < batch.size(); ++i) {
+                const Vec2 *p = &controls[i * 4];
+                const float reference = sampledCubicDistance(query, p[0], p[1], p[2], p[3]);
+                const float scalar = CurveDistance::toCubic(query, p[0], p[1], p[2], p[3]);
+
+                // The reference is itself off by up to its chord error, |B''|max / (8 * 50^2).
+                const float secondDifference = std::max(
+                    std::hypot(p[0].x - 2 * p[1].x + p[2].x, p[0].y - 2 * p[1].y + p[2].y),
+                    std::hypot(p[1].x - 2 * p[2].x + p[3].x, p[1].y - 2 * p[2].y + p[3].y));
+                EXPECT_NEAR(scalar, reference, 0.3f + 6.0f * secondDifference / (8.0f * 50 * 50));
+                EXPECT_NEAR(distances[i], scalar, 1e-3f * std::max(1.0f, scalar));
+                if (culled[i] == FLT_MAX) {
+                    EXPECT_GT(scalar, 12.0f);
+                } else {
+                    EXPECT_FLOAT_EQ(culled[i], distances[i]);
+                }
+            }
+        }
+    }
+}
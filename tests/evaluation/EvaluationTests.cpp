@@ -86,7 +86,7 @@ TEST_F(EvaluationTests, OperationsWithUUIDs) {
 }
 
 TEST_F(EvaluationTests, SubgraphEvaluation) {
-    int subgraphId = editor.createSubgraph("Subgraph", "", true);
+    int subgraphId = editor.createSubgraph("Subgraph", UUID(), true);
 
     editor.addNodeToSubgraph(node1Id, subgraphId);
     editor.addNodeToSubgraph(node2Id, subgraphId);
@@ -96,4 +96,53 @@ TEST_F(EvaluationTests, SubgraphEvaluation) {
     std::vector<int> orderInSubgraph = editor.getEvaluationOrder();
 
     ASSERT_LE(orderInSubgraph.size(), 2);
-}
\ No newline at end of file
+}
+
+TEST_F(EvaluationTests, EvaluationPlanIsCachedUntilStructuralEdit) {
+    const NodeEvaluator::EvaluationPlan &plan = editor.getEvaluationPlan();
+    uint64_t version = editor.getGraphVersion();
+
+    ASSERT_EQ(plan.steps.size(), 3);
+    EXPECT_FALSE(plan.hasCycle);
+    EXPECT_EQ(plan.steps[1].nodeId, node2Id);
+    ASSERT_EQ(plan.steps[1].inputCount, 1);
+
+    const NodeEvaluator::InputSlot &slot = plan.inputs[plan.steps[1].firstInput];
+    EXPECT_EQ(slot.pinId, pin2Id);
+    EXPECT_EQ(slot.sourceStep, 0);
+    EXPECT_EQ(slot.sourcePinId, pin1Id);
+    EXPECT_EQ(slot.connectionId, conn1Id);
+
+    editor.getNode(node2Id)->position = Vec2(0, 0);
+    EXPECT_EQ(editor.getGraphVersion(), version);
+    EXPECT_EQ(&editor.getEvaluationPlan(), &plan);
+    EXPECT_EQ(editor.getEvaluationPlan().graphVersion, version);
+
+    editor.removeConnection(conn1Id);
+    EXPECT_GT(editor.getGraphVersion(), version);
+
+    const NodeEvaluator::EvaluationPlan &updated = editor.getEvaluationPlan();
+    EXPECT_EQ(updated.graphVersion, editor.getGraphVersion());
+    for (const auto &step: updated.steps) {
+        if (step.nodeId != node2Id) continue;
+        EXPECT_EQ(updated.inputs[step.firstInput].sourceStep, -1);
+    }
+}
+
+TEST_F(EvaluationTests, EvaluationPlanStampChangesOnSubgraphSwitch) {
+    int subgraphId = editor.createSubgraph("Subgraph", UUID(), true);
+    editor.addNodeToSubgraph(node1Id, subgraphId);
+
+    const uint64_t rootStamp = editor.getEvaluationPlan().compileStamp;
+    const uint64_t version = editor.getGraphVersion();
+    EXPECT_EQ(editor.getEvaluationPlan().compileStamp, rootStamp);
+
+    editor.setCurrentSubgraphId(subgraphId);
+    EXPECT_EQ(editor.getGraphVersion(), version);
+    const uint64_t subgraphStamp = editor.getEvaluationPlan().compileStamp;
+    EXPECT_NE(subgraphStamp, rootStamp);
+
+    editor.setCurrentSubgraphId(-1);
+    EXPECT_NE(editor.getEvaluationPlan().compileStamp, subgraphStamp);
+    EXPECT_NE(editor.getEvaluationPlan().compileStamp, rootStamp);
+}
@@ -0,0 +1,282 @@
+#include <gtest/gtest.h>
+#include "../../AdvancedNodeEditor/NodeEditorAPI.h"
+
+using namespace NodeEditorCore;
+
+class IncrementalEvaluationTests : public ::testing::Test {
+protected:
+    NodeEditorAPI api;
+    UUID constantA, constantB, sum, doubled;
+    int addCalls = 0;
+
+    void SetUp() override {
+        NodeEditorAPI::NodeDefinition constant;
+        constant.type = "Constant";
+        constant.name = "Constant";
+        constant.outputs = {{"Value", PinType::Blue}};
+        api.registerNodeType(constant);
+
+        NodeEditorAPI::NodeDefinition add;
+        add.type = "Add";
+        add.name = "Add";
+        add.inputs = {{"A", PinType::Blue}, {"B", PinType::Blue}};
+        add.outputs = {{"Result", PinType::Blue}};
+        api.registerNodeType(add);
+
+        NodeEditorAPI::NodeDefinition twice;
+        twice.type = "Twice";
+        twice.name = "Twice";
+        twice.inputs = {{"Value", PinType::Blue}};
+        twice.outputs = {{"Result", PinType::Blue}};
+        api.registerNodeType(twice);
+
+        api.registerEvaluator("Add", [this](const std::vector<std::any>& inputs) -> std::any {
+            addCalls++;
+            return std::any_cast<float>(inputs[0]) + std::any_cast<float>(inputs[1]);
+        });
+        api.registerEvaluator("Twice", [](const std::vector<std::any>& inputs) -> std::any {
+            return std::any_cast<float>(inputs[0]) * 2.0f;
+        });
+
+        constantA = api.createNode("Constant", "A", Vec2(0, 0));
+        constantB = api.createNode("Constant", "B", Vec2(0, 100));
+        sum = api.createNode("Add", "Sum", Vec2(200, 50));
+        doubled = api.createNode("Twice", "Doubled", Vec2(400, 50));
+
+        api.setConstantValue(constantA, 1.0f);
+        api.setConstantValue(constantB, 2.0f);
+
+        api.connectNodes(constantA, "Value", sum, "A");
+        api.connectNodes(constantB, "Value", sum, "B");
+        api.connectNodes(sum, "Result", doubled, "Value");
+    }
+};
+
+TEST_F(IncrementalEvaluationTests, RecomputesOnlyDirtyCone) {
+    auto first = api.evaluateGraph(doubled);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(first.value), 6.0f);
+    EXPECT_EQ(first.recomputedNodes, 4);
+
+    auto unchanged = api.evaluateGraph(doubled);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(unchanged.value), 6.0f);
+    EXPECT_EQ(unchanged.recomputedNodes, 0);
+    EXPECT_EQ(addCalls, 1);
+
+    api.setConstantValue(constantB, 5.0f);
+    auto edited = api.evaluateGraph(doubled);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(edited.value), 12.0f);
+    EXPECT_EQ(edited.recomputedNodes, 3);
+    EXPECT_EQ(addCalls, 2);
+}
+
+TEST_F(IncrementalEvaluationTests, RecycledNodeIdDoesNotReuseCache) {
+    api.evaluateGraph(doubled);
+
+    NodeEditor* editor = api.getUnderlyingEditor();
+    int doubledId = editor->getNodeId(doubled);
+    api.removeNode(doubled);
+
+    UUID replacement = api.createNode("Twice", "Replacement", Vec2(400, 50));
+    api.connectNodes(sum, "Result", replacement, "Value");
+    ASSERT_EQ(editor->getNodeId(replacement), doubledId);
+
+    auto result = api.evaluateGraph(replacement);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(result.value), 6.0f);
+    EXPECT_EQ(result.recomputedNodes, 1);
+}
+
+TEST_F(IncrementalEvaluationTests, ConnectionChangeMarksDownstreamDirty) {
+    api.evaluateGraph(doubled);
+
+    UUID constantC = api.createNode("Constant", "C", Vec2(0, 200));
+    api.setConstantValue(constantC, 10.0f);
+
+    NodeEditor* editor = api.getUnderlyingEditor();
+    for (const auto& connection : editor->getInputConnections(editor->getNodeId(sum))) {
+        if (connection.sourceNodeUuid == constantB) {
+            api.disconnectNodes(connection.connectionUuid);
+        }
+    }
+    api.connectNodes(constantC, "Value", sum, "B");
+
+    auto result = api.evaluateGraph(doubled);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(result.value), 22.0f);
+    EXPECT_EQ(result.recomputedNodes, 3);
+}
+
+TEST_F(IncrementalEvaluationTests, ParallelMatchesSerial) {
+    api.beginBatch(64, 128);
+    UUID previous = doubled;
+    std::vector<UUID> sinks;
+    for (int i = 0; i < 32; ++i) {
+        UUID left = api.createNode("Twice", "Left", Vec2(600, i * 50.0f));
+        UUID right = api.createNode("Add", "Right", Vec2(800, i * 50.0f));
+        api.connectNodes(previous, "Result", left, "Value");
+        api.connectNodes(left, "Result", right, "A");
+        api.connectNodes(previous, "Result", right, "B");
+        sinks.push_back(right);
+        previous = left;
+    }
+    api.endBatch();
+
+    auto serial = api.evaluateGraph(sinks.back());
+    std::vector<float> serialValues;
+    for (const auto& sink : sinks) {
+        api.invalidateEvaluation();
+        serialValues.push_back(std::any_cast<float>(api.evaluateGraph(sink).value));
+    }
+
+    api.setEvaluationThreadCount(4);
+    EXPECT_EQ(api.getEvaluationThreadCount(), 4);
+
+    api.invalidateEvaluation();
+    auto parallel = api.evaluateGraph(sinks.back());
+    EXPECT_EQ(parallel.recomputedNodes, serial.recomputedNodes);
+    EXPECT_EQ(parallel.evaluationOrder, serial.evaluationOrder);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(parallel.value), std::any_cast<float>(serial.value));
+
+    for (size_t i = 0; i < sinks.size(); ++i) {
+        EXPECT_FLOAT_EQ(std::any_cast<float>(api.evaluateGraph(sinks[i]).value), serialValues[i]);
+    }
+
+    api.setEvaluationThreadCount(1);
+    EXPECT_EQ(api.getEvaluationThreadCount(), 1);
+}
+
+TEST_F(IncrementalEvaluationTests, PinEvaluatorWritesOneResultPerOutput) {
+    NodeEditorAPI::NodeDefinition split;
+    split.type = "Split";
+    split.name = "Split";
+    split.inputs = {{"Value", PinType::Blue}};
+    split.outputs = {{"Half", PinType::Blue}, {"Negated", PinType::Blue}};
+    api.registerNodeType(split);
+
+    api.registerPinEvaluator("Split", [](const std::vector<std::any>& inputs, std::vector<std::any>& outputs) {
+        float value = std::any_cast<float>(inputs[0]);
+        outputs[0] = value * 0.5f;
+        outputs[1] = -value;
+    });
+
+    UUID splitter = api.createNode("Split", "Split", Vec2(600, 50));
+    UUID half = api.createNode("Twice", "FromHalf", Vec2(800, 0));
+    UUID negated = api.createNode("Twice", "FromNegated", Vec2(800, 100));
+
+    api.connectNodes(doubled, "Result", splitter, "Value");
+    api.connectNodes(splitter, "Half", half, "Value");
+    api.connectNodes(splitter, "Negated", negated, "Value");
+
+    auto splitResult = api.evaluateGraph(splitter);
+    ASSERT_EQ(splitResult.outputValues.size(), 2);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(splitResult.outputValues[0]), 3.0f);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(splitResult.outputValues[1]), -6.0f);
+
+    EXPECT_FLOAT_EQ(std::any_cast<float>(api.evaluateGraph(half).value), 6.0f);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(api.evaluateGraph(negated).value), -12.0f);
+}
+
+TEST_F(IncrementalEvaluationTests, TypedEvaluationMatchesAnyPath) {
+    api.registerTypedEvaluator("Add", [](std::span<const EvaluationValue> inputs, std::span<EvaluationValue> outputs) {
+        outputs[0] = inputs[0].asFloat() + inputs[1].asFloat();
+    });
+    api.registerTypedEvaluator("Twice", [](std::span<const EvaluationValue> inputs, std::span<EvaluationValue> outputs) {
+        outputs[0] = inputs[0].asFloat() * 2.0f;
+    });
+
+    auto typed = api.evaluateGraphTyped(doubled);
+    EXPECT_EQ(typed.value.getType(), ValueType::Float);
+    EXPECT_FLOAT_EQ(typed.value.asFloat(), std::any_cast<float>(api.evaluateGraph(doubled).value));
+    EXPECT_EQ(typed.evaluatedNodes, 4);
+
+    auto partial = api.evaluateGraphTyped(sum);
+    ASSERT_EQ(partial.outputValues.size(), 1);
+    EXPECT_FLOAT_EQ(partial.outputValues[0].asFloat(), 3.0f);
+
+    api.setConstantValue(constantA, 4);
+    EXPECT_FLOAT_EQ(api.evaluateGraphTyped(doubled).value.asFloat(), 12.0f);
+}
+
+TEST_F(IncrementalEvaluationTests, BatchEvaluationWalksGraphOncePerBatch) {
+    api.registerBatchEvaluator("Add", BatchKernels::addEvaluator);
+    api.registerTypedEvaluator("Twice", [](std::span<const EvaluationValue> inputs, std::span<EvaluationValue> outputs) {
+        outputs[0] = inputs[0].asFloat() * 2.0f;
+    });
+
+    std::vector<float> columnA = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    std::unordered_map<UUID, std::span<const float>> columns = {{constantA, columnA}};
+
+    auto result = api.evaluateGraphBatch(columns, columnA.size(), doubled);
+    ASSERT_EQ(result.values.size(), columnA.size());
+    for (size_t lane = 0; lane < columnA.size(); ++lane) {
+        EXPECT_FLOAT_EQ(result.values[lane], (columnA[lane] + 2.0f) * 2.0f);
+    }
+    EXPECT_EQ(addCalls, 0);
+}
+
+TEST_F(IncrementalEvaluationTests, BuiltinBatchKernelsMatchMathNodes) {
+    std::vector<float> a = {1.0f, -2.0f, 3.5f, 0.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f};
+    std::vector<float> b = {4.0f, 5.0f, -6.0f, 7.0f, 0.5f, 1.0f, 2.0f, 3.0f, 4.0f};
+    std::vector<float> sumOut(a.size()), productOut(a.size()), differenceOut(a.size());
+
+    std::vector<const float*> inputs = {a.data(), b.data()};
+    std::vector<float*> sumOutputs = {sumOut.data()};
+    std::vector<float*> productOutputs = {productOut.data()};
+    std::vector<float*> differenceOutputs = {differenceOut.data()};
+
+    BatchKernels::addEvaluator(inputs, sumOutputs, a.size());
+    BatchKernels::multiplyEvaluator(inputs, productOutputs, a.size());
+    BatchKernels::subtractEvaluator(inputs, differenceOutputs, a.size());
+
+    for (size_t lane = 0; lane < a.size(); ++lane) {
+        EXPECT_FLOAT_EQ(sumOut[lane], a[lane] + b[lane]);
+        EXPECT_FLOAT_EQ(productOut[lane], a[lane] * b[lane]);
+        EXPECT_FLOAT_EQ(differenceOut[lane], a[lane] - b[lane]);
+    }
+}
+
+TEST_F(IncrementalEvaluationTests, SubgraphEvaluationKeepsRootResultsFresh) {
+    UUID subgraph = api.createGraph("Inner");
+    NodeEditor *editor = api.getUnderlyingEditor();
+    editor->addNodeToSubgraph(editor->getNodeId(constantA), editor->getSubgraphId(subgraph));
+    EXPECT_FLOAT_EQ(std::any_cast<float>(api.evaluateGraph(doubled).value), 6.0f);
+
+    api.enterSubgraph(subgraph);
+    api.setConstantValue(constantA, 5.0f);
+    api.setConstantValue(constantB, 3.0f);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(api.evaluateGraph(constantA).value), 5.0f);
+    api.exitSubgraph();
+
+    auto root = api.evaluateGraph(doubled);
+    EXPECT_FLOAT_EQ(std::any_cast<float>(root.value), 16.0f);
+    EXPECT_EQ(root.recomputedNodes, 3);
+}
+
+TEST_F(IncrementalEvaluationTests, TypedDispatchFollowsSubgraphSwitch) {
+    int twiceCalls = 0;
+    api.registerTypedEvaluator("Add", [](std::span<const EvaluationValue> inputs, std::span<EvaluationValue> outputs) {
+        outputs[0] = inputs[0].asFloat() + inputs[1].asFloat();
+    });
+    api.registerTypedEvaluator("Twice", [&twiceCalls](std::span<const EvaluationValue> inputs,
+                                                      std::span<EvaluationValue> outputs) {
+        twiceCalls++;
+        outputs[0] = inputs[0].asFloat() * 2.0f;
+    });
+
+    // Two plans with the same step count and graph version but different node types per step.
+    NodeEditor *editor = api.getUnderlyingEditor();
+    int first = editor->createSubgraph("First", UUID(), false);
+    int second = editor->createSubgraph("Second", UUID(), false);
+    editor->addNodeToSubgraph(editor->getNodeId(constantA), first);
+    editor->addNodeToSubgraph(editor->getNodeId(doubled), first);
+    editor->addNodeToSubgraph(editor->getNodeId(constantB), second);
+    editor->addNodeToSubgraph(editor->getNodeId(sum), second);
+
+    editor->enterSubgraph(first);
+    api.evaluateGraphTyped(doubled);
+    EXPECT_EQ(twiceCalls, 1);
+    editor->exitSubgraph();
+
+    editor->enterSubgraph(second);
+    auto result = api.evaluateGraphTyped(sum);
+    EXPECT_EQ(twiceCalls, 1);
+    EXPECT_FLOAT_EQ(result.value.asFloat(), 2.0f);
+}